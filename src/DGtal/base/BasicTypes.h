@@ -79,6 +79,47 @@ namespace DGtal
   typedef mpz_class BigInteger;
 #endif
 
+#if defined(__SIZEOF_INT128__)
+  #define WITH_INT128
+  ///signed 128-bit integer (compiler extension of gcc and clang).
+  __extension__ typedef __int128 int128_t;
+  ///unsigned 128-bit integer (compiler extension of gcc and clang).
+  __extension__ typedef unsigned __int128 uint128_t;
+
+  /**
+   * Writes a 128-bit unsigned integer in decimal on an output stream
+   * (the standard library does not provide it).
+   * @param out the output stream where the object is written.
+   * @param n any unsigned 128-bit integer.
+   * @return the output stream after the writing.
+   */
+  inline
+  std::ostream&
+  operator<< ( std::ostream & out, uint128_t n )
+  {
+    char buffer[ 40 ];
+    char* p = buffer + sizeof( buffer );
+    *--p = '\0';
+    do { *--p = char( '0' + int( n % 10 ) ); n /= 10; } while ( n != 0 );
+    return out << p;
+  }
+
+  /**
+   * Writes a 128-bit signed integer in decimal on an output stream
+   * (the standard library does not provide it).
+   * @param out the output stream where the object is written.
+   * @param n any signed 128-bit integer.
+   * @return the output stream after the writing.
+   */
+  inline
+  std::ostream&
+  operator<< ( std::ostream & out, int128_t n )
+  {
+    if ( n < 0 ) out << '-';
+    return out << ( n < 0 ? uint128_t( 0 ) - uint128_t( n ) : uint128_t( n ) );
+  }
+#endif
+
 } // namespace DGtal
 
 
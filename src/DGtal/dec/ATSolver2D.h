@@ -43,6 +43,7 @@
 #include <iostream>
 #include <sstream>
 #include <tuple>
+#include <functional>
 #include "DGtal/base/Common.h"
 #include "DGtal/base/ConstAlias.h"
 #include "DGtal/math/linalg/EigenSupport.h"
@@ -72,6 +73,16 @@ namespace DGtal
   * @tparam TLinearAlgebra any back-end for performing linear algebra,
   * default is EigenLinearAlgebraBackend.
   *
+  * @tparam TLinearAlgebraSolver the linear algebra solver used for
+  * both u and v, default is the sparse direct solver
+  * EigenLinearAlgebraBackend::SolverSimplicialLDLT. For large
+  * problems, iterative solvers like
+  * EigenLinearAlgebraBackend::SolverConjugateGradient,
+  * EigenLinearAlgebraBackend::SolverConjugateGradientIC or
+  * GeometricMultigridSolver use far less memory. They are then
+  * warm-started from the u and v of the previous iteration, and
+  * their parameters (e.g. tolerance) may be set with \ref solver_setup.
+  *
   * \code 
   * // Typical use (with appropriate definitions for types and variables).
   * typedef DiscreteExteriorCalculusFactory<EigenLinearAlgebraBackend> CalculusFactory;
@@ -86,7 +97,8 @@ namespace DGtal
   * @see exampleSurfaceATNormals.cpp
   */
   template < typename TKSpace,
-             typename TLinearAlgebra = EigenLinearAlgebraBackend >
+             typename TLinearAlgebra = EigenLinearAlgebraBackend,
+             typename TLinearAlgebraSolver = EigenLinearAlgebraBackend::SolverSimplicialLDLT >
   class ATSolver2D
   {
     // ----------------------- Standard services ------------------------------
@@ -94,7 +106,8 @@ namespace DGtal
 
     typedef TKSpace                                              KSpace;
     typedef TLinearAlgebra                                       LinearAlgebra;
-    typedef ATSolver2D< KSpace, LinearAlgebra >                  Self;
+    typedef TLinearAlgebraSolver                                 LinearAlgebraSolver;
+    typedef ATSolver2D< KSpace, LinearAlgebra, LinearAlgebraSolver > Self;
 
     static const Dimension dimension = KSpace::dimension;
 
@@ -132,10 +145,7 @@ namespace DGtal
     // SparseLU is so much faster than SparseQR
     // SimplicialLLT is much faster than SparseLU
     // SimplicialLDLT is as fast as SimplicialLLT but more robust
-    // typedef EigenLinearAlgebraBackend::SolverSparseQR LinearAlgebraSolver;
-    // typedef EigenLinearAlgebraBackend::SolverSparseLU LinearAlgebraSolver;
-    // typedef EigenLinearAlgebraBackend::SolverSimplicialLLT LinearAlgebraSolver;
-    typedef EigenLinearAlgebraBackend::SolverSimplicialLDLT LinearAlgebraSolver;
+    // (default LinearAlgebraSolver, see template parameters).
     typedef DiscreteExteriorCalculusSolver<Calculus, LinearAlgebraSolver, 2, PRIMAL, 2, PRIMAL> SolverU2;
     typedef DiscreteExteriorCalculusSolver<Calculus, LinearAlgebraSolver, 0, PRIMAL, 0, PRIMAL> SolverV0;
 
@@ -189,6 +199,10 @@ namespace DGtal
     bool                  normalize_u2;
     /// Tells the verbose level.
     int                   verbose;
+    /// When set, it is called on the linear algebra solvers of u and
+    /// v before each factorization, e.g. to set the tolerance of
+    /// iterative solvers.
+    std::function< void( LinearAlgebraSolver& ) > solver_setup;
 
     // ----------------------- Standard services ------------------------------
     /// @name Standard services
@@ -554,11 +568,13 @@ namespace DGtal
 
       if ( verbose >= 2 ) trace.info() << "Prefactoring matrix U associated to u" << std::endl;
       SolverU2 solver_u2;
+      if ( solver_setup ) solver_setup( solver_u2.myLinearAlgebraSolver );
       solver_u2.compute( ope_u2 );
       for ( Dimension d = 0; d < u2.size(); ++d )
         {
           if ( verbose >= 2 ) trace.info() << "Solving U u[" << d << "] = a g[" << d << "]" << std::endl;
-          u2[ d ] = solver_u2.solve( alpha_g2[ d ] );
+          // warm start from the previous u (for iterative solvers)
+          u2[ d ] = solver_u2.solveWithGuess( alpha_g2[ d ], u2[ d ] );
           if ( verbose >= 2 ) trace.info() << "  => " << ( solver_u2.isValid() ? "OK" : "ERROR" )
                                            << " " << solver_u2.myLinearAlgebraSolver.info() << std::endl;
           solve_ok = solve_ok && solver_u2.isValid();
@@ -577,9 +593,11 @@ namespace DGtal
 
       if ( verbose >= 2 ) trace.info() << "Prefactoring matrix V associated to v" << std::endl;
       SolverV0 solver_v0;
+      if ( solver_setup ) solver_setup( solver_v0.myLinearAlgebraSolver );
       solver_v0.compute( ope_v0 );
       if ( verbose >= 2 ) trace.info() << "Solving V v = l/4e * 1" << std::endl;
-      v0 = solver_v0.solve( l_1_over_4e );
+      // warm start from the previous v (for iterative solvers)
+      v0 = solver_v0.solveWithGuess( l_1_over_4e, v0 );
       if ( verbose >= 2 ) trace.info() << "  => " << ( solver_v0.isValid() ? "OK" : "ERROR" )
                                        << " " << solver_v0.myLinearAlgebraSolver.info() << std::endl;
       solve_ok = solve_ok && solver_v0.isValid();
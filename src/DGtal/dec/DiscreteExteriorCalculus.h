@@ -88,6 +88,18 @@ namespace DGtal
    * This is used to describe the space on which the dec is build and to compute various operators.
    * Once operators or kforms are created, this structure should not be modified.
    *
+   * Cells properties are stored in a map from cells to properties
+   * (see getProperties), used when the structure is modified. Once
+   * indexes are updated, they are also stored in flat arrays indexed
+   * by k-form indexes, and, when the cells fill most of their
+   * bounding box (e.g. calculus built on a rectangular domain), cell
+   * indexes are computed from Khalimsky coordinates in a dense
+   * array. Operators are built from these flat arrays, without any
+   * hashing, and in parallel with OpenMP. Calculus built by
+   * DiscreteExteriorCalculusFactory::createFromNSCells on such
+   * domains only use the flat arrays, and the map of properties is
+   * only built when it is accessed.
+   *
    * @tparam dimEmbedded dimension of emmbedded manifold.
    * @tparam dimAmbient dimension of ambient manifold.
    * @tparam TLinearAlgebraBackend linear algebra backend used (i.e. EigenSparseLinearAlgebraBackend).
@@ -168,6 +180,12 @@ namespace DGtal
     typedef std::vector<SCell> SCells;
     typedef boost::array<SCells, dimEmbedded+1> IndexedSCells;
 
+    /**
+     * Indices to cells properties typedefs.
+     */
+    typedef std::vector<Property> IndexedProperties;
+    typedef boost::array<IndexedProperties, dimEmbedded+1> IndexedPropertiesArray;
+
     /**
      * Vector field typedefs.
      */
@@ -549,8 +567,33 @@ namespace DGtal
 
     /**
      * Cells properties.
+     * Not built when myPropertiesNeedUpdate is true.
+     */
+    mutable Properties myCellProperties;
+
+    /**
+     * Cells properties indexed by their order and their k-form index.
+     * Their sizes are synced lazily from myCellProperties.
+     */
+    mutable IndexedPropertiesArray myIndexedProperties;
+
+    /**
+     * Lower bound of the Khalimsky coordinates of the dense cell indexes.
      */
-    Properties myCellProperties;
+    Point myDenseLowerBound;
+
+    /**
+     * Extent of the Khalimsky coordinates of the dense cell indexes.
+     */
+    Point myDenseExtent;
+
+    /**
+     * K-form index of each cell of the Khalimsky box
+     * [myDenseLowerBound, myDenseLowerBound+myDenseExtent), -1 if
+     * the cell is not in the calculus. Empty when cells are too
+     * sparse in their bounding box.
+     */
+    std::vector<Index> myDenseIndexes;
 
     /**
      * Cells indexed by their order.
@@ -571,13 +614,24 @@ namespace DGtal
     /**
      * Cached flat and sharp operators generation flag.
      */
-    bool myCachedOperatorsNeedUpdate;
+    mutable bool myCachedOperatorsNeedUpdate;
 
     /**
      * Indexes generation flag.
      */
     bool myIndexesNeedUpdate;
 
+    /**
+     * Cells properties map generation flag (from indexed properties).
+     */
+    mutable bool myPropertiesNeedUpdate;
+
+    /**
+     * Indexed properties sizes generation flag (from cells properties
+     * map, which may be modified through iterators).
+     */
+    mutable bool mySizesNeedUpdate;
+
 
     // ------------------------- Hidden services ------------------------------
   protected:
@@ -591,6 +645,80 @@ namespace DGtal
     void
     updateCachedOperators();
 
+    /**
+     * Build cells properties map from indexed properties, if needed.
+     */
+    void
+    updateProperties() const;
+
+    /**
+     * Update primal and dual sizes of indexed properties from cells
+     * properties map, if needed.
+     */
+    void
+    updateSizes() const;
+
+    /**
+     * Build dense cell indexes if cells fill most of their bounding box.
+     */
+    void
+    updateDenseIndexes();
+
+    /**
+     * Get k-form index from cell, without checking the cell dimension.
+     * @param cell Khalimsky cell.
+     * @return associated k-form index or -1 if cell is not in calculus.
+     */
+    Index
+    findCellIndex(const Cell& cell) const;
+
+    /**
+     * Build sparse matrix row by row, in parallel.
+     * @tparam TRowFunctor type of functor (row, columns, values) ->
+     * number of coefficients of the row, that fills the columns and
+     * values of the coefficients of a row.
+     * @param rows number of rows.
+     * @param cols number of columns.
+     * @param max_row_size maximal number of coefficients in a row.
+     * @param row_functor functor filling a row.
+     * @return sparse matrix.
+     */
+    template <typename TRowFunctor>
+    static SparseMatrix
+    buildSparseMatrix(const Index rows, const Index cols, const Index max_row_size, const TRowFunctor& row_functor);
+
+    /**
+     * Build one sparse matrix per direction row by row, in parallel,
+     * so that each row is visited once for all directions.
+     * @tparam TRowFunctor type of functor (row, columns, values, sizes)
+     * that fills, for each direction, the columns and values of the
+     * coefficients of a row at offset direction*max_row_size, and
+     * their number in sizes[direction] (initially 0).
+     * @param rows number of rows.
+     * @param cols number of columns.
+     * @param max_row_size maximal number of coefficients in a row of one direction.
+     * @param row_functor functor filling a row in all directions.
+     * @return sparse matrix of each direction.
+     */
+    template <typename TRowFunctor>
+    static boost::array<SparseMatrix, dimAmbient>
+    buildDirectionalSparseMatrixes(const Index rows, const Index cols, const Index max_row_size, const TRowFunctor& row_functor);
+
+    /**
+     * Compress filled rows into a sparse matrix.
+     * @param rows number of rows.
+     * @param cols number of columns.
+     * @param row_stride distance between two consecutive rows in row_indexes and row_values.
+     * @param size_stride distance between two consecutive rows in row_sizes.
+     * @param row_sizes number of coefficients of each row.
+     * @param row_indexes columns of the coefficients of each row.
+     * @param row_values values of the coefficients of each row.
+     * @return sparse matrix.
+     */
+    static SparseMatrix
+    compressSparseRows(const Index rows, const Index cols, const Index row_stride, const Index size_stride,
+            const Index* row_sizes, const Index* row_indexes, const Scalar* row_values);
+
     /**
      * Update flat operator cache.
      * @tparam duality duality of updated flat operator.
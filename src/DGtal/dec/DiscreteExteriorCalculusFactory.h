@@ -178,6 +178,25 @@ protected:
     void
     accumulateAllLowerIncidentCells(const KSpace& kspace, const typename CellsAccum::key_type& cell, CellsAccum& cells_accum, CellsAccum& local_accum, MeasureAccum& cell_to_measure, const double measure);
 
+    /**
+     * Fill DEC structure from signed n-cells when they fill most of
+     * their bounding box (e.g. all the spels of a rectangular domain).
+     * Cells are then counted in dense arrays indexed by their
+     * Khalimsky coordinates instead of maps, and the structure is
+     * directly built with dense indexes. Same result as the generic
+     * algorithm of createFromNSCells, up to the ordering of indexes.
+     * Internal use only.
+     * @tparam Calculus DEC structure type.
+     * @param calculus empty DEC structure to be filled.
+     * @param ncells signed n-cells.
+     * @param add_border add border to the computed structure.
+     * @return 'true' if the structure was filled, 'false' if n-cells are too sparse.
+     */
+    template <typename Calculus>
+    static
+    bool
+    fillDenseCalculus(Calculus& calculus, const std::vector<typename Calculus::SCell>& ncells, const bool add_border);
+
 private:
 
     /**
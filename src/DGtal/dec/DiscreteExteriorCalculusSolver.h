@@ -51,6 +51,22 @@
 namespace DGtal
 {
 
+  namespace detail
+  {
+    /// Gives the calculus and the k-forms of the unknowns to a linear
+    /// algebra solver, for the solvers that exploit the cell structure
+    /// of the calculus (e.g. GeometricMultigridSolver). Does nothing
+    /// by default.
+    template <typename TLinearAlgebraSolver>
+    struct LinearAlgebraSolverSetUp
+    {
+      template <typename TCalculus>
+      static void setUp(TLinearAlgebraSolver&, const TCalculus&, const Order, const Duality)
+      {
+      }
+    };
+  } // namespace detail
+
   /////////////////////////////////////////////////////////////////////////////
   // template class DiscreteExteriorCalculusSolver
   /**
@@ -119,6 +135,19 @@ namespace DGtal
      */
     SolutionKForm solve(const InputKForm& input_kform) const;
 
+    /**
+     * Solve prefactorized / set problem input, starting from an
+     * initial guess, e.g. the solution of a previous close problem.
+     * The guess is used only by the iterative linear algebra solvers
+     * (the ones with a solveWithGuess method, like
+     * EigenLinearAlgebraBackend::SolverConjugateGradient or
+     * GeometricMultigridSolver), otherwise this is the same as solve.
+     * @param input_kform input k-form.
+     * @param guess_kform initial guess of the solution.
+     * @return problem solution.
+     */
+    SolutionKForm solveWithGuess(const InputKForm& input_kform, const SolutionKForm& guess_kform) const;
+
     /**
      * Checks the validity/consistency of the object.
      * @return 'true' if the object is valid, 'false' otherwise.
@@ -134,6 +163,18 @@ namespace DGtal
     // ------------------------- Internals ------------------------------------
   private:
 
+    /// Solves with the solveWithGuess method of the linear algebra solver.
+    template <typename TSolver>
+    static auto solveWithGuess(const TSolver& solver, const InputKForm& input_kform,
+                               const SolutionKForm& guess_kform, int)
+      -> decltype(solver.solveWithGuess(input_kform.myContainer, guess_kform.myContainer));
+
+    /// Solves without guess, for the solvers without solveWithGuess method.
+    template <typename TSolver>
+    static auto solveWithGuess(const TSolver& solver, const InputKForm& input_kform,
+                               const SolutionKForm& guess_kform, long)
+      -> decltype(solver.solve(input_kform.myContainer));
+
   }; // end of class DiscreteExteriorCalculusSolver
 
 
@@ -41,6 +41,7 @@
 //////////////////////////////////////////////////////////////////////////////
 // Inclusions
 #include <iostream>
+#include <vector>
 #include "DGtal/base/Common.h"
 #include "DGtal/base/ConstAlias.h"
 #include "DGtal/math/linalg/DirichletConditions.h"
@@ -56,6 +57,13 @@ namespace DGtal
    *
    * see @ref moduleGeodesicsInHeat for details and examples.
    *
+   * Distances from many independent source sets can be computed at
+   * once (see compute(const std::vector< std::vector< Vertex > >&)):
+   * heat diffusions and Poisson problems are then solved for all
+   * sets with a single traversal of each factorization, and the per
+   * face normalized gradient and divergence steps are parallelized
+   * with OpenMP.
+   *
    * @tparam a model of PolygonalCalculus.
    */
   template <typename TPolygonalCalculus>
@@ -70,6 +78,7 @@ namespace DGtal
     typedef typename PolygonalCalculus::Solver Solver;
     typedef typename PolygonalCalculus::Vector Vector;
     typedef typename PolygonalCalculus::Vertex Vertex;
+    typedef typename PolygonalCalculus::Face Face;
     typedef typename PolygonalCalculus::LinAlg LinAlgBackend;
     typedef DirichletConditions< LinAlgBackend > Conditions;
     typedef typename Conditions::IntegerVector IntegerVector;
@@ -153,6 +162,12 @@ namespace DGtal
       //Prefactorizing
       myPoissonSolver.compute( laplacian );
       myHeatSolver.compute   ( myHeatOpe );
+
+      //Per face operators of the normalized gradient and divergence steps
+      myGradients   = myCalculus->getOperatorCacheMatrix( [&]( const Face f )
+                      { return DenseMatrix( -myCalculus->gradient( f ) ); } );
+      myDivergences = myCalculus->getOperatorCacheMatrix( [&]( const Face f )
+                      { return DenseMatrix( myCalculus->divergence( f ) * myCalculus->flat( f ) ); } );
       
       //empty source
       mySource    = Vector::Zero(myCalculus->nbVertices());
@@ -209,61 +224,46 @@ namespace DGtal
     Vector compute() const
     {
       FATAL_ERROR_MSG(myIsInit, "init() method must be called first");
-      //Heat diffusion
-      Vector heatDiffusion = myHeatSolver.solve(mySource);
-      ASSERT(myHeatSolver.info()==Eigen::Success);
-
-      // Take care of boundaries
-      if ( myManageBoundary )
-        {
-          Vector bValues  = Vector::Zero( myCalculus->nbVertices() );
-          Vector bSources = Conditions::dirichletVector( myHeatOpe, mySource,
-                                                         myBoundary, bValues );
-          Vector bSol     = myHeatDirichletSolver.solve( bSources );
-          Vector heatDiffusionDirichlet
-                          = Conditions::dirichletSolution( bSol, myBoundary, bValues );
-          heatDiffusion = 0.5 * ( heatDiffusion + heatDiffusionDirichlet );
-        }
-      Vector divergence    = Vector::Zero(myCalculus->nbVertices());
-      auto cpt=0;
-      auto surfmesh = myCalculus->getSurfaceMeshPtr();
-      
-      // Heat, normalization and divergence per face
-      for(typename PolygonalCalculus::MySurfaceMesh::Index f=0; f< myCalculus->nbFaces(); ++f)
-        {
-          Vector faceHeat( myCalculus->degree(f));
-          cpt=0;
-          auto vertices = surfmesh->incidentVertices(f);
-          for(auto v: vertices)
-            {
-              faceHeat(cpt) = heatDiffusion( v );
-              ++cpt;
-            }
-          // ∇heat / ∣∣∇heat∣∣
-          Vector grad = -myCalculus->gradient(f) * faceHeat;
-          grad.normalize();
-      
-          // div
-          DenseMatrix   oneForm = myCalculus->flat(f)*grad;
-          Vector divergenceFace = myCalculus->divergence( f ) * oneForm;
-          cpt=0;
-          for(auto v: vertices)
-            {
-              divergence(v) += divergenceFace(cpt);
-              ++cpt;
-            }
-        }
-      
-      // Last Poisson solve
-      Vector distVec = myPoissonSolver.solve(divergence);
-      ASSERT(myPoissonSolver.info()==Eigen::Success);
+      Vector distVec = distances( mySource ).col( 0 );
 
       //Source val
       auto sourceval = distVec(myLastSourceIndex);
       //shifting the distances to get 0 at sources
       return distVec - sourceval*Vector::Ones(myCalculus->nbVertices());
     }
-    
+
+    /// Computes the geodesic distances from several independent sets
+    /// of sources at once. The prefactorized heat and Poisson
+    /// solvers are applied to all the sets together (see
+    /// EigenLinearAlgebraBackend::solveMultiple), which is much
+    /// faster than calling compute() for each set when there are
+    /// many sets (e.g. distances to many landmarks).
+    ///
+    /// @param sources a range of non-empty source sets.
+    ///
+    /// @returns a matrix with one column per source set, the column
+    /// @a i being the estimated geodesic distances from the sources
+    /// @a sources[i], shifted to be 0 at the last vertex of this set
+    /// (as compute() does with the last added source).
+    DenseMatrix compute( const std::vector< std::vector< Vertex > >& sources ) const
+    {
+      FATAL_ERROR_MSG(myIsInit, "init() method must be called first");
+      DenseMatrix diracs = DenseMatrix::Zero( myCalculus->nbVertices(), sources.size() );
+      for ( std::size_t i = 0; i < sources.size(); ++i )
+        {
+          ASSERT_MSG( ! sources[ i ].empty(), "Each source set must contain at least one vertex" );
+          for ( auto v : sources[ i ] )
+            {
+              ASSERT_MSG(v < myCalculus->nbVertices(), "Vertex is not in the surface mesh vertex range");
+              diracs( v, i ) = 1.0;
+            }
+        }
+      DenseMatrix dist = distances( diracs );
+      //shifting the distances to get 0 at the last source of each set
+      for ( std::size_t i = 0; i < sources.size(); ++i )
+        dist.col( i ).array() -= dist( sources[ i ].back(), i );
+      return dist;
+    }
     
     /// @return true if the calculus is valid.
     bool isValid() const
@@ -274,6 +274,83 @@ namespace DGtal
     // ----------------------- Private --------------------------------------
 
   private:
+
+    /// Computes the (unshifted) geodesic distances from the sources
+    /// given by each column of @a diracs. The normalized gradients of
+    /// the diffused heat are computed face by face, then the
+    /// divergences are gathered vertex by vertex, both in parallel,
+    /// and for a block of columns at a time to limit the memory used.
+    ///
+    /// @param diracs a nbVertices x m matrix, whose columns are the
+    /// characteristic vectors of the source sets.
+    /// @returns a nbVertices x m matrix of distances.
+    DenseMatrix distances( const DenseMatrix& diracs ) const
+    {
+      const long nv = (long) myCalculus->nbVertices();
+      const long nf = (long) myCalculus->nbFaces();
+      const long m  = (long) diracs.cols();
+      //Heat diffusion
+      DenseMatrix heatDiffusion = LinAlgBackend::solveMultiple( myHeatSolver, diracs );
+      ASSERT(myHeatSolver.info()==Eigen::Success);
+
+      // Take care of boundaries
+      if ( myManageBoundary )
+        {
+          Vector bValues  = Vector::Zero( nv );
+          DenseMatrix bSources( ( myBoundary.array() == 0 ).count(), m );
+          for ( long i = 0; i < m; ++i )
+            bSources.col( i ) = Conditions::dirichletVector( myHeatOpe, Vector( diracs.col( i ) ),
+                                                             myBoundary, bValues );
+          DenseMatrix bSol = LinAlgBackend::solveMultiple( myHeatDirichletSolver, bSources );
+          for ( long i = 0; i < m; ++i )
+            {
+              Vector heatDiffusionDirichlet
+                = Conditions::dirichletSolution( Vector( bSol.col( i ) ), myBoundary, bValues );
+              heatDiffusion.col( i ) = 0.5 * ( heatDiffusion.col( i ) + heatDiffusionDirichlet );
+            }
+        }
+      DenseMatrix divergence = DenseMatrix::Zero( nv, m );
+      auto surfmesh = myCalculus->getSurfaceMeshPtr();
+      const long w = 16;
+      DenseMatrix grads( 3 * nf, std::min( w, m ) );
+      for ( long c = 0; c < m; c += w )
+        {
+          const long nc = std::min( w, m - c );
+          // ∇heat / ∣∣∇heat∣∣ per face
+#ifdef WITH_OPENMP
+#pragma omp parallel for schedule(dynamic, 256)
+#endif
+          for ( long f = 0; f < nf; ++f )
+            {
+              const auto& vertices = surfmesh->incidentVertices( f );
+              DenseMatrix faceHeat( vertices.size(), nc );
+              for ( std::size_t j = 0; j < vertices.size(); ++j )
+                faceHeat.row( j ) = heatDiffusion.row( vertices[ j ] ).segment( c, nc );
+              DenseMatrix grad = myGradients[ f ] * faceHeat;
+              for ( long k = 0; k < nc; ++k )
+                grad.col( k ).normalize();
+              grads.block( 3 * f, 0, 3, nc ) = grad;
+            }
+          // div, gathered at each vertex from its incident faces
+#ifdef WITH_OPENMP
+#pragma omp parallel for schedule(dynamic, 256)
+#endif
+          for ( long v = 0; v < nv; ++v )
+            for ( auto f : surfmesh->incidentFaces( v ) )
+              {
+                const auto& vertices = surfmesh->incidentVertices( f );
+                for ( std::size_t j = 0; j < vertices.size(); ++j )
+                  if ( (long) vertices[ j ] == v )
+                    divergence.row( v ).segment( c, nc ) +=
+                      myDivergences[ f ].row( j ) * grads.block( 3 * f, 0, 3, nc );
+              }
+        }
+      
+      // Last Poisson solve
+      DenseMatrix distVec = LinAlgBackend::solveMultiple( myPoissonSolver, divergence );
+      ASSERT(myPoissonSolver.info()==Eigen::Success);
+      return distVec;
+    }
     
     ///The underlying PolygonalCalculus instance
     const PolygonalCalculus *myCalculus;
@@ -287,6 +364,12 @@ namespace DGtal
     ///Heat solver
     Solver myHeatSolver;
 
+    ///Per face operators (opposite of the gradient)
+    std::vector< DenseMatrix > myGradients;
+
+    ///Per face operators (divergence of the flat)
+    std::vector< DenseMatrix > myDivergences;
+
     ///Source vector
     Vector mySource;
 
@@ -0,0 +1,333 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file GeometricMultigridSolver.h
+ *
+ * @date 2026/10/18
+ *
+ * Header file for module GeometricMultigridSolver.ih
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(GeometricMultigridSolver_RECURSES)
+#error Recursive header files inclusion detected in GeometricMultigridSolver.h
+#else // defined(GeometricMultigridSolver_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define GeometricMultigridSolver_RECURSES
+
+#if !defined GeometricMultigridSolver_h
+/** Prevents repeated inclusion of headers. */
+#define GeometricMultigridSolver_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <vector>
+#include "DGtal/base/Common.h"
+#include "DGtal/kernel/PointHashFunctions.h"
+#include "DGtal/dec/Duality.h"
+#include "DGtal/dec/DiscreteExteriorCalculusSolver.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class GeometricMultigridSolver
+  /**
+   * Description of template class 'GeometricMultigridSolver' <p>
+   * \brief Aim:
+   * An iterative linear algebra solver for symmetric positive
+   * definite problems on the k-forms of a discrete exterior calculus,
+   * i.e. a conjugate gradient preconditioned by a multigrid V-cycle
+   * built from the regular Khalimsky grid of the calculus.
+   *
+   * The unknowns are the cells of a given order and duality of the
+   * calculus (see setUp). Cells of the same type form a lattice of
+   * step 2 in Khalimsky coordinates. The coarse cells are the ones on
+   * the sublattice of step 4, and each other cell is interpolated
+   * from its present coarse neighbors (multilinear interpolation,
+   * taking orientations into account). Coarse operators are the
+   * Galerkin products \f$ P^T A P \f$, so that any symmetric positive
+   * definite operator (e.g. weighted laplacians of ATSolver2D) can be
+   * solved. Levels are built until the problem is small enough, and
+   * the coarsest one is solved with a sparse direct solver. Smoothing
+   * is done with symmetric Gauss-Seidel sweeps.
+   *
+   * Contrary to direct solvers, the memory used is linear in the
+   * number of unknowns, which makes it suitable for large 3D
+   * domains. Its solveWithGuess method allows to warm-start the
+   * solver from a previous solution.
+   *
+   * It is a model of CLinearAlgebraSolver. When used within a
+   * DiscreteExteriorCalculusSolver, the calculus and the k-forms of
+   * the unknowns are given automatically. Otherwise, without a call
+   * to setUp, there is only one level, which is solved directly.
+   *
+   * @code
+   * typedef GeometricMultigridSolver<Calculus> LinearAlgebraSolver;
+   * typedef DiscreteExteriorCalculusSolver<Calculus, LinearAlgebraSolver, 0, PRIMAL, 0, PRIMAL> Solver;
+   * Solver solver;
+   * solver.myLinearAlgebraSolver.setTolerance( 1e-6 );
+   * solver.compute( laplace );
+   * Calculus::PrimalForm0 x = solver.solve( y );
+   * @endcode
+   *
+   * @tparam TCalculus should be DiscreteExteriorCalculus (with the
+   * EigenLinearAlgebraBackend).
+   */
+  template <typename TCalculus>
+  class GeometricMultigridSolver
+  {
+    // ----------------------- Standard services ------------------------------
+  public:
+
+    typedef TCalculus Calculus;
+    typedef typename Calculus::LinearAlgebraBackend LinearAlgebraBackend;
+    typedef typename Calculus::Index Index;
+    typedef typename Calculus::Scalar Scalar;
+    typedef typename Calculus::SCell SCell;
+    typedef typename Calculus::KSpace KSpace;
+    typedef typename KSpace::Point Point;
+    typedef typename LinearAlgebraBackend::DenseVector DenseVector;
+    typedef typename LinearAlgebraBackend::SparseMatrix SparseMatrix;
+    typedef typename LinearAlgebraBackend::SolverSimplicialLDLT CoarseSolver;
+
+    /**
+     * Constructor.
+     */
+    GeometricMultigridSolver();
+
+    // ----------------------- Interface --------------------------------------
+  public:
+
+    /**
+     * Sets the geometry of the unknowns, i.e. the cells of the k-forms
+     * of order @a order and duality @a duality of @a calculus. Must be
+     * called before compute to build more than one level.
+     *
+     * @param calculus the discrete exterior calculus.
+     * @param order the order of the k-forms of the unknowns.
+     * @param duality the duality of the k-forms of the unknowns.
+     */
+    void setUp(const Calculus& calculus, const Order order, const Duality duality);
+
+    /**
+     * Builds the multigrid hierarchy of a symmetric positive definite
+     * operator and factorizes its coarsest level.
+     * @param A the operator.
+     * @return *this.
+     */
+    GeometricMultigridSolver& compute(const SparseMatrix& A);
+
+    /**
+     * Solves the problem with a zero initial guess.
+     * @param b the input vector.
+     * @return the solution.
+     */
+    DenseVector solve(const DenseVector& b) const;
+
+    /**
+     * Solves the problem starting from an initial guess (e.g. the
+     * solution of a close problem).
+     * @param b the input vector.
+     * @param x0 the initial guess.
+     * @return the solution.
+     */
+    DenseVector solveWithGuess(const DenseVector& b, const DenseVector& x0) const;
+
+    /**
+     * @return Eigen::Success if the last computation was successful,
+     * Eigen::NoConvergence if the last solve did not reach the
+     * tolerance, Eigen::NumericalIssue if the coarsest level could not
+     * be factorized.
+     */
+    Eigen::ComputationInfo info() const;
+
+    /**
+     * Sets the tolerance on the relative residual \f$ |b - A x| / |b| \f$.
+     * @param tolerance the tolerance (default 1e-8).
+     * @return *this.
+     */
+    GeometricMultigridSolver& setTolerance(const double tolerance);
+
+    /**
+     * Sets the maximal number of conjugate gradient iterations.
+     * @param max_iterations the maximal number of iterations (default 500).
+     * @return *this.
+     */
+    GeometricMultigridSolver& setMaxIterations(const Index max_iterations);
+
+    /**
+     * Sets the size under which a level is solved directly.
+     * @param size the size of the coarsest level (default 1000).
+     * @return *this.
+     */
+    GeometricMultigridSolver& setCoarsestSize(const Index size);
+
+    /**
+     * Sets the number of Gauss-Seidel sweeps before and after each
+     * coarse correction.
+     * @param nb the number of sweeps (default 2).
+     * @return *this.
+     */
+    GeometricMultigridSolver& setNbSmoothingSteps(const unsigned int nb);
+
+    /// @return the tolerance on the relative residual.
+    double tolerance() const;
+
+    /// @return the maximal number of iterations.
+    Index maxIterations() const;
+
+    /// @return the number of iterations of the last solve.
+    Index iterations() const;
+
+    /// @return the relative residual at the end of the last solve.
+    double error() const;
+
+    /// @return the number of levels of the multigrid hierarchy.
+    Dimension nbLevels() const;
+
+    /**
+     * Writes/Displays the object on an output stream.
+     * @param out the output stream where the object is written.
+     */
+    void selfDisplay(std::ostream& out) const;
+
+    /**
+     * Checks the validity/consistency of the object.
+     * @return 'true' if the object is valid, 'false' otherwise.
+     */
+    bool isValid() const;
+
+    // ------------------------- Private Datas --------------------------------
+  private:
+
+    /// One level of the hierarchy.
+    struct Level
+    {
+      /// The operator at this level.
+      SparseMatrix A;
+      /// The prolongation from the next (coarser) level to this one.
+      SparseMatrix P;
+    };
+
+    /// The Khalimsky coordinates of the cells of the unknowns.
+    std::vector<Point> myCoordinates;
+    /// The orientations (+1 or -1) of the cells of the unknowns.
+    std::vector<Scalar> mySigns;
+    /// The levels, from the finest to the coarsest.
+    std::vector<Level> myLevels;
+    /// The direct solver of the coarsest level.
+    CoarseSolver myCoarseSolver;
+    /// The tolerance on the relative residual.
+    double myTolerance;
+    /// The maximal number of iterations.
+    Index myMaxIterations;
+    /// The size under which a level is solved directly.
+    Index myCoarsestSize;
+    /// The number of smoothing sweeps.
+    unsigned int myNbSmoothingSteps;
+    /// The number of iterations of the last solve.
+    mutable Index myIterations;
+    /// The relative residual at the end of the last solve.
+    mutable double myError;
+    /// The status of the last computation.
+    mutable Eigen::ComputationInfo myInfo;
+
+    // ------------------------- Internals ------------------------------------
+  private:
+
+    /**
+     * Builds the prolongation from the coarse cells of a level.
+     * @param[in,out] coords the Khalimsky coordinates of the cells of
+     * the level, replaced by the ones of the coarse level.
+     * @param[in,out] signs the orientations of the cells of the level,
+     * replaced by the ones of the coarse level.
+     * @param[in,out] orphans for each cell, 1 if it is not on the
+     * lattice of its type (it has then no neighbor), replaced by the
+     * ones of the coarse level.
+     * @return the prolongation matrix.
+     */
+    static SparseMatrix prolongation(std::vector<Point>& coords,
+                                     std::vector<Scalar>& signs,
+                                     std::vector<char>& orphans);
+
+    /**
+     * Gauss-Seidel sweep on a symmetric matrix.
+     * @param A the (symmetric) operator.
+     * @param b the input vector.
+     * @param[in,out] x the current solution.
+     * @param forward when 'true' the unknowns are visited in
+     * increasing order, otherwise in decreasing order.
+     */
+    static void gaussSeidel(const SparseMatrix& A, const DenseVector& b,
+                            DenseVector& x, const bool forward);
+
+    /**
+     * Applies a V-cycle from a level.
+     * @param level the level.
+     * @param b the input vector at this level.
+     * @return the approximate solution.
+     */
+    DenseVector vCycle(const std::size_t level, const DenseVector& b) const;
+
+  }; // end of class GeometricMultigridSolver
+
+  namespace detail
+  {
+    /// Gives the geometry of the unknowns to a GeometricMultigridSolver
+    /// used within a DiscreteExteriorCalculusSolver.
+    template <typename TCalculus>
+    struct LinearAlgebraSolverSetUp< GeometricMultigridSolver<TCalculus> >
+    {
+      static void setUp(GeometricMultigridSolver<TCalculus>& solver,
+                        const TCalculus& calculus,
+                        const Order order, const Duality duality)
+      {
+        solver.setUp(calculus, order, duality);
+      }
+    };
+  } // namespace detail
+
+  /**
+   * Overloads 'operator<<' for displaying objects of class 'GeometricMultigridSolver'.
+   * @param out the output stream where the object is written.
+   * @param object the object of class 'GeometricMultigridSolver' to write.
+   * @return the output stream after the writing.
+   */
+  template <typename TCalculus>
+  std::ostream&
+  operator<<(std::ostream& out, const GeometricMultigridSolver<TCalculus>& object);
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/dec/GeometricMultigridSolver.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined GeometricMultigridSolver_h
+
+#undef GeometricMultigridSolver_RECURSES
+#endif // else defined(GeometricMultigridSolver_RECURSES)
@@ -35,6 +35,8 @@
 #include <string>
 #include <map>
 #include <unordered_map>
+#include <array>
+#include <algorithm>
 #include "DGtal/base/ConstAlias.h"
 #include "DGtal/base/Common.h"
 #include "DGtal/shapes/SurfaceMesh.h"
@@ -780,7 +782,8 @@ public:
   }
   
   /// Computes the global Laplace-Beltrami operator by assembling the
-  /// per face operators.
+  /// per face operators (computed in parallel when OpenMP is
+  /// available, see assembleGlobalOperator).
   ///
   /// @param lambda the regularization parameter for the local Laplace-Beltrami operators
   /// @return a sparse nbVertices x nbVertices matrix
@@ -796,24 +799,7 @@ public:
   /// \rangle \f$. See also https://en.wikipedia.org/wiki/Laplace–Beltrami_operator
   SparseMatrix globalLaplaceBeltrami(const double lambda=1.0) const
   {
-    SparseMatrix lapGlobal(mySurfaceMesh->nbVertices(), mySurfaceMesh->nbVertices());
-    std::vector<Triplet> triplets;
-    for( typename MySurfaceMesh::Index f = 0; f < mySurfaceMesh->nbFaces(); ++f )
-    {
-      auto nf = myFaceDegree[f];
-      DenseMatrix Lap = this->laplaceBeltrami(f,lambda);
-      const auto vertices = mySurfaceMesh->incidentVertices(f);
-      for(auto i=0u; i < nf; ++i)
-        for(auto j=0u; j < nf; ++j)
-        {
-          auto v = Lap(i,j);
-          if (v!= 0.0)
-            triplets.emplace_back( Triplet( (SparseMatrix::StorageIndex)vertices[ i ], (SparseMatrix::StorageIndex)vertices[ j ],
-                                            Lap( i, j ) ) );
-        }
-    }
-    lapGlobal.setFromTriplets(triplets.begin(), triplets.end());
-    return lapGlobal;
+    return assembleGlobalOperator( [&](const Face f){ return laplaceBeltrami(f,lambda); }, 1 );
   }
   
   /// Compute and returns the global lumped mass matrix
@@ -823,18 +809,7 @@ public:
   /// @return the global lumped mass matrix.
   SparseMatrix globalLumpedMassMatrix() const
   {
-    SparseMatrix M(mySurfaceMesh->nbVertices(), mySurfaceMesh->nbVertices());
-    std::vector<Triplet> triplets;
-    for ( typename MySurfaceMesh::Index v = 0; v < mySurfaceMesh->nbVertices(); ++v )
-      {
-        auto faces = mySurfaceMesh->incidentFaces(v);
-        auto varea = 0.0;
-        for(auto f: faces)
-          varea += faceArea(f) /(double)myFaceDegree[f];
-        triplets.emplace_back(Triplet(v,v,varea));
-      }
-    M.setFromTriplets(triplets.begin(),triplets.end());
-    return M;
+    return diagonalMatrix( lumpedVertexAreas(), 1 );
   }
 
   /// Compute and returns the inverse of the global lumped mass matrix
@@ -869,28 +844,7 @@ public:
   /// https://en.wikipedia.org/wiki/Laplace–Beltrami_operator
   SparseMatrix globalConnectionLaplace(const double lambda = 1.0) const
   {
-    auto nv = mySurfaceMesh->nbVertices();
-    SparseMatrix lapGlobal(2 * nv, 2 * nv);
-    SparseMatrix local(2 * nv, 2 * nv);
-    std::vector<Triplet> triplets;
-    for (typename MySurfaceMesh::Index f = 0; f < mySurfaceMesh->nbFaces(); f++)
-    {
-      auto nf             = degree(f);
-      DenseMatrix Lap     = connectionLaplacian(f,lambda);
-      const auto vertices = mySurfaceMesh->incidentVertices(f);
-      for (auto i = 0u; i < nf; ++i)
-        for (auto j = 0u; j < nf; ++j)
-          for (short k1 = 0; k1 < 2; k1++)
-            for (short k2 = 0; k2 < 2; k2++)
-            {
-              auto v = Lap(2 * i + k1, 2 * j + k2);
-              if (v != 0.0)
-                triplets.emplace_back(Triplet(2 * vertices[i] + k1,
-                                                2 * vertices[j] + k2, v));
-            }
-    }
-    lapGlobal.setFromTriplets(triplets.begin(), triplets.end());
-    return lapGlobal;
+    return assembleGlobalOperator( [&](const Face f){ return connectionLaplacian(f,lambda); }, 2 );
   }
 
   /// Compute and returns the global lumped mass matrix tensorized with Id_2
@@ -901,20 +855,7 @@ public:
   /// @return the global lumped mass matrix.
   SparseMatrix doubledGlobalLumpedMassMatrix() const
   {
-    auto nv = mySurfaceMesh->nbVertices();
-    SparseMatrix M(2 * nv, 2 * nv);
-    std::vector<Triplet> triplets;
-    for (typename MySurfaceMesh::Index v = 0; v < mySurfaceMesh->nbVertices(); ++v)
-    {
-      auto faces = mySurfaceMesh->incidentFaces(v);
-      auto varea = 0.0;
-      for (auto f : faces)
-        varea += faceArea(f) / (double)myFaceDegree[f];
-      triplets.emplace_back(Triplet(2 * v, 2 * v, varea));
-      triplets.emplace_back(Triplet(2 * v + 1, 2 * v + 1, varea));
-    }
-    M.setFromTriplets(triplets.begin(), triplets.end());
-    return M;
+    return diagonalMatrix( lumpedVertexAreas(), 2 );
   }
   /// @}
   
@@ -940,9 +881,12 @@ public:
   /// @return an indexed container of all DenseMatrix operators (indexed per Face).
   std::vector<DenseMatrix> getOperatorCacheMatrix(const std::function<DenseMatrix(Face)> &perFaceOperator) const
   {
-    std::vector<DenseMatrix> cache;
-    for( typename MySurfaceMesh::Index f=0; f < mySurfaceMesh->nbFaces(); ++f)
-      cache.push_back(perFaceOperator(f));
+    std::vector<DenseMatrix> cache(mySurfaceMesh->nbFaces());
+#ifdef WITH_OPENMP
+#pragma omp parallel for schedule(dynamic, 256)
+#endif
+    for( long f = 0; f < (long) cache.size(); ++f) //MSVC requires signed type for openmp
+      cache[f] = perFaceOperator(f);
     return cache;
   }
   
@@ -964,9 +908,12 @@ public:
   /// @return an indexed container of all Vector quantities (indexed per Face).
   std::vector<Vector> getOperatorCacheVector(const std::function<Vector(Face)> &perFaceVectorOperator) const
   {
-    std::vector<Vector> cache;
-    for( typename MySurfaceMesh::Index f=0; f < mySurfaceMesh->nbFaces(); ++f)
-      cache.push_back(perFaceVectorOperator(f));
+    std::vector<Vector> cache(mySurfaceMesh->nbFaces());
+#ifdef WITH_OPENMP
+#pragma omp parallel for schedule(dynamic, 256)
+#endif
+    for( long f = 0; f < (long) cache.size(); ++f) //MSVC requires signed type for openmp
+      cache[f] = perFaceVectorOperator(f);
     return cache;
   }
 
@@ -975,14 +922,15 @@ public:
   void enableInternalGlobalCache()
   {
     myGlobalCacheEnabled = true;
+    resetGlobalCache();
   }
   
   /// Disable the internal global cache for operators.
-  /// This method will also clean up the
+  /// This method will also clean up the cached operators.
   void disableInternalGlobalCache()
   {
     myGlobalCacheEnabled = false;
-    myGlobalCache.clear();
+    resetGlobalCache();
   }
 
   /// @}
@@ -997,6 +945,7 @@ public:
   void init()
   {
     updateFaceDegree();
+    resetGlobalCache();
   }
   
   /// Helper to retrieve the degree of the face from the cache.
@@ -1085,10 +1034,8 @@ protected:
   /// @returns true if the operator "key" for the face f has been computed.
   bool checkCache(OPERATOR key, const Face f) const
   {
-    if (myGlobalCacheEnabled)
-      if (myGlobalCache[key].find(f) != myGlobalCache[key].end())
-        return true;
-    return false;
+    return myGlobalCacheEnabled && ( f < myGlobalCache[key].size() )
+      && ( myGlobalCache[key][f].size() != 0 );
   }
 
   /// Set an operator in the internal cache.
@@ -1101,6 +1048,178 @@ protected:
     if (myGlobalCacheEnabled)
       myGlobalCache[key][f]  = ope;
   }
+
+  /// Clears the internal cache, and allocates one (empty) operator
+  /// per face and per operator name if the cache is enabled. Since
+  /// the cache is never resized afterwards, operators of distinct
+  /// faces may be computed concurrently.
+  void resetGlobalCache()
+  {
+    for (auto &cache : myGlobalCache)
+    {
+      cache.clear();
+      if (myGlobalCacheEnabled)
+        cache.resize(mySurfaceMesh->nbFaces());
+    }
+  }
+
+  /// Assembles a global operator from per face operators, each row
+  /// and column of a per face operator corresponding to one of the
+  /// @a k coefficients of an incident vertex of the face. The per
+  /// face operators are first computed (in parallel with OpenMP)
+  /// into a flat buffer. The compressed column storage of the
+  /// result is then built directly, column by column (in parallel),
+  /// by gathering the contributions of the faces incident to the
+  /// column vertex. Contributions are summed in increasing face
+  /// order, so the result is the same as the one of setFromTriplets,
+  /// without building and sorting a global array of triplets.
+  ///
+  /// @param localOperator the per face operator, a (k*nf)x(k*nf) matrix.
+  /// @param k the number of coefficients per vertex (1 for 0-forms,
+  /// 2 for tangent vector fields).
+  /// @return a sparse (k*nbVertices)x(k*nbVertices) matrix.
+  SparseMatrix assembleGlobalOperator(const std::function<DenseMatrix(Face)> &localOperator,
+                                      const Dimension k) const
+  {
+    typedef typename SparseMatrix::StorageIndex StorageIndex;
+    typedef std::pair<StorageIndex, double> Entry;
+    const long nf = (long) mySurfaceMesh->nbFaces();
+    const long n  = (long) ( k * mySurfaceMesh->nbVertices() );
+    // Per face operators, stored contiguously (column-major).
+    std::vector<std::size_t> offsets(nf + 1, 0);
+    for (long f = 0; f < nf; ++f)
+      offsets[f + 1] = offsets[f] + k * k * myFaceDegree[f] * myFaceDegree[f];
+    std::vector<double> values(offsets[nf]);
+#ifdef WITH_OPENMP
+#pragma omp parallel for schedule(dynamic, 256)
+#endif
+    for (long f = 0; f < nf; ++f) //MSVC requires signed type for openmp
+    {
+      const DenseMatrix L = localOperator(f);
+      ASSERT( (std::size_t) L.size() == offsets[f + 1] - offsets[f] );
+      std::copy(L.data(), L.data() + L.size(), values.begin() + offsets[f]);
+    }
+    // Gathers the non-zero contributions to column c, sorted by row
+    // then by face.
+    auto gather = [&](const long c, std::vector<Face> &faces,
+                      std::vector<Entry> &entries)
+    {
+      const Vertex v = c / k;
+      const long   a = c % k;
+      faces.assign(mySurfaceMesh->incidentFaces(v).begin(),
+                   mySurfaceMesh->incidentFaces(v).end());
+      std::sort(faces.begin(), faces.end());
+      entries.clear();
+      for (auto f : faces)
+      {
+        const auto  &vertices = mySurfaceMesh->incidentVertices(f);
+        const long   nk       = (long) ( k * vertices.size() );
+        const double *L       = values.data() + offsets[f];
+        for (long j = 0; j < (long) vertices.size(); ++j)
+          if (vertices[j] == v)
+            for (long i = 0; i < nk; ++i)
+            {
+              const double val = L[(k * j + a) * nk + i];
+              if (val != 0.0)
+                entries.emplace_back(StorageIndex(k * vertices[i / k] + i % k), val);
+            }
+      }
+      std::stable_sort(entries.begin(), entries.end(),
+                       [](const Entry &e1, const Entry &e2) { return e1.first < e2.first; });
+    };
+    SparseMatrix M(n, n);
+    std::vector<StorageIndex> outer(n + 1, 0);
+#ifdef WITH_OPENMP
+#pragma omp parallel
+#endif
+    {
+      std::vector<Face>  faces;
+      std::vector<Entry> entries;
+#ifdef WITH_OPENMP
+#pragma omp for schedule(dynamic, 256)
+#endif
+      for (long c = 0; c < n; ++c) //MSVC requires signed type for openmp
+      {
+        gather(c, faces, entries);
+        StorageIndex nb = 0;
+        for (std::size_t e = 0; e < entries.size(); ++e)
+          if (e == 0 || entries[e].first != entries[e - 1].first) ++nb;
+        outer[c + 1] = nb;
+      }
+    }
+    for (long c = 0; c < n; ++c)
+      outer[c + 1] += outer[c];
+    M.resizeNonZeros(outer[n]);
+    std::copy(outer.begin(), outer.end(), M.outerIndexPtr());
+#ifdef WITH_OPENMP
+#pragma omp parallel
+#endif
+    {
+      std::vector<Face>  faces;
+      std::vector<Entry> entries;
+#ifdef WITH_OPENMP
+#pragma omp for schedule(dynamic, 256)
+#endif
+      for (long c = 0; c < n; ++c) //MSVC requires signed type for openmp
+      {
+        gather(c, faces, entries);
+        StorageIndex p = outer[c] - 1;
+        for (std::size_t e = 0; e < entries.size(); ++e)
+        {
+          if (e == 0 || entries[e].first != entries[e - 1].first)
+          {
+            ++p;
+            M.innerIndexPtr()[p] = entries[e].first;
+            M.valuePtr()[p]      = 0.0;
+          }
+          M.valuePtr()[p] += entries[e].second;
+        }
+      }
+    }
+    return M;
+  }
+
+  /// @return for each vertex, the sum of the areas of its incident
+  /// faces divided by their degrees (computed in parallel with OpenMP).
+  std::vector<double> lumpedVertexAreas() const
+  {
+    const long nf = (long) mySurfaceMesh->nbFaces();
+    const long nv = (long) mySurfaceMesh->nbVertices();
+    std::vector<double> weights(nf);
+#ifdef WITH_OPENMP
+#pragma omp parallel for schedule(dynamic, 256)
+#endif
+    for (long f = 0; f < nf; ++f) //MSVC requires signed type for openmp
+      weights[f] = faceArea(f) / (double)myFaceDegree[f];
+    std::vector<double> areas(nv, 0.0);
+#ifdef WITH_OPENMP
+#pragma omp parallel for schedule(dynamic, 256)
+#endif
+    for (long v = 0; v < nv; ++v) //MSVC requires signed type for openmp
+      for (auto f : mySurfaceMesh->incidentFaces(v))
+        areas[v] += weights[f];
+    return areas;
+  }
+
+  /// @param diag the diagonal coefficients, one per vertex.
+  /// @param k the number of times each coefficient is repeated.
+  /// @return the sparse diagonal (k*diag.size())x(k*diag.size()) matrix.
+  static SparseMatrix diagonalMatrix(const std::vector<double> &diag,
+                                     const Dimension k)
+  {
+    typedef typename SparseMatrix::StorageIndex StorageIndex;
+    const StorageIndex n = (StorageIndex) ( k * diag.size() );
+    SparseMatrix M(n, n);
+    M.resizeNonZeros(n);
+    for (StorageIndex i = 0; i < n; ++i)
+    {
+      M.outerIndexPtr()[i] = i;
+      M.innerIndexPtr()[i] = i;
+      M.valuePtr()[i]      = diag[i / k];
+    }
+    M.outerIndexPtr()[n] = n;
+    return M;
+  }
   
   /// Project u on the orthgonal of n
   /// \param u vector to project
@@ -1228,9 +1347,10 @@ private:
   ///Cache containing the face degree
   std::vector<size_t> myFaceDegree;
     
-  ///Global cache
+  ///Global cache: for each operator, the per face operators indexed
+  ///by faces (empty matrices for not yet computed operators).
   bool myGlobalCacheEnabled;
-  mutable std::array<std::unordered_map<Face,DenseMatrix>, 15> myGlobalCache;
+  mutable std::array<std::vector<DenseMatrix>, 15> myGlobalCache;
   
 }; // end of class PolygonalCalculus
 
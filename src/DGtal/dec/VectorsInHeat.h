@@ -41,6 +41,8 @@
 //////////////////////////////////////////////////////////////////////////////
 // Inclusions
 #include <iostream>
+#include <vector>
+#include <utility>
 #include "DGtal/base/Common.h"
 #include "DGtal/base/ConstAlias.h"
 #include "DGtal/math/linalg/DirichletConditions.h"
@@ -56,6 +58,10 @@ namespace DGtal
  *
  * see @ref moduleVectorsInHeat for details and examples.
  *
+ * Vectors from many independent source sets can be diffused at once
+ * (see compute(const std::vector< VectorSources >&)), the
+ * prefactorized solvers being then applied to all the sets together.
+ *
  * @tparam a model of PolygonalCalculus.
  */
 template <typename TPolygonalCalculus>
@@ -73,6 +79,8 @@ public:
     typedef typename PolygonalCalculus::LinAlg LinAlgBackend;
     typedef DirichletConditions< LinAlgBackend > Conditions;
     typedef typename Conditions::IntegerVector IntegerVector;
+    /// A set of source vectors, as pairs (vertex, extrinsic R3 vector).
+    typedef std::vector< std::pair< Vertex, Vector > > VectorSources;
 
     /**
      * Default constructor.
@@ -182,8 +190,7 @@ public:
     void addSource(const Vertex aV,const Vector& ev)
     {
         ASSERT_MSG(aV < myCalculus->nbVertices(), "Vertex is not in the surface mesh vertex range");
-        Vector v = myCalculus->Tv(aV).transpose()*ev;
-        v = v.normalized()*ev.norm();
+        Vector v = tangentSource(aV,ev);
         myVectorSource( 2*aV ) = v(0);
         myVectorSource( 2*aV+1 ) = v(1);
         myScalarSource( aV ) = v.norm();
@@ -237,39 +244,39 @@ public:
     std::vector<Vector> compute() const
     {
         FATAL_ERROR_MSG(myIsInit, "init() method must be called first");
-        //Heat diffusion
-        Vector vectorHeatDiffusion = myVectorHeatSolver.solve(myVectorSource);
-        Vector scalarHeatDiffusion = myScalarHeatSolver.solve(myScalarSource);
-        Vector diracHeatDiffusion = myScalarHeatSolver.solve(myDiracSource);
-        auto surfmesh = myCalculus->getSurfaceMeshPtr();
-
-
-        // Take care of boundaries
-        if ( myManageBoundary )
-        {
-          Vector bValues  = Vector::Zero( myCalculus->nbVertices() );
-          Vector bNormSources = Conditions::dirichletVector( myScalarHeatOpe, myScalarSource,
-                                                         myBoundary, bValues );
-          Vector bSol     = myHeatDirichletSolver.solve( bNormSources );
-          Vector heatDiffusionDirichlet
-                          = Conditions::dirichletSolution( bSol, myBoundary, bValues );
-          scalarHeatDiffusion = 0.5 * ( scalarHeatDiffusion + heatDiffusionDirichlet );
-        }
-
-        std::vector<Vector> result(surfmesh->nbVertices());
-
-        for (typename PolygonalCalculus::MySurfaceMesh::Index v = 0;v<surfmesh->nbVertices();v++){
-            Vector Y(2);
-            Y(0) = vectorHeatDiffusion(2*v);
-            Y(1) = vectorHeatDiffusion(2*v+1);
-            Y = Y.normalized()*(scalarHeatDiffusion(v)/diracHeatDiffusion(v));
-            result[v] = myCalculus->toExtrinsicVector(v,Y);
-        }
-
-        return result;
+        return diffuse( myVectorSource, myScalarSource, myDiracSource ).front();
     }
 
-
+    /// Diffuses the vectors of several independent sets of sources at
+    /// once. The prefactorized heat solvers are applied to all the
+    /// sets together (see EigenLinearAlgebraBackend::solveMultiple),
+    /// which is much faster than calling compute() for each set when
+    /// there are many sets.
+    ///
+    /// @param sources a range of source sets, each one a range of
+    /// pairs (vertex, extrinsic R3 vector), as given to addSource.
+    /// @returns for each source set, the estimated heat diffused
+    /// vectors at each vertex (the result of compute() for this set).
+    std::vector< std::vector<Vector> > compute( const std::vector< VectorSources >& sources ) const
+    {
+        FATAL_ERROR_MSG(myIsInit, "init() method must be called first");
+        const auto nv = myCalculus->nbVertices();
+        DenseMatrix vectorSources = DenseMatrix::Zero( 2*nv, sources.size() );
+        DenseMatrix scalarSources = DenseMatrix::Zero( nv, sources.size() );
+        DenseMatrix diracSources  = DenseMatrix::Zero( nv, sources.size() );
+        for ( std::size_t i = 0; i < sources.size(); ++i )
+          for ( const auto& s : sources[ i ] )
+          {
+            ASSERT_MSG(s.first < nv, "Vertex is not in the surface mesh vertex range");
+            Vector v = tangentSource( s.first, s.second );
+            vectorSources( 2*s.first, i )   = v(0);
+            vectorSources( 2*s.first+1, i ) = v(1);
+            scalarSources( s.first, i )     = v.norm();
+            diracSources( s.first, i )      = 1;
+          }
+        return diffuse( vectorSources, scalarSources, diracSources );
+    }
+    
     /// @return true if the calculus is valid.
     bool isValid() const
     {
@@ -280,6 +287,65 @@ public:
 
 private:
 
+    /// @return the tangential part of the extrinsic vector @a ev at
+    /// vertex @a aV, in its tangent frame, with the norm of @a ev.
+    Vector tangentSource(const Vertex aV, const Vector& ev) const
+    {
+        Vector v = myCalculus->Tv(aV).transpose()*ev;
+        return v.normalized()*ev.norm();
+    }
+
+    /// Diffuses the sources given by each column of the source
+    /// matrices (one column per set of sources).
+    /// @param vectorSources the intrinsic source vectors (2*nbVertices rows).
+    /// @param scalarSources the norms of the source vectors (nbVertices rows).
+    /// @param diracSources the characteristic vectors of the sources (nbVertices rows).
+    /// @returns for each column, the diffused extrinsic vectors at each vertex.
+    std::vector< std::vector<Vector> > diffuse( const DenseMatrix& vectorSources,
+                                                const DenseMatrix& scalarSources,
+                                                const DenseMatrix& diracSources ) const
+    {
+        const long nv = (long) myCalculus->nbVertices();
+        const long m  = (long) vectorSources.cols();
+        //Heat diffusion, the scalar and dirac sources being solved together
+        DenseMatrix scalarDiracSources( nv, 2*m );
+        scalarDiracSources << scalarSources, diracSources;
+        DenseMatrix vectorHeatDiffusion = LinAlgBackend::solveMultiple( myVectorHeatSolver, vectorSources );
+        DenseMatrix scalarDiracHeatDiffusion = LinAlgBackend::solveMultiple( myScalarHeatSolver, scalarDiracSources );
+        auto scalarHeatDiffusion = scalarDiracHeatDiffusion.leftCols( m );
+        auto diracHeatDiffusion  = scalarDiracHeatDiffusion.rightCols( m );
+        // Take care of boundaries
+        if ( myManageBoundary )
+        {
+          Vector bValues  = Vector::Zero( nv );
+          DenseMatrix bNormSources( ( myBoundary.array() == 0 ).count(), m );
+          for ( long i = 0; i < m; ++i )
+            bNormSources.col( i ) = Conditions::dirichletVector( myScalarHeatOpe, Vector( scalarSources.col( i ) ),
+                                                                 myBoundary, bValues );
+          DenseMatrix bSol = LinAlgBackend::solveMultiple( myHeatDirichletSolver, bNormSources );
+          for ( long i = 0; i < m; ++i )
+          {
+            Vector heatDiffusionDirichlet
+                            = Conditions::dirichletSolution( Vector( bSol.col( i ) ), myBoundary, bValues );
+            scalarHeatDiffusion.col( i ) = 0.5 * ( scalarHeatDiffusion.col( i ) + heatDiffusionDirichlet );
+          }
+        }
+        std::vector< std::vector<Vector> > result( m, std::vector<Vector>( nv ) );
+#ifdef WITH_OPENMP
+#pragma omp parallel for schedule(dynamic, 256)
+#endif
+        for (long v = 0; v < nv; v++)
+          for (long i = 0; i < m; i++)
+          {
+            Vector Y(2);
+            Y(0) = vectorHeatDiffusion(2*v, i);
+            Y(1) = vectorHeatDiffusion(2*v+1, i);
+            Y = Y.normalized()*(scalarHeatDiffusion(v, i)/diracHeatDiffusion(v, i));
+            result[i][v] = myCalculus->toExtrinsicVector(v,Y);
+          }
+        return result;
+    }
+
     ///The underlying PolygonalCalculus instance
     const PolygonalCalculus *myCalculus;
 
@@ -0,0 +1,320 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file PackedFreemanChain.h
+ *
+ * @date 2026/10/18
+ *
+ * @brief Header file for module PackedFreemanChain.cpp
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(PackedFreemanChain_RECURSES)
+#error Recursive header files inclusion detected in PackedFreemanChain.h
+#else // defined(PackedFreemanChain_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define PackedFreemanChain_RECURSES
+
+#if !defined PackedFreemanChain_h
+/** Prevents repeated inclusion of headers. */
+#define PackedFreemanChain_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <vector>
+#include <array>
+#include <utility>
+#include "DGtal/base/Common.h"
+#include "DGtal/base/Bits.h"
+#include "DGtal/kernel/CInteger.h"
+#include "DGtal/kernel/PointVector.h"
+#include "DGtal/geometry/curves/FreemanChain.h"
+#include "DGtal/geometry/curves/ArithmeticalDSS.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class PackedFreemanChain
+  /**
+   * Description of template class 'PackedFreemanChain' <p>
+   * \brief Aim: Describes a digital 4-connected contour as a Freeman
+   * chain whose codes are packed on two bits, i.e. 32 codes per
+   * 64-bits word, which uses four times less memory than FreemanChain.
+   *
+   * Codes have the same meaning as in FreemanChain ('0' for east,
+   * '1' for north, '2' for west and '3' for south). Most operations
+   * process a whole word at once:
+   * - counting codes, hence computing points (getPoint, lastPoint);
+   * - run-length decoding (runLength, runs);
+   * - reversal of the chain (reversed) and quarter turns of all the
+   *   codes (rotated), for instance to bring the codes of a part of
+   *   the chain into the first quadrant.
+   *
+   * Standard DSS are recognized run by run (see extendFront): along
+   * a run of identical codes, the remainders of the points vary
+   * linearly, so that the points that are in the current DSL are
+   * added at once, and only the points that change the DSS are added
+   * one by one with ArithmeticalDSS::extendFront. The results are
+   * exactly the ones of an ArithmeticalDSS extended point by point.
+   *
+   * @code
+   FreemanChain<int> fc( fst );
+   PackedFreemanChain<int> pfc( fc );
+   auto segments = pfc.greedyDSSSegmentation();
+   * @endcode
+   *
+   * @tparam TInteger type of the coordinates of the points, a model of CInteger.
+   *
+   * @see FreemanChain testPackedFreemanChain.cpp
+   */
+  template <typename TInteger>
+  class PackedFreemanChain
+  {
+  public:
+
+    BOOST_CONCEPT_ASSERT(( concepts::CInteger<TInteger> ) );
+    typedef TInteger Integer;
+    typedef PackedFreemanChain<Integer> Self;
+    typedef PointVector<2, Integer> Point;
+    typedef PointVector<2, Integer> Vector;
+    typedef unsigned int Size;
+    typedef unsigned int Index;
+    /// The type of the words where codes are packed.
+    typedef DGtal::uint64_t Word;
+    /// A run of identical codes: the code and the number of codes.
+    typedef std::pair<char, Size> Run;
+    /// Standard (4-connected) DSS recognized on the chain.
+    typedef ArithmeticalDSS<Integer, Integer, 4> DSS;
+
+    /// The number of codes in a word.
+    static constexpr Size nbCodesPerWord = 32;
+
+    // ----------------------- Standard services ------------------------------
+  public:
+
+    /**
+     * Constructor of an empty chain.
+     * @param x the x-coordinate of the first point.
+     * @param y the y-coordinate of the first point.
+     */
+    PackedFreemanChain( Integer x = 0, Integer y = 0 );
+
+    /**
+     * Constructor from a Freeman chain.
+     * @param fc any Freeman chain.
+     */
+    PackedFreemanChain( const FreemanChain<Integer>& fc );
+
+    /// @return the equivalent Freeman chain.
+    FreemanChain<Integer> toFreemanChain() const;
+
+    /// @return the number of codes (the number of points minus one).
+    Size size() const { return mySize; }
+
+    /**
+     * @param pos a position in the chain, less than size().
+     * @return the code at position @a pos, as a char '0' to '3'.
+     */
+    char code( Index pos ) const
+    {
+      ASSERT( pos < mySize );
+      return '0' + (char) laneCode( pos );
+    }
+
+    /**
+     * Adds a code at the end of the chain.
+     * @param aCode a char '0' to '3'.
+     * @return a reference on this.
+     */
+    Self& extend( char aCode );
+
+    /// @return the words where the codes are packed.
+    const std::vector<Word>& words() const { return myWords; }
+
+    /// @return the first point of the chain.
+    Point firstPoint() const { return Point( x0, y0 ); }
+
+    /// @return the last point of the chain.
+    Point lastPoint() const { return Point( xn, yn ); }
+
+    /**
+     * Computes a point of the chain, by counting codes word by word.
+     * @param pos a position between 0 and size().
+     * @return the point after the @a pos first codes.
+     */
+    Point getPoint( Index pos ) const;
+
+    /**
+     * @param pos a position between 0 and size().
+     * @return the number of occurrences of each code in the @a pos first codes.
+     */
+    std::array<Size, 4> codeCounts( Index pos ) const;
+
+    /**
+     * @param pos a position in the chain, less than size().
+     * @return the number of consecutive codes equal to the code at @a pos,
+     * starting at @a pos.
+     */
+    Size runLength( Index pos ) const;
+
+    /// @return the run-length encoding of the chain.
+    std::vector<Run> runs() const;
+
+    /**
+     * @return the chain traversed in the opposite direction: it
+     * starts at the last point and codes are reversed and turned by a
+     * half turn.
+     */
+    Self reversed() const;
+
+    /**
+     * @param n the number of quarter turns (counterclockwise).
+     * @return the chain turned by @a n quarter turns around its first
+     * point: each code c becomes (c+n) mod 4.
+     */
+    Self rotated( int n ) const;
+
+    // ----------------------- DSS recognition --------------------------------
+  public:
+
+    /**
+     * Extends a DSS by @a k times the same step, as @a k calls to
+     * ArithmeticalDSS::extendFront would do, stopping at the first failure.
+     *
+     * @param[in,out] dss any standard DSS.
+     * @param step a 4-connected step.
+     * @param k the number of steps.
+     * @return the number of added points.
+     */
+    static Size extendFront( DSS& dss, const Vector& step, Size k );
+
+    /**
+     * @param pos a position between 0 and size().
+     * @return the longest standard DSS of the chain starting at the
+     * point of position @a pos.
+     */
+    DSS longestDSS( Index pos ) const;
+
+    /**
+     * Computes the greedy segmentation of the (open) chain into
+     * standard DSS: each DSS is the longest one starting at the last
+     * point of the previous one. These are the DSS of
+     * GreedySegmentation with a StandardDSS4Computer on the points of
+     * the chain.
+     *
+     * @return the DSS of the segmentation.
+     */
+    std::vector<DSS> greedyDSSSegmentation() const;
+
+    /**
+     * Writes/Displays the object on an output stream.
+     * @param out the output stream where the object is written.
+     */
+    void selfDisplay ( std::ostream & out ) const;
+
+    /**
+     * Checks the validity/consistency of the object.
+     * @return 'true' if the object is valid, 'false' otherwise.
+     */
+    bool isValid() const;
+
+    // ------------------------- Private Datas --------------------------------
+  private:
+    /// The packed codes: code i is at bits 2(i%32) and 2(i%32)+1 of word i/32.
+    /// Unused bits of the last word are null.
+    std::vector<Word> myWords;
+    /// The number of codes.
+    Size mySize;
+    /// Coordinates of the first point.
+    Integer x0, y0;
+    /// Coordinates of the last point.
+    Integer xn, yn;
+
+    // ------------------------- Internals ------------------------------------
+  private:
+
+    /// @return the code at position @a pos as a number 0 to 3.
+    unsigned int laneCode( Index pos ) const
+    {
+      return (unsigned int)( ( myWords[ pos / nbCodesPerWord ]
+                               >> ( 2 * ( pos % nbCodesPerWord ) ) ) & 3 );
+    }
+
+    /// @return the step of a code given as a number 0 to 3.
+    static Vector codeStep( unsigned int c )
+    {
+      switch ( c )
+        {
+        case 0:  return Vector(  1,  0 );
+        case 1:  return Vector(  0,  1 );
+        case 2:  return Vector( -1,  0 );
+        default: return Vector(  0, -1 );
+        }
+    }
+
+    /// @return a mask of the low bits of the @a n first lanes of a word.
+    static Word lowLanes( Size n );
+
+    /// Sets to zero the unused bits of the last word.
+    void clearUnusedBits();
+
+    /**
+     * Extends a DSS by at most @a k times the same step, as long as
+     * the DSL of the DSS does not change.
+     * @param[in,out] dss any standard DSS.
+     * @param step a 4-connected step.
+     * @param k the maximal number of steps.
+     * @return the number of added points.
+     */
+    static Size extendFrontInDSL( DSS& dss, const Vector& step, Size k );
+
+    /// Recomputes the last point from the first one and the codes.
+    void computeLastPoint();
+
+  }; // end of class PackedFreemanChain
+
+
+  /**
+   * Overloads 'operator<<' for displaying objects of class 'PackedFreemanChain'.
+   * @param out the output stream where the object is written.
+   * @param object the object of class 'PackedFreemanChain' to write.
+   * @return the output stream after the writing.
+   */
+  template <typename TInteger>
+  std::ostream&
+  operator<< ( std::ostream & out, const PackedFreemanChain<TInteger> & object );
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/geometry/curves/PackedFreemanChain.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined PackedFreemanChain_h
+
+#undef PackedFreemanChain_RECURSES
+#endif // else defined(PackedFreemanChain_RECURSES)
@@ -0,0 +1,236 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file ParallelSaturatedSegmentation.h
+ *
+ * @date 2026/10/18
+ *
+ * @brief Header file for module ParallelSaturatedSegmentation.cpp
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(ParallelSaturatedSegmentation_RECURSES)
+#error Recursive header files inclusion detected in ParallelSaturatedSegmentation.h
+#else // defined(ParallelSaturatedSegmentation_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define ParallelSaturatedSegmentation_RECURSES
+
+#if !defined ParallelSaturatedSegmentation_h
+/** Prevents repeated inclusion of headers. */
+#define ParallelSaturatedSegmentation_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <string>
+#include <vector>
+#include "DGtal/base/Common.h"
+#include "DGtal/base/IteratorCirculatorTraits.h"
+#include "DGtal/geometry/curves/CForwardSegmentComputer.h"
+#include "DGtal/geometry/curves/SegmentComputerUtils.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class ParallelSaturatedSegmentation
+  /**
+   * Description of template class 'ParallelSaturatedSegmentation' <p>
+   * \brief Aim: Computes the saturated segmentation, that is the
+   * whole set of maximal segments (tangential cover), of a whole
+   * range of elements, in parallel.
+   *
+   * The range, given by random-access iterators (open curve) or by
+   * random-access circulators (closed curve), is split into chunks
+   * that are processed independently (with OpenMP if DGtal is built
+   * with it). In each chunk, the maximal segments are computed with
+   * the functions of SegmentComputerUtils.h, starting from the first
+   * maximal segment that contains the first element of the chunk, and
+   * only the maximal segments that begin in the chunk are kept.
+   * Since each maximal segment begins in exactly one chunk, the
+   * maximal segments of all chunks are, in order, exactly the ones
+   * that SaturatedSegmentation visits on the whole range (with the
+   * same mode).
+   *
+   * Contrary to SaturatedSegmentation, the segment computers are
+   * stored in a vector, which is useful to process them afterwards in
+   * parallel.
+   *
+   * @code
+   typedef PointVector<2,int> Point;
+   typedef std::vector<Point> Range;
+   typedef Range::const_iterator ConstIterator;
+   typedef ArithmeticalDSSComputer<ConstIterator,int,8> SegmentComputer;
+   typedef ParallelSaturatedSegmentation<SegmentComputer> Segmentation;
+   Segmentation theSegmentation( r.begin(), r.end(), SegmentComputer() );
+   theSegmentation.compute();
+   for ( auto&& s : theSegmentation ) trace.info() << s << std::endl;
+   * @endcode
+   *
+   * @tparam TSegmentComputer at least a model of CForwardSegmentComputer,
+   * whose ConstIterator is random-access.
+   *
+   * @see SaturatedSegmentation
+   * @see testParallelSaturatedSegmentation.cpp
+   */
+  template <typename TSegmentComputer>
+  class ParallelSaturatedSegmentation
+  {
+  public:
+
+    BOOST_CONCEPT_ASSERT(( concepts::CForwardSegmentComputer<TSegmentComputer> ));
+    typedef TSegmentComputer SegmentComputer;
+    typedef typename SegmentComputer::ConstIterator ConstIterator;
+    typedef typename IteratorCirculatorTraits<ConstIterator>::Difference Difference;
+    /// The maximal segments, in the order of the range.
+    typedef std::vector<SegmentComputer> Segments;
+    typedef typename Segments::const_iterator SegmentComputerIterator;
+
+    // ----------------------- Standard services ------------------------------
+  public:
+
+    /**
+     * Constructor.
+     * @param itb begin iterator of the underlying range
+     * @param ite end iterator of the underlying range
+     * (equal to @a itb for a whole range of circulators)
+     * @param aSegmentComputer an online segment recognition algorithm.
+     */
+    ParallelSaturatedSegmentation( const ConstIterator& itb,
+                                   const ConstIterator& ite,
+                                   const SegmentComputer& aSegmentComputer );
+
+    /**
+     * Sets the mode, which is used to find the first and last maximal
+     * segments, as in SaturatedSegmentation::setMode.
+     * @param aMode either "First", "MostCentered" (default), "Last",
+     * "First++", "MostCentered++" or "Last++".
+     */
+    void setMode( const std::string& aMode );
+
+    /**
+     * Sets the number of chunks. More chunks than threads are
+     * useful to balance the work, but each chunk computes a few
+     * maximal segments that are not kept.
+     * @param nb the number of chunks, or 0 (default) for four chunks
+     * per thread.
+     */
+    void setNbChunks( std::size_t nb );
+
+    /**
+     * Destructor.
+     */
+    ~ParallelSaturatedSegmentation() = default;
+
+    // ----------------------- Interface --------------------------------------
+  public:
+
+    /**
+     * Computes all the maximal segments.
+     * @return the maximal segments, in the order of the range.
+     */
+    const Segments& compute();
+
+    /// @return the maximal segments computed by the last call to compute().
+    const Segments& segments() const { return mySegments; }
+
+    /// @return an iterator on the first maximal segment.
+    SegmentComputerIterator begin() const { return mySegments.begin(); }
+
+    /// @return an iterator after the last maximal segment.
+    SegmentComputerIterator end() const { return mySegments.end(); }
+
+    /**
+     * Writes/Displays the object on an output stream.
+     * @param out the output stream where the object is written.
+     */
+    void selfDisplay ( std::ostream & out ) const;
+
+    /**
+     * Checks the validity/consistency of the object.
+     * @return 'true' if the object is valid, 'false' otherwise.
+     */
+    bool isValid() const;
+
+    // ------------------------- Private Datas --------------------------------
+  private:
+    /// Begin iterator of the underlying range.
+    ConstIterator myBegin;
+    /// End iterator of the underlying range.
+    ConstIterator myEnd;
+    /// The mode used to compute the first and last maximal segments.
+    std::string myMode;
+    /// The number of chunks (0 for an automatic choice).
+    std::size_t myNbChunks;
+    /// The segment computer used to copy the other ones.
+    SegmentComputer mySegmentComputer;
+    /// The maximal segments.
+    Segments mySegments;
+
+    // ------------------------- Internals ------------------------------------
+  private:
+
+    /**
+     * Computes the maximal segment at @a it according to the mode.
+     * @param s the segment computer to initialize.
+     * @param it an iterator of the range.
+     */
+    void modeMaximalSegment( SegmentComputer& s, const ConstIterator& it ) const;
+
+    /**
+     * Computes the maximal segments that begin in a chunk.
+     * @param first the first maximal segment of the range.
+     * @param last the last maximal segment of the range.
+     * @param lo the offset, from the beginning of @a first, of the first element of the chunk.
+     * @param hi the offset, from the beginning of @a first, after the last element of the chunk.
+     * @param[out] result the maximal segments that begin in the chunk.
+     */
+    void computeChunk( const SegmentComputer& first, const SegmentComputer& last,
+                       Difference lo, Difference hi, Segments& result ) const;
+
+  }; // end of class ParallelSaturatedSegmentation
+
+
+  /**
+   * Overloads 'operator<<' for displaying objects of class 'ParallelSaturatedSegmentation'.
+   * @param out the output stream where the object is written.
+   * @param object the object of class 'ParallelSaturatedSegmentation' to write.
+   * @return the output stream after the writing.
+   */
+  template <typename TSegmentComputer>
+  std::ostream&
+  operator<< ( std::ostream & out,
+               const ParallelSaturatedSegmentation<TSegmentComputer> & object );
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/geometry/curves/ParallelSaturatedSegmentation.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined ParallelSaturatedSegmentation_h
+
+#undef ParallelSaturatedSegmentation_RECURSES
+#endif // else defined(ParallelSaturatedSegmentation_RECURSES)
@@ -0,0 +1,318 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file StreamingDSSSegmentation.h
+ *
+ * @date 2026/10/18
+ *
+ * @brief Header file for module StreamingDSSSegmentation.cpp
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(StreamingDSSSegmentation_RECURSES)
+#error Recursive header files inclusion detected in StreamingDSSSegmentation.h
+#else // defined(StreamingDSSSegmentation_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define StreamingDSSSegmentation_RECURSES
+
+#if !defined StreamingDSSSegmentation_h
+/** Prevents repeated inclusion of headers. */
+#define StreamingDSSSegmentation_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <vector>
+#include <functional>
+#include <boost/iterator/iterator_facade.hpp>
+#include "DGtal/base/Common.h"
+#include "DGtal/kernel/PointVector.h"
+#include "DGtal/geometry/curves/ArithmeticalDSSComputer.h"
+#include "DGtal/geometry/curves/SegmentComputerUtils.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class StreamingDSSSegmentation
+  /**
+   * Description of template class 'StreamingDSSSegmentation' <p>
+   * \brief Aim: Computes the greedy segmentation or the saturated
+   * segmentation (i.e. all maximal segments) of a digital curve into
+   * DSSs, while the points of the curve are given one by one, for
+   * instance from a single-pass input iterator.
+   *
+   * GreedySegmentation and SaturatedSegmentation require the whole
+   * curve in a range of forward iterators. Here, the points are
+   * pushed in a sliding window, which only keeps the points of the
+   * current segment. Each segment is sent to a user function as soon
+   * as it cannot be extended anymore, and its points are then
+   * released. The memory used is thus proportional to the length of
+   * the longest segment and not to the length of the curve.
+   *
+   * The segments are recognized by an ArithmeticalDSSComputer whose
+   * iterators (see ConstIterator) point into the sliding window. They
+   * are exactly the segments of GreedySegmentation (mode "Truncate")
+   * and SaturatedSegmentation on the whole (open) curve.
+   *
+   * @code
+   typedef StreamingDSSSegmentation<int> Segmentation;
+   Segmentation segmentation( Segmentation::Mode::SATURATED,
+     [] ( const Segmentation::SegmentComputer& s )
+     { trace.info() << s.begin().index() << " " << s.primitive() << std::endl; } );
+   for ( auto it = inputPoints.begin(); it != inputPoints.end(); ++it )
+     segmentation.push( *it );
+   segmentation.finish();
+   * @endcode
+   *
+   * @note The segment computer given to the user function, and its
+   * iterators, are only valid during the call.
+   *
+   * @tparam TCoordinate the type of the coordinates of the points,
+   * a model of CInteger.
+   * @tparam TInteger the type of integers used by the DSS recognition,
+   * a model of CInteger (default is TCoordinate).
+   * @tparam adjacency 4 for standard (simply 4-connected) DSS or 8 for
+   * naive (simply 8-connected) DSS (default).
+   *
+   * @see testStreamingDSSSegmentation.cpp
+   */
+  template <typename TCoordinate,
+            typename TInteger = TCoordinate,
+            unsigned short adjacency = 8>
+  class StreamingDSSSegmentation
+  {
+    // ----------------------- Types ------------------------------
+  public:
+    typedef TCoordinate Coordinate;
+    typedef TInteger    Integer;
+    typedef PointVector<2, Coordinate> Point;
+    /// Index of a point in the stream (the first point has index 0).
+    typedef std::ptrdiff_t Index;
+    typedef StreamingDSSSegmentation<TCoordinate, TInteger, adjacency> Self;
+
+    /// The two segmentations that may be computed.
+    enum class Mode { GREEDY, SATURATED };
+
+    /**
+     * Random-access iterator on the points of the sliding window,
+     * identified by their index in the stream. It remains valid when
+     * points are pushed, as long as its point is not released.
+     */
+    class ConstIterator
+      : public boost::iterator_facade< ConstIterator, Point const,
+                                       boost::random_access_traversal_tag >
+    {
+    public:
+      /// Default constructor. Not valid.
+      ConstIterator() : mySegmentation( nullptr ), myIndex( 0 ) {}
+
+      /**
+       * Constructor.
+       * @param s the segmentation that stores the points.
+       * @param i the index of the point in the stream.
+       */
+      ConstIterator( const Self* s, Index i ) : mySegmentation( s ), myIndex( i ) {}
+
+      /// @return the index of the pointed point in the stream.
+      Index index() const { return myIndex; }
+
+    private:
+      friend class boost::iterator_core_access;
+      void increment() { ++myIndex; }
+      void decrement() { --myIndex; }
+      void advance( std::ptrdiff_t n ) { myIndex += n; }
+      std::ptrdiff_t distance_to( ConstIterator const& other ) const
+      { return other.myIndex - myIndex; }
+      bool equal( ConstIterator const& other ) const
+      { return myIndex == other.myIndex; }
+      Point const& dereference() const { return mySegmentation->point( myIndex ); }
+
+      /// The segmentation that stores the points.
+      const Self* mySegmentation;
+      /// The index of the pointed point in the stream.
+      Index myIndex;
+    };
+
+    typedef ArithmeticalDSSComputer<ConstIterator, Integer, adjacency> SegmentComputer;
+    typedef typename SegmentComputer::Primitive DSS;
+    /// The function called on each segment, as soon as it is computed.
+    typedef std::function< void ( const SegmentComputer& ) > SegmentFunction;
+
+    // ----------------------- Standard services ------------------------------
+  public:
+
+    /**
+     * Constructor.
+     * @param aMode the segmentation to compute.
+     * @param aFunction the function called on each segment, in the
+     * order of the curve.
+     */
+    StreamingDSSSegmentation( Mode aMode, const SegmentFunction& aFunction );
+
+    /// Copy is forbidden, since the segment computer points to this object.
+    StreamingDSSSegmentation( const StreamingDSSSegmentation& other ) = delete;
+
+    /// Assignment is forbidden, since the segment computer points to this object.
+    StreamingDSSSegmentation& operator=( const StreamingDSSSegmentation& other ) = delete;
+
+    /**
+     * Destructor.
+     */
+    ~StreamingDSSSegmentation() = default;
+
+    // ----------------------- Interface --------------------------------------
+  public:
+
+    /**
+     * Adds the next point of the curve. The segments that are
+     * finalized by this point are sent to the user function.
+     * Amortized complexity is constant per point.
+     *
+     * @param p the next point of the curve.
+     */
+    void push( const Point& p );
+
+    /**
+     * Adds all the points of the range [itb,ite).
+     * @tparam TInputIterator a model of single-pass input iterator on points.
+     * @param itb begin iterator.
+     * @param ite end iterator.
+     */
+    template <typename TInputIterator>
+    void push( TInputIterator itb, TInputIterator ite )
+    {
+      for ( ; itb != ite; ++itb ) push( *itb );
+    }
+
+    /**
+     * Tells that the curve is finished: the last segments are sent to
+     * the user function and the object is ready for another curve.
+     */
+    void finish();
+
+    /**
+     * Forgets the current curve, without sending its last segments.
+     */
+    void clear();
+
+    /// @return the number of points pushed since the beginning of the curve.
+    Index nbPoints() const { return myNbPoints; }
+
+    /// @return the number of segments sent since the beginning of the curve.
+    Index nbSegments() const { return myNbSegments; }
+
+    /// @return the number of points currently stored.
+    std::size_t bufferSize() const { return myPoints.size(); }
+
+    /// @return the maximal number of points stored since the
+    /// beginning of the curve.
+    std::size_t maxBufferSize() const { return myMaxBufferSize; }
+
+    /**
+     * @param i the index of a point in the stream, not released yet.
+     * @return the point of index \a i.
+     */
+    const Point& point( Index i ) const
+    {
+      ASSERT( myFirst <= i && i < myNbPoints );
+      return myPoints[ i - myFirst ];
+    }
+
+    /**
+     * Writes/Displays the object on an output stream.
+     * @param out the output stream where the object is written.
+     */
+    void selfDisplay ( std::ostream & out ) const;
+
+    /**
+     * Checks the validity/consistency of the object.
+     * @return 'true' if the object is valid, 'false' otherwise.
+     */
+    bool isValid() const;
+
+    // ------------------------- Private Datas --------------------------------
+  private:
+    /// The segmentation that is computed.
+    Mode myMode;
+    /// The function called on each segment.
+    SegmentFunction myFunction;
+    /// The stored points: myPoints[ k ] is the point of index myFirst + k.
+    std::vector<Point> myPoints;
+    /// The index of the first stored point.
+    Index myFirst;
+    /// The number of points pushed.
+    Index myNbPoints;
+    /// The number of segments sent.
+    Index myNbSegments;
+    /// The maximal number of stored points.
+    std::size_t myMaxBufferSize;
+    /// The current segment.
+    SegmentComputer mySegmentComputer;
+    /// True when the current segment has been initialized.
+    bool myFlagIsInit;
+
+    // ------------------------- Internals ------------------------------------
+  private:
+
+    /// @param i the index of a point in the stream.
+    /// @return an iterator on this point.
+    ConstIterator iterator( Index i ) const { return ConstIterator( this, i ); }
+
+    /// Extends, sends and moves the current segment as far as the
+    /// available points allow it.
+    void process();
+
+    /// Initializes the current segment, which is maximal, at the
+    /// beginning of the next maximal segment.
+    void nextMaximalSegmentStart();
+
+    /// Releases the points before the current segment.
+    void release();
+
+  }; // end of class StreamingDSSSegmentation
+
+
+  /**
+   * Overloads 'operator<<' for displaying objects of class 'StreamingDSSSegmentation'.
+   * @param out the output stream where the object is written.
+   * @param object the object of class 'StreamingDSSSegmentation' to write.
+   * @return the output stream after the writing.
+   */
+  template <typename TCoordinate, typename TInteger, unsigned short adjacency>
+  std::ostream&
+  operator<< ( std::ostream & out,
+               const StreamingDSSSegmentation<TCoordinate, TInteger, adjacency> & object );
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/geometry/curves/StreamingDSSSegmentation.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined StreamingDSSSegmentation_h
+
+#undef StreamingDSSSegmentation_RECURSES
+#endif // else defined(StreamingDSSSegmentation_RECURSES)
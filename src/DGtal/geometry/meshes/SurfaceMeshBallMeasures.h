@@ -0,0 +1,305 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file SurfaceMeshBallMeasures.h
+ *
+ * @date 2026/10/18
+ *
+ * Header file for module SurfaceMeshBallMeasures.cpp
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(SurfaceMeshBallMeasures_RECURSES)
+#error Recursive header files inclusion detected in SurfaceMeshBallMeasures.h
+#else // defined(SurfaceMeshBallMeasures_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define SurfaceMeshBallMeasures_RECURSES
+
+#if !defined SurfaceMeshBallMeasures_h
+/** Prevents repeated inclusion of headers. */
+#define SurfaceMeshBallMeasures_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <vector>
+#include "DGtal/base/Common.h"
+#include "DGtal/base/ConstAlias.h"
+#include "DGtal/shapes/SurfaceMesh.h"
+#include "DGtal/geometry/meshes/SurfaceMeshMeasure.h"
+
+namespace DGtal
+{
+  /////////////////////////////////////////////////////////////////////////////
+  // template class SurfaceMeshBallMeasures
+  /**
+     Description of template class 'SurfaceMeshBallMeasures' <p>
+     \brief Aim: Evaluates SurfaceMeshMeasure objects (e.g. the
+     curvature measures of CorrectedNormalCurrentComputer or
+     NormalCycleComputer) on many balls of the same radius, for
+     instance centered at every vertex or every face of a mesh.
+
+     It gives exactly the same values as
+     SurfaceMeshMeasure::measure( const RealPoint&, Scalar, Face ) const,
+     but:
+
+     - the face centroids and the edges bounding each face are
+       computed once at construction and stored in flat arrays;
+     - each ball traversal uses a per-thread workspace, so that no
+       memory is allocated nor hashed per query;
+     - the cells intersected by one ball are computed once and can be
+       used to aggregate several measures (e.g. \f$ \mu_0, \mu_1,
+       \mu_2 \f$) at the same time, see traverseBalls;
+     - queries are processed in parallel if DGtal is built with
+       OpenMP (WITH_OPENMP). Consecutive queries are given to the same
+       thread, so that neighboring queries reuse the same cache lines.
+
+     As in SurfaceMeshMeasure, the cells within a ball are found by a
+     breadth-first traversal of face adjacencies starting from a face
+     close to the center of the ball.
+
+     @code
+     typedef CorrectedNormalCurrentComputer< RealPoint, RealVector > CNC;
+     typedef SurfaceMeshBallMeasures< RealPoint, RealVector > BallMeasures;
+     CNC cnc( mesh );
+     auto mu0 = cnc.computeMu0();
+     auto mu1 = cnc.computeMu1();
+     BallMeasures balls( mesh );
+     std::vector< double > H( mesh.nbVertices() );
+     balls.traverseBalls( mesh.positions(), balls.vertexFaces(), R, false,
+       [&] ( std::size_t i, const BallMeasures::Vertices&,
+             const BallMeasures::WeightedEdges&,
+             const BallMeasures::WeightedFaces& wfaces )
+       { H[ i ] = CNC::meanCurvature( mu0.faceMeasure( wfaces ),
+                                      mu1.faceMeasure( wfaces ) ); } );
+     @endcode
+
+     @tparam TRealPoint an arbitrary model of RealPoint.
+     @tparam TRealVector an arbitrary model of RealVector.
+   */
+  template < typename TRealPoint, typename TRealVector >
+  struct SurfaceMeshBallMeasures
+  {
+    // ------------------------- Public Types ------------------------------
+  public:
+    typedef TRealPoint                                     RealPoint;
+    typedef TRealVector                                    RealVector;
+    typedef SurfaceMeshBallMeasures< RealPoint, RealVector > Self;
+    typedef DGtal::SurfaceMesh< RealPoint, RealVector >    SurfaceMesh;
+    typedef typename SurfaceMesh::Index                    Index;
+    typedef typename SurfaceMesh::Size                     Size;
+    typedef typename SurfaceMesh::Vertex                   Vertex;
+    typedef typename SurfaceMesh::Edge                     Edge;
+    typedef typename SurfaceMesh::Face                     Face;
+    typedef typename SurfaceMesh::Vertices                 Vertices;
+    typedef typename SurfaceMesh::Faces                    Faces;
+    typedef typename SurfaceMesh::WeightedEdges            WeightedEdges;
+    typedef typename SurfaceMesh::WeightedFaces            WeightedFaces;
+    typedef typename RealVector::Component                 Scalar;
+    typedef std::vector< RealPoint >                       RealPoints;
+    typedef std::vector< Edge >                            Edges;
+
+    // ------------------------- Standard services ------------------------------
+  public:
+    /// @name Standard services (construction, initialization, assignment)
+    /// @{
+
+    /// Constructor from mesh. Precomputes face centroids and the
+    /// edges bounding each face.
+    ///
+    /// @param aMesh any simplified mesh that is referenced in this object.
+    SurfaceMeshBallMeasures( ConstAlias< SurfaceMesh > aMesh );
+
+    /// @return a reference to the associated mesh.
+    const SurfaceMesh& mesh() const
+    {
+      return myMesh;
+    }
+
+    /// @return the centroid of every face.
+    const RealPoints& faceCentroids() const
+    {
+      return myFaceCentroids;
+    }
+
+    /// @return for each vertex, one of its incident faces, or
+    /// `mesh().nbFaces()` for an isolated vertex. It is the hint face
+    /// for balls centered on vertices.
+    const Faces& vertexFaces() const
+    {
+      return myVertexFaces;
+    }
+
+    /// @return the range `[0, mesh().nbFaces())`, the hint faces for
+    /// balls centered on face centroids.
+    Faces allFaces() const;
+
+    /// @}
+
+    // ------------------------- Ball services ------------------------------
+  public:
+    /// @name Ball services
+    /// @{
+
+    /// Computes, for every query ball, the cells it intersects with
+    /// their relative inclusion ratios (same values and same order as
+    /// SurfaceMesh::computeFacesInclusionsInBall and
+    /// SurfaceMesh::computeCellsInclusionsInBall) and calls \a fct on
+    /// them.
+    ///
+    /// @tparam TFunction the type of a function `( Index i, const
+    /// Vertices& vertices, const WeightedEdges& wedges, const
+    /// WeightedFaces& wfaces ) -> void`.
+    ///
+    /// @param centers the centers of the balls.
+    ///
+    /// @param hints for each center, a face where or close to where
+    /// it lies (or `mesh().nbFaces()` for an empty ball).
+    ///
+    /// @param r the radius of the balls.
+    ///
+    /// @param with_cells when 'true', the vertices and edges within
+    /// the ball are computed too, otherwise only faces are computed
+    /// and the ranges of vertices and edges passed to \a fct are empty.
+    ///
+    /// @param fct the function called for each ball. It is called
+    /// concurrently on different queries when DGtal is built with
+    /// OpenMP, hence it must only write data specific to query \a i.
+    template < typename TFunction >
+    void traverseBalls( const RealPoints& centers, const Faces& hints,
+                        Scalar r, bool with_cells, TFunction fct ) const;
+
+    /// Computes the measure \f$ \mu(B_r(x_i)) \f$ for every center
+    /// \f$ x_i \f$, i.e. `mu.measure( centers[ i ], r, hints[ i ] )`.
+    ///
+    /// @tparam TValue the type of values of the measure.
+    /// @param mu any measure defined on the same mesh.
+    /// @param centers the centers of the balls.
+    /// @param hints for each center, a face where or close to where it lies.
+    /// @param r the radius of the balls.
+    /// @return the measure of each ball.
+    template < typename TValue >
+    std::vector< TValue >
+    measures( const SurfaceMeshMeasure< RealPoint, RealVector, TValue >& mu,
+              const RealPoints& centers, const Faces& hints, Scalar r ) const;
+
+    /// Computes the measure \f$ \mu(B_r(x)) \f$ for every vertex
+    /// position \a x of the mesh.
+    ///
+    /// @tparam TValue the type of values of the measure.
+    /// @param mu any measure defined on the same mesh.
+    /// @param r the radius of the balls.
+    /// @return the measure of each ball, indexed by vertex.
+    template < typename TValue >
+    std::vector< TValue >
+    measuresAtVertices( const SurfaceMeshMeasure< RealPoint, RealVector, TValue >& mu,
+                        Scalar r ) const
+    {
+      return measures( mu, myMesh.positions(), myVertexFaces, r );
+    }
+
+    /// Computes the measure \f$ \mu(B_r(x)) \f$ for every face
+    /// centroid \a x of the mesh.
+    ///
+    /// @tparam TValue the type of values of the measure.
+    /// @param mu any measure defined on the same mesh.
+    /// @param r the radius of the balls.
+    /// @return the measure of each ball, indexed by face.
+    template < typename TValue >
+    std::vector< TValue >
+    measuresAtFaces( const SurfaceMeshMeasure< RealPoint, RealVector, TValue >& mu,
+                     Scalar r ) const
+    {
+      return measures( mu, myFaceCentroids, allFaces(), r );
+    }
+
+    /// @}
+
+    // ------------------------- Protected Datas ------------------------------
+  protected:
+    /// A reference to the mesh over which computations are done.
+    const SurfaceMesh& myMesh;
+    /// The centroid of every face.
+    RealPoints myFaceCentroids;
+    /// For each vertex, one of its incident faces.
+    Faces myVertexFaces;
+    /// For each face f, the edges bounding f are stored in the range
+    /// `[ myFaceEdgeOffsets[ f ], myFaceEdgeOffsets[ f+1 ] )` of
+    /// myFaceEdges.
+    std::vector< Index > myFaceEdgeOffsets;
+    /// The edges bounding each face, in the order of face vertices.
+    /// An edge is stored only in the face where its vertex indices
+    /// are increasing, the other faces store `mesh().nbEdges()`.
+    Edges myFaceEdges;
+
+    // ------------------------- Internals ------------------------------------
+  protected:
+
+    /// Per-thread data used to traverse balls without allocation.
+    struct Workspace
+    {
+      /// Marks the faces visited by the current traversal.
+      std::vector< unsigned char > face_marks;
+      /// Marks the vertices found by the current traversal.
+      std::vector< unsigned char > vertex_marks;
+      /// Queue of the breadth-first traversal (visited faces).
+      Faces         queue;
+      /// The vertices within the current ball.
+      Vertices      vertices;
+      /// The edges intersected by the current ball.
+      WeightedEdges wedges;
+      /// The faces intersected by the current ball.
+      WeightedFaces wfaces;
+    };
+
+    /// Computes the cells intersected by the ball of center \a p
+    /// and radius \a r, starting from face \a f, and stores them in
+    /// \a ws. Marks are cleared afterwards.
+    ///
+    /// @param ws the workspace of the calling thread.
+    /// @param r the radius of the ball.
+    /// @param f the face where the center \a p lies.
+    /// @param p the center of the ball.
+    /// @param with_cells when 'true', vertices and edges are computed too.
+    void computeBall( Workspace& ws, Scalar r, Face f, const RealPoint& p,
+                      bool with_cells ) const;
+
+    /// Same computation as SurfaceMesh::faceInclusionRatio with a
+    /// precomputed face centroid.
+    ///
+    /// @param p the center of the ball.
+    /// @param r the radius of the ball.
+    /// @param f any valid face index.
+    /// @return the relative inclusion ratio of face \a f in the ball.
+    Scalar faceInclusionRatio( const RealPoint& p, Scalar r, Face f ) const;
+
+  }; // end of class SurfaceMeshBallMeasures
+
+} // namespace DGtal
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "SurfaceMeshBallMeasures.ih"
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined SurfaceMeshBallMeasures_h
+
+#undef SurfaceMeshBallMeasures_RECURSES
+#endif // else defined(SurfaceMeshBallMeasures_RECURSES)
@@ -80,11 +80,24 @@ namespace DGtal
    * To minimize this energy, instead of solving the associated sparse linear system as described in @cite coeurjolly17regDGCI,
    * we perform a gradient descent strategy which allows us a finer control over the vertices displacement (see advection methods).
    *
+   * If DGtal is built with OpenMP (WITH_OPENMP), the energy gradient
+   * and the advection of vertices are computed in parallel. The
+   * gradient is gathered per pointel in a fixed order, hence the
+   * regularized positions do not depend on the number of threads
+   * (only the energy value may differ in the last digits).
+   *
+   * The scalar type of positions, normals and gradients may be
+   * changed to \c float to halve the memory footprint and bandwidth
+   * on large surfaces (e.g. `DigitalSurfaceRegularization<
+   * SH3::DigitalSurface, float >`). Energies are always accumulated
+   * in double.
+   *
    * @see testDigitalSurfaceRegularization.cpp
    *
    * @tparam TDigitalSurface a Digital Surface type (see DigitalSurface).
+   * @tparam TScalar the scalar type of regularized positions (double or float, default is double).
    */
-  template <typename TDigitalSurface>
+  template <typename TDigitalSurface, typename TScalar = double>
   class DigitalSurfaceRegularization
   {
     // ----------------------- Standard services ------------------------------
@@ -102,11 +115,35 @@ namespace DGtal
     ///We rely on the ShortcutsGeometry 3D types
     typedef ShortcutsGeometry<Z3i::KSpace> SHG3;
     
+    ///Scalar type of positions
+    typedef TScalar Scalar;
+    
+    ///Point type of positions (Z3i::RealPoint when Scalar is double)
+    typedef PointVector<3, Scalar> RealPoint;
+    
+    ///Vector type of normals and gradients
+    typedef RealPoint RealVector;
+    
     ///Pointels position container
-    typedef std::vector<Z3i::RealPoint> Positions;
+    typedef std::vector<RealPoint> Positions;
     
     ///Pointels position container
-    typedef std::vector<Z3i::RealVector> Normals;
+    typedef std::vector<RealVector> Normals;
+    
+    /// Statistics of one step of the gradient descent, see getIterationStatistics().
+    struct IterationStatistics
+    {
+      ///Step number
+      unsigned int iteration;
+      ///Learning rate used at this step
+      double dt;
+      ///Energy before the step
+      double energy;
+      ///l_infinity norm of the energy gradient
+      double gradientNorm;
+      ///Time spent in this step (in ms)
+      double time;
+    };
     
     /**
      * Default constructor.
@@ -240,6 +277,9 @@ namespace DGtal
      *
      * The energy at the final step is returned.
      *
+     * @note With OpenMP, @a advectionFunc is called concurrently on
+     * distinct points, it must not modify any shared data.
+     *
      * @param [in] nbIters maxium number of steps
      * @param [in] dt initial learning rate
      * @param [in] epsilon minimum l_infity norm of the gradient vector
@@ -275,7 +315,7 @@ namespace DGtal
                          const double epsilon = 0.0001)
        {
          return regularize(nbIters,dt,epsilon,
-                           [](SHG3::RealPoint& p,SHG3::RealPoint& o,SHG3::RealVector& v){ (void)o; p += v; });
+                           [](RealPoint& p,RealPoint& o,RealVector& v){ (void)o; p += v; });
        }
       
     
@@ -289,9 +329,9 @@ namespace DGtal
      * @param [in] orig the associated point in the original surface.
      * @param [in] v the advection vector.
      */
-    static void clampedAdvection(SHG3::RealPoint &p,
-                                 const SHG3::RealPoint &orig,
-                                 const SHG3::RealVector &v)
+    static void clampedAdvection(RealPoint &p,
+                                 const RealPoint &orig,
+                                 const RealVector &v)
     {
       p += v;
       for(auto i=0; i < 3; ++i)
@@ -308,7 +348,7 @@ namespace DGtal
      * @note the init() method must have been called. For relevant results, the regularize()
      * methods should have been also called before accessing the new positions.
      */
-    SHG3::RealPoint getRegularizedPosition(const SH3::Cell& aPointel)
+    RealPoint getRegularizedPosition(const SH3::Cell& aPointel)
     {
       ASSERT_MSG(myInit, "The init() method must be called first.");
       ASSERT_MSG(myK.uDim(aPointel) == 0, "The cell must be a pointel (0-cell)");
@@ -367,6 +407,15 @@ namespace DGtal
       return mySurfelIndex;
     }
     
+    /**
+     * @return the statistics (learning rate, energy, gradient norm and
+     * time) of each step of the last call to regularize().
+     */
+    const std::vector<IterationStatistics> & getIterationStatistics() const
+    {
+      return myStatistics;
+    }
+    
     /**
      * Reset the regularized vertices positions to the original one.
      * @note the init() method must have been called.
@@ -411,6 +460,17 @@ namespace DGtal
      */
     void cacheInit();
     
+    /**
+     * Computes the energy gradient vector and returns the energy value,
+     * with constant or local weights.
+     *
+     * @tparam localWeights if true, uses the weights given to
+     * init(alphas,betas,gammas), otherwise uses the constant ones.
+     * @return the energy value.
+     */
+    template <bool localWeights>
+    double computeGradientTerms();
+    
     
     // ------------------------- Private Datas --------------------------------
   private:
@@ -453,13 +513,16 @@ namespace DGtal
     ///Gradient of the energy w.r.t. vertex positons
     Positions myGradient;
     
-    
+    ///Statistics of the steps of the last regularization
+    std::vector<IterationStatistics> myStatistics;
   
     // ---------------------------------------------------------------
     ///Internal members to store precomputed topological informations
     
-    ///Gradient of the quad alignement w.r.t. vertex positons
-    Positions myGradientAlign;
+    ///Align gradient accumulated per pointel. With OpenMP, it stores
+    ///instead the contributions of each surfel to its 4 pointels, sorted
+    ///by pointel (see myPointelAlignOffsets and myAlignSlots)
+    Positions myAlignGradients;
     
     ///Instance of the KSpace
     SH3::KSpace myK;
@@ -479,8 +542,15 @@ namespace DGtal
     std::vector< SH3::Cell > myAlignPointels;
     ///Number of adjacent edges to pointels
     std::vector<unsigned char> myNumberAdjEdgesToPointel;
+    ///For each pointel p, the range [myPointelAlignOffsets[p], myPointelAlignOffsets[p+1])
+    ///of myAlignGradients stores the contributions of its surfels (in increasing surfel order)
+    std::vector< std::size_t > myPointelAlignOffsets;
+    ///For each entry of myAlignPointelsIdx, its slot in myAlignGradients
+    std::vector< std::size_t > myAlignSlots;
     ///Indices of cells foor the Fairness term
     std::vector< SH3::Idx > myFairnessPointelsIdx;
+    ///Offset of each face in myFairnessPointelsIdx
+    std::vector< std::size_t > myFairnessOffsets;
     ///Number of adjacent faces to given vertex
     std::vector< unsigned char > myNbAdjacent;
     ///All faces of the dual digital surfacce
@@ -495,9 +565,9 @@ namespace DGtal
    * @param object the object of class 'DigitalSurfaceRegularization' to write.
    * @return the output stream after the writing.
    */
-  template <typename T>
+  template <typename T, typename TScalar>
   std::ostream&
-  operator<< ( std::ostream & out, const DigitalSurfaceRegularization<T> & object );
+  operator<< ( std::ostream & out, const DigitalSurfaceRegularization<T, TScalar> & object );
   
   } // namespace surfaces
 
@@ -41,8 +41,10 @@
 //////////////////////////////////////////////////////////////////////////////
 // Inclusions
 #include <iostream>
+#include <limits>
 #include "DGtal/base/Common.h"
 #include "DGtal/base/ConstAlias.h"
+#include "DGtal/base/Clock.h"
 #include "DGtal/topology/CanonicSCellEmbedder.h"
 #include "DGtal/topology/IndexedDigitalSurface.h"
 #include "DGtal/topology/DigitalSurface2DSlice.h"
@@ -64,12 +66,20 @@ namespace DGtal {
   ///
   /// @note This method is limited to \b closed digital surfaces.
   ///
+  /// If DGtal is built with OpenMP (WITH_OPENMP), each optimization
+  /// step updates all vertices in parallel. Random perturbations are
+  /// drawn sequentially beforehand, so that the result does not
+  /// depend on the number of threads.
+  ///
   /// @tparam TDigitalSurfaceContainer any digital surface container
   /// (a model concepts::CDigitalSurfaceContainer), for instance a
   /// SetOfSurfels.
   ///
+  /// @tparam TScalar the scalar type of vertex positions and
+  /// displacements (double or float, default is double).
+  ///
   /// @see testShroudsRegularization.cpp
-  template <typename TDigitalSurfaceContainer>
+  template <typename TDigitalSurfaceContainer, typename TScalar = double>
   class ShroudsRegularization
   {
     BOOST_CONCEPT_ASSERT
@@ -77,12 +87,12 @@ namespace DGtal {
     
   public:
     typedef TDigitalSurfaceContainer           Container;
-    typedef ShroudsRegularization< Container > Self;
+    typedef ShroudsRegularization< Container, TScalar > Self;
     typedef typename Container::KSpace         KSpace;
     typedef typename KSpace::Space             Space;
-    typedef typename Space::RealVector         RealVector;
-    typedef typename Space::RealPoint          RealPoint;
-    typedef typename RealVector::Component     Scalar;
+    typedef PointVector< Space::dimension, TScalar > RealVector;
+    typedef RealVector                         RealPoint;
+    typedef TScalar                            Scalar;
     typedef IndexedDigitalSurface< Container > IdxDigitalSurface;
     typedef typename IdxDigitalSurface::Vertex IdxVertex;
     typedef typename IdxDigitalSurface::Surfel IdxSurfel;
@@ -94,6 +104,22 @@ namespace DGtal {
 
     /// The enum class specifying the possible shrouds regularization.
     enum class Regularization { AREA, SNAKE, SQUARED_CURVATURE };
+
+    /// Statistics of one optimization step of \ref regularize.
+    struct IterationStatistics
+    {
+      /// the step number
+      int    iteration;
+      /// the \f$ l_\infty \f$-norm of vertex displacements
+      double loo;
+      /// the \f$ l_2 \f$-norm of vertex displacements
+      double l2;
+      /// the energy after the step, or NaN if not computed (see
+      /// \ref setEnergyStatistics).
+      double energy;
+      /// the time spent in this step (in ms)
+      double time;
+    };
     
     // ----------------------- Standard services ------------------------------
   public:
@@ -102,7 +128,8 @@ namespace DGtal {
     
     /// Default constructor. The object is not valid.
     ShroudsRegularization()
-      : myPtrIdxSurface( nullptr ), myPtrK( nullptr )
+      : myPtrIdxSurface( nullptr ), myPtrK( nullptr ),
+	myEnergyStatistics( false )
     {}
     
     /// Constructor from (closed) \a surface.
@@ -113,7 +140,8 @@ namespace DGtal {
     ShroudsRegularization( CountedPtr< IdxDigitalSurface > surface )
       : myPtrIdxSurface( surface ),
 	myPtrK( &surface->container().space() ),
-	myEpsilon( 0.0001 ), myAlpha( 1.0 ), myBeta( 1.0 )
+	myEpsilon( 0.0001 ), myAlpha( 1.0 ), myBeta( 1.0 ),
+	myEnergyStatistics( false )
     {
       precomputeTopology();
       init();
@@ -141,8 +169,8 @@ namespace DGtal {
 	{
 	  const auto s = myPtrIdxSurface->surfel( v );
 	  const auto k = myPtrK->sOrthDir( s );
-	  myInsV[ v ]  = embedder( myPtrK->sDirectIncident( s, k ) );
-	  myOutV[ v ]  = embedder( myPtrK->sIndirectIncident( s, k ) );
+	  myInsV[ v ]  = RealPoint( embedder( myPtrK->sDirectIncident( s, k ) ) );
+	  myOutV[ v ]  = RealPoint( embedder( myPtrK->sIndirectIncident( s, k ) ) );
 	}
     }
 
@@ -168,6 +196,16 @@ namespace DGtal {
     {
       return std::make_tuple( myEpsilon, myAlpha, myBeta );
     }
+
+    /// Tells if \ref regularize computes the energy after each step
+    /// and stores it in its statistics. This costs about one more
+    /// optimization step per step, hence it is disabled by default.
+    ///
+    /// @param enable when 'true', the energy is computed at each step.
+    void setEnergyStatistics( bool enable )
+    {
+      myEnergyStatistics = enable;
+    }
     
     /// @}
     
@@ -181,7 +219,8 @@ namespace DGtal {
     /// @return the position of vertex v for this parameter t.
     RealPoint position( const Vertex v, const double t ) const
     {
-      return (1-t) * myInsV[ v ] + t * myOutV[ v ];
+      const Scalar st = t;
+      return (1-st) * myInsV[ v ] + st * myOutV[ v ];
     }
     
     /// @param v any valid vertex.
@@ -196,8 +235,12 @@ namespace DGtal {
     RealPoints positions() const
     {
       RealPoints result( myT.size() );
-      for ( Vertex v = 0; v < myT.size(); ++v )
-	result[ v ] = position( v );
+      const long long nbV = (long long) myT.size();
+#ifdef WITH_OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+      for ( long long v = 0; v < nbV; ++v ) //MSVC requires signed type for openmp
+	result[ v ] = position( (Vertex) v );
       return result;
     }
 
@@ -232,6 +275,13 @@ namespace DGtal {
       return std::make_pair( vp, ip );
     }
     
+    /// @return the statistics (displacements, energy and time) of
+    /// each step of the last call to \ref regularize.
+    const std::vector< IterationStatistics >& getIterationStatistics() const
+    {
+      return myStatistics;
+    }
+    
     /// @}
 
     // ----------------------- Geometric services ------------------------------
@@ -242,17 +292,20 @@ namespace DGtal {
     /// Computes the distances between the vertices along slices.
     void parameterize()
     {
-      Scalar d = 0.0;
-      // Vertex n = 0;
+      const long long nbV = (long long) myT.size();
       for ( Dimension i = 0; i < 3; ++i )
-	for ( Vertex v = 0; v < myT.size(); ++v )
+      {
+#ifdef WITH_OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+	for ( long long sv = 0; sv < nbV; ++sv ) //MSVC requires signed type for openmp
 	  {
+	    const Vertex v = (Vertex) sv;
 	    if ( myNext[ i ][ v ] == myInvalid )  continue; // not a valid slice
 	    myNextD[ i ][ v ] = ( position( myNext[ i ][ v ] ) - position( v ) ).norm();
 	    myPrevD[ i ][ v ] = ( position( myPrev[ i ][ v ] ) - position( v ) ).norm();
-	    d += myNextD[ i ][ v ];
-	    //	    n += 1;
 	  }
+      }
     }
 
     /// @param v_i a pair (vertex,tangent direction)
@@ -297,6 +350,9 @@ namespace DGtal {
     ///
     /// @param maxNb the maximum number of optimization steps.
     ///
+    /// The statistics of each step are available afterwards with
+    /// \ref getIterationStatistics.
+    ///
     /// @see oneStepAreaMinimization
     /// @see oneStepSnakeMinimization
     /// @see oneStepSquaredCurvatureMinimization
@@ -311,13 +367,19 @@ namespace DGtal {
       int     nb      = 0;
       double   r      = 0.5;
       (void)randomization; //parameter not used, avoiding warning
+      Clock c;
+      myStatistics.clear();
       do {
+	c.startClock();
 	std::tie( loo, l2 ) =
 	  reg == Regularization::SQUARED_CURVATURE
 	  ? oneStepSquaredCurvatureMinimization( r )
 	  : reg == Regularization::SNAKE
 	  ? oneStepSnakeMinimization( myAlpha, myBeta, r )
 	  : oneStepAreaMinimization( r );
+	const double t = c.stopClock();
+	myStatistics.push_back( { nb, loo, l2, myEnergyStatistics
+	      ? energy( reg ) : std::numeric_limits<double>::quiet_NaN(), t } );
 	if ( nb % 50 == 0 )
 	  trace.info() << "[Shrouds iteration " << nb
 		       << " E=" << energy( reg )
@@ -465,6 +527,27 @@ namespace DGtal {
     /// Forces t to stay in ]0,1[
     void enforceBounds();
 
+    /// Draws the random perturbations of the vertices for one
+    /// optimization step, in vertex order.
+    ///
+    /// @param randomization the amplitude of the perturbations.
+    /// @return the perturbation of each vertex.
+    std::vector<double> randomPerturbations( const double randomization ) const;
+
+    /// Moves the vertices toward their optimal displacement (damping
+    /// between old and new displacements) and computes the norms of
+    /// vertex displacements.
+    ///
+    /// @param newT the optimal displacement of each vertex.
+    /// @param wNew the weight of the optimal displacement.
+    /// @param wOld the weight of the old displacement.
+    ///
+    /// @return the pair of \f$ l_\infty \f$ and \f$ l_2 \f$ norms of
+    /// vertex displacements.
+    std::pair<double,double> updateDisplacements( const Scalars& newT,
+						  const double wNew,
+						  const double wOld );
+
     /// @}
     
     // -------------------------- internal methods ------------------------------
@@ -542,6 +625,10 @@ namespace DGtal {
     Scalar                             myAlpha;
     /// The beta parameter for Snake second order regularization (~ curvature)
     Scalar                             myBeta;
+    /// When 'true', \ref regularize computes the energy after each step.
+    bool                               myEnergyStatistics;
+    /// the statistics of each step of the last regularization.
+    std::vector< IterationStatistics > myStatistics;
     /// the index of the invalid vertex.
     Vertex                             myInvalid;
     /// the vector of vertex displacements along their dual edge (each
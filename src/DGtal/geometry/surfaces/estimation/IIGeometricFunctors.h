@@ -523,6 +523,98 @@ namespace DGtal {
       mutable RealVector eigenValues;
     }; // end of class IIPrincipalCurvaturesAndDirectionsFunctor
 
+    /////////////////////////////////////////////////////////////////////////////
+    // template class IINormalCurvaturesAndDirections3DFunctor
+    /**
+    * Description of template class
+    * 'IINormalCurvaturesAndDirections3DFunctor' <p> \brief Aim: A functor
+    * Matrix -> std::tuple<RealVector,Real,Real,RealVector,RealVector> that
+    * returns the normal direction, the first and second principal
+    * curvatures and the first and second principal directions, with
+    * only one diagonalization of the given covariance matrix. It gathers
+    * IINormalDirectionFunctor and IIPrincipalCurvaturesAndDirectionsFunctor,
+    * so that several quantities may be estimated in one pass over the
+    * surfels. This functor is valid only for 3D space.
+    *
+    * @tparam TSpace a model of CSpace, for instance SpaceND.
+    * @tparam TMatrix a model of CMatrix, for instance SimpleMatrix.
+    *
+    * @see IntegralInvariantCovarianceEstimator
+    */
+    template  <typename TSpace,
+               typename TMatrix=SimpleMatrix< typename TSpace::RealVector::Component, TSpace::dimension,
+               TSpace::dimension> >
+    class IINormalCurvaturesAndDirections3DFunctor
+    {
+      // ----------------------- Standard services ------------------------------
+    public:
+      typedef IINormalCurvaturesAndDirections3DFunctor<TSpace> Self;
+      typedef TSpace Space;
+      typedef typename Space::RealVector RealVector;
+      typedef typename RealVector::Component Component;
+      typedef TMatrix Matrix;
+      typedef Matrix Argument;
+      typedef std::tuple<RealVector, double, double, RealVector, RealVector> Quantity;
+      typedef Quantity Value;
+
+      BOOST_CONCEPT_ASSERT(( concepts::CMatrix<Matrix> ));
+      BOOST_CONCEPT_ASSERT(( concepts::CSpace<TSpace> ));
+      BOOST_STATIC_ASSERT(( Space::dimension == 3 ));
+
+      /**
+      * Apply operator.
+      * @param arg any symmetric positive matrix (covariance matrix
+      *
+      * @return the normal direction (eigenvector associated with the
+      * smallest eigenvalue), the principal curvature values and the
+      * principal directions in a std::tuple.
+      */
+      Value operator()( const Argument& arg ) const
+      {
+        Argument cp_arg = arg;
+        cp_arg *= dh5;
+        EigenDecomposition<Space::dimension, Component, Matrix>
+          ::getEigenDecomposition( cp_arg, eigenVectors, eigenValues );
+
+        ASSERT ( !std::isnan(eigenValues[0]) ); // NaN
+        ASSERT ( (std::abs(eigenValues[0]) <= std::abs(eigenValues[1]))
+                && (std::abs(eigenValues[1]) <= std::abs(eigenValues[2])) );
+
+        Quantity res(eigenVectors.column( 0 ),
+                     d6_PIr6 * ( eigenValues[2] - ( 3.0 * eigenValues[1] )) + d8_5r,
+                     d6_PIr6 * ( eigenValues[1] - ( 3.0 * eigenValues[2] )) + d8_5r,
+                     eigenVectors.column( 1 ),
+                     eigenVectors.column( 2 ));
+        return res;
+      }
+
+      /**
+      * Initializes the functor with the gridstep and the ball
+      * Euclidean radius.
+      *
+      * @param h the gridstep
+      * @param r the ball radius
+      */
+      void init( Component h , Component  r )
+      {
+        double r3 = r * r * r;
+        double r6 = r3 * r3;
+        d6_PIr6 = 6.0 / ( M_PI * r6 );
+        d8_5r = 8.0 / ( 5.0 * r );
+        double h2 = h * h;
+        dh5 = h2 * h2 * h;
+      }
+
+    private:
+      double dh5;
+      double d6_PIr6;
+      double d8_5r;
+      /// A data member only used for temporary calculations.
+      mutable Matrix eigenVectors;
+      /// A data member only used for temporary calculations.
+      mutable RealVector eigenValues;
+    }; // end of class IINormalCurvaturesAndDirections3DFunctor
+
     /////////////////////////////////////////////////////////////////////////////
     // template class IICurvatureFunctor
     /**
@@ -42,6 +42,7 @@
 // Inclusions
 #include <iostream>
 #include <unordered_map>
+#include <vector>
 #include "DGtal/base/Common.h"
 #include "DGtal/geometry/surfaces/DigitalSurfacePredicate.h"
 #include "DGtal/geometry/surfaces/estimation/MaximalSegmentSliceEstimation.h"
@@ -64,6 +65,15 @@ namespace DGtal
    * @tparam TSurface the digital surface type.
    * @tparam TInternalProbingAlgorithm the probing algorithm (see \ref PlaneProbingTetrahedronEstimator or PlaneProbingParallelepipedEstimator).
    *
+   * The estimation over a range of surfels is done in parallel if
+   * DGtal has been built with OpenMP support (WITH_OPENMP flag set
+   * to "true"). In this case, each thread builds only one probing
+   * algorithm with the probing factory, and then resets it
+   * (see PlaneProbingTetrahedronEstimator::reset) on each surfel.
+   * The probing factory is thus expected to build an algorithm whose
+   * initial frame is given by the base point \a p and the vectors
+   * \a b1, \a b2, \a normal of the probing frame.
+   *
    * \b Models: A PlaneProbingDigitalSurfaceLocalEstimator is a model of concepts::CSurfelLocalEstimator and concepts::CDigitalSurfaceLocalEstimator.
    */
   template <typename TSurface, typename TInternalProbingAlgorithm>
@@ -220,7 +230,10 @@ namespace DGtal
     Quantity eval (SurfelConstIterator it);
 
     /**
-     * Estimates the quantity on a range of surfels.
+     * Estimates the quantity on a range of surfels. If DGtal has been
+     * built with OpenMP support, surfels are processed in parallel
+     * and every thread reuses the same probing algorithm.
+     * Pre-estimations computed on the way are cached as in \ref eval(SurfelConstIterator).
      *
      * @param itb an iterator on the start of the range of surfels.
      * @param ite a past-the-end iterator of the range of surfels.
@@ -303,6 +316,19 @@ namespace DGtal
      */
     ProbingFrame probingFrameFromSurfel (Surfel const& aSurfel) const;
 
+    /**
+     * Estimates the normal vector on a surfel, given its pre-estimation.
+     * If \a aAlgorithm is null, a new probing algorithm is built with
+     * the probing factory, otherwise it is reset to the new frame.
+     *
+     * @param aAlgorithm (in/out) a pointer on a probing algorithm, possibly null.
+     * @param aSurfel a surfel.
+     * @param aPreEstimation the pre-estimation vector on \a aSurfel.
+     * @return the estimated normal.
+     */
+    Quantity evalWithAlgorithm (InternalProbingAlgorithm*& aAlgorithm,
+                                Surfel const& aSurfel, RealPoint const& aPreEstimation) const;
+
     /**
      * Tries to build a probing frame matching an initial pre-estimated normal vector:
      * the octant of the frame should coincide with the pre-estimation.
@@ -368,16 +394,17 @@ namespace DGtal
     /**
      * Computes the estimated normal when we detected that one direction of the space was flat.
      *
+     * @param aAlgorithm the probing algorithm that has been run.
      * @param aIndex an integer between 0 and 2.
      * @return the estimated normal.
      */
-    Point getNormalOneFlatDirection (int aIndex) const
+    static Point getNormalOneFlatDirection (InternalProbingAlgorithm const& aAlgorithm, int aIndex)
     {
         int im1 = (aIndex - 1 + 3) % 3,
             im2 = (aIndex - 2 + 3) % 3;
 
-        return myProbingAlgorithm->m(im1).crossProduct(myProbingAlgorithm->m(aIndex)) +
-            myProbingAlgorithm->m(aIndex).crossProduct(myProbingAlgorithm->m(im2));
+        return aAlgorithm.m(im1).crossProduct(aAlgorithm.m(aIndex)) +
+            aAlgorithm.m(aIndex).crossProduct(aAlgorithm.m(im2));
     }
   }; // end of class PlaneProbingDigitalSurfaceLocalEstimator
 
@@ -180,6 +180,16 @@ namespace DGtal
 
     // ----------------------- Plane Probing services ------------------------------
   public:
+    /**
+     * Resets the estimator to a new initial frame. The predicate, the
+     * bound and the internal tetrahedron estimator are kept, so that no
+     * memory is allocated and the same estimator can be reused on many frames.
+     *
+     * @param aPoint the base point of the new initial frame.
+     * @param aM the three vectors of the new initial frame.
+     */
+    void reset (Point const& aPoint, Triangle const& aM);
+
     /**
      * @param aIndex the index of the vector (between 0 and 2).
      * @return the i-th height vector \f$ m_i \f$.
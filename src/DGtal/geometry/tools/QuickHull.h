@@ -45,6 +45,10 @@
 #include <vector>
 #include <queue>
 #include <set>
+#include <algorithm>
+#ifdef WITH_OPENMP
+#include <omp.h>
+#endif
 #include "DGtal/base/Common.h"
 #include "DGtal/base/Clock.h"
 #include "DGtal/geometry/tools/QuickHullKernels.h"
@@ -154,6 +158,22 @@ namespace DGtal
     /// Label for points that are not assigned to any facet.
     enum { UNASSIGNED = (Index) -1 };
 
+    /// Minimal number of points processed in one loop to use several
+    /// threads (with OpenMP).
+    static const Size PARALLEL_MIN_SIZE = 4096;
+
+    /// The phases of the convex hull computation whose timings are
+    /// accumulated in QuickHull::phase_timings.
+    enum TimingPhase {
+      ChunkHulls = 0,    ///< hulls of spatial chunks (filterInputByChunks)
+      InitialAssignment, ///< assignment of points to the initial simplex facets
+      FurthestPoints,    ///< search of the furthest point of processed facets
+      VisibleFacets,     ///< extraction of visible facets and horizon ridges
+      NewFacets,         ///< creation and linking of new facets
+      PointAssignment,   ///< assignment of outside points to new facets
+      NbTimingPhases
+    };
+
     /// A facet is d-1 dimensional convex cell lying on the boundary
     /// of a full dimensional convex set. Its supporting hyperplane
     /// defines an half-space touching and enclosing the convex set.
@@ -257,7 +277,8 @@ namespace DGtal
     /// @param[in] K a kernel for computing facet geometries.
     /// @param[in] dbg the trace level, from 0 (no) to 3 (very verbose).
     QuickHull( const Kernel& K = Kernel(), int dbg = 0 )
-      : kernel( K ), debug_level( dbg ), myStatus( Status::Uninitialized )
+      : kernel( K ), debug_level( dbg ), nb_threads( 0 ),
+        phase_timings( NbTimingPhases, 0.0 ), myStatus( Status::Uninitialized )
     {}
 
     /// @return the current status of this object, in Uninitialized,
@@ -280,6 +301,7 @@ namespace DGtal
       p2v.clear();
       v2p.clear();
       timings.clear();
+      phase_timings.assign( NbTimingPhases, 0.0 );
     }
 
     
@@ -316,6 +338,8 @@ namespace DGtal
       // std::vector< double > timings;
       M += sizeof( std::vector< double > )
         + timings.capacity() * sizeof( double );
+      M += sizeof( std::vector< double > )
+        + phase_timings.capacity() * sizeof( double );
       return M;
     }
 
@@ -428,6 +452,94 @@ namespace DGtal
       return false;
     }
 
+    /// Removes from the input points the ones that cannot be vertices
+    /// of the convex hull, in order to speed up its computation for
+    /// large point sets. Points are split into \a nb_chunks slabs
+    /// along the axis of largest extent, and the convex hulls of the
+    /// slabs are computed in parallel (with OpenMP). Only the points
+    /// lying on their facets are kept, since the convex hull of the
+    /// input is the convex hull of these points.
+    ///
+    /// @pre status() must be Status::InputInitialized
+    ///
+    /// @param[in] nb_chunks the number of slabs, or 0 to use four
+    /// slabs per thread.
+    ///
+    /// @return the number of removed points.
+    ///
+    /// @note Removed input points are mapped to UNASSIGNED in
+    /// input2comp. The output facets and vertices are the same as
+    /// without filtering, but points lying on facets without being
+    /// vertices may be absent from the facet `on_set`s.
+    Size filterInputByChunks( Size nb_chunks = 0 )
+    {
+      if ( status() != Status::InputInitialized ) return 0;
+      if ( nb_chunks == 0 ) nb_chunks = 4 * nbThreads();
+      const Size n = points.size();
+      if ( nb_chunks < 2 || n < 2 * nb_chunks * ( dimension + 1 ) ) return 0;
+      Clock tic;
+      tic.startClock();
+      // Splits points into slabs along the axis of largest extent.
+      Point l = points[ 0 ];
+      Point u = points[ 0 ];
+      for ( const auto& p : points ) {
+        l = l.inf( p );
+        u = u.sup( p );
+      }
+      Dimension axis = 0;
+      for ( Dimension k = 1; k < dimension; k++ )
+        if ( u[ k ] - l[ k ] > u[ axis ] - l[ axis ] ) axis = k;
+      const double lo = NumberTraits< Scalar >::castToDouble( l[ axis ] );
+      const double  w = NumberTraits< Scalar >::castToDouble( u[ axis ] ) - lo + 1.0;
+      std::vector< IndexRange > chunks( nb_chunks );
+      for ( Index i = 0; i < n; i++ ) {
+        const double x = NumberTraits< Scalar >::castToDouble( points[ i ][ axis ] );
+        const Index  c = Index( ( x - lo ) * double( nb_chunks ) / w );
+        chunks[ std::min( c, nb_chunks - 1 ) ].push_back( i );
+      }
+      // Keeps the points on the facets of each slab hull, or all the
+      // points of a slab that is not full dimensional.
+      std::vector< char > keep( n, 0 );
+#ifdef WITH_OPENMP
+#pragma omp parallel for schedule(dynamic, 1) num_threads( nbThreads() )
+#endif
+      for ( long c = 0; c < (long) nb_chunks; c++ ) { //MSVC requires signed type for openmp
+        const IndexRange& C = chunks[ c ];
+        QuickHull chunk_hull( kernel );
+        chunk_hull.nb_threads = 1;
+        chunk_hull.points.resize( C.size() );
+        for ( Index j = 0; j < C.size(); j++ ) chunk_hull.points[ j ] = points[ C[ j ] ];
+        bool ok = chunk_hull.points.size() > dimension;
+        if ( ok ) {
+          chunk_hull.myStatus = Status::InputInitialized;
+          ok = chunk_hull.computeConvexHull( Status::FacetsCompleted );
+        }
+        if ( ok ) {
+          for ( const auto& F : chunk_hull.facets )
+            for ( auto v : F.on_set ) keep[ C[ v ] ] = 1;
+        }
+        else for ( auto v : C ) keep[ v ] = 1;
+      }
+      // Removes the other points and updates mappings.
+      IndexRange renumbering( n, UNASSIGNED );
+      Index j = 0;
+      for ( Index i = 0; i < n; i++ )
+        if ( keep[ i ] ) {
+          renumbering[ i ] = j;
+          points    [ j ] = points    [ i ];
+          comp2input[ j ] = comp2input[ i ];
+          j++;
+        }
+      points.resize( j );
+      comp2input.resize( j );
+      for ( auto& c : input2comp ) c = renumbering[ c ];
+      phase_timings[ ChunkHulls ] += tic.stopClock();
+      if ( debug_level >= 1 )
+        trace.info() << "[QuickHull::filterInputByChunks] kept " << j << " / " << n
+                     << " points with " << nb_chunks << " chunks." << std::endl;
+      return n - j;
+    }
+
     /// @}
     // -------------------------- Convex hull services ----------------------------
   public:
@@ -822,8 +934,15 @@ namespace DGtal
     Size nb_finite_facets;
     /// Number of infinite facets (!= 0 only for specific kernels)
     Size nb_infinite_facets;
-    /// Timings of the different phases: 0: init, 1: facets, 2: vertices.
+    /// Number of threads used by parallel computations (with
+    /// OpenMP), 0 meaning the default number of OpenMP threads and 1
+    /// a sequential computation. Results do not depend on it.
+    int nb_threads;
+    /// Timings of the different phases: 0: input, 1: init, 2: facets, 3: vertices.
     std::vector< double > timings;
+    /// Accumulated timings (in ms) of the steps of the convex hull
+    /// computation, indexed by TimingPhase.
+    std::vector< double > phase_timings;
     /// Counts the number of facets with a given number of vertices.
     std::vector< Size > facet_counter;
     
@@ -844,12 +963,80 @@ namespace DGtal
     /// @name protected services
     /// @{
 
+    /// @return the number of threads used by parallel computations.
+    int nbThreads() const
+    {
+#ifdef WITH_OPENMP
+      return nb_threads > 0 ? nb_threads : omp_get_max_threads();
+#else
+      return 1;
+#endif
+    }
+
     /// @param F any valid facet
     /// @param p any point
     /// @return the height of p wrt F (0: on, >0: above ).
     InternalScalar height( const Facet& F, const Point& p ) const
     { return kernel.height( F.H, p ); }
 
+    /// @param F any valid facet with a non empty outside set.
+    /// @return the first point of the outside set of \a F with maximal height.
+    ///
+    /// @note Large outside sets are cut into one block per thread,
+    /// whose best points are then compared in order, hence the result
+    /// does not depend on the number of threads.
+    Index furthestPoint( const Facet& F ) const
+    {
+      const Size n  = F.outside_set.size();
+      const int  nt = ( n >= PARALLEL_MIN_SIZE ) ? nbThreads() : 1;
+      IndexRange                    best  ( nt );
+      std::vector< InternalScalar > best_h( nt );
+#ifdef WITH_OPENMP
+#pragma omp parallel for schedule(static, 1) num_threads( nt ) if( nt > 1 )
+#endif
+      for ( int t = 0; t < nt; t++ ) { //MSVC requires signed type for openmp
+        const Index b = n * t / nt;
+        const Index e = n * ( t + 1 ) / nt;
+        Index          bv = b;
+        InternalScalar bh = height( F, points[ F.outside_set[ b ] ] );
+        for ( Index i = b + 1; i < e; i++ ) {
+          const InternalScalar h = height( F, points[ F.outside_set[ i ] ] );
+          if ( h > bh ) { bh = h; bv = i; }
+        }
+        best  [ t ] = bv;
+        best_h[ t ] = bh;
+      }
+      int k = 0;
+      for ( int t = 1; t < nt; t++ )
+        if ( best_h[ t ] > best_h[ k ] ) k = t;
+      return F.outside_set[ best[ k ] ];
+    }
+
+    /// Assigns each point of \a pts to the first facet of \a
+    /// candidates it is above (or UNASSIGNED), in parallel for large
+    /// ranges, then appends it to the outside set of this facet, or
+    /// to processed_points if it is above none.
+    ///
+    /// @param[in] pts a range of point indices.
+    /// @param[in] candidates a range of valid facet indices.
+    void assignPoints( const IndexRange& pts, const IndexRange& candidates )
+    {
+      const Size n = pts.size();
+#ifdef WITH_OPENMP
+#pragma omp parallel for schedule(static) num_threads( nbThreads() ) if( n >= PARALLEL_MIN_SIZE )
+#endif
+      for ( long j = 0; j < (long) n; j++ ) { //MSVC requires signed type for openmp
+        const Index v = pts[ j ];
+        Index a = UNASSIGNED;
+        for ( auto f : candidates )
+          if ( above( facets[ f ], points[ v ] ) ) { a = f; break; }
+        assignment[ v ] = a;
+      }
+      for ( auto v : pts )
+        if ( assignment[ v ] == UNASSIGNED ) processed_points.push_back( v );
+        else facets[ assignment[ v ] ].outside_set.push_back( v );
+    }
+
     /// @param F any valid facet
     /// @param p any point
     /// @return 'true' iff p is above F.
@@ -998,15 +1185,11 @@ namespace DGtal
       }
       if ( facet.outside_set.empty() ) return true;
       // Selects furthest vertex
-      Index  furthest_v = facet.outside_set[ 0 ];
-      auto   furthest_h = height( facet, points[ furthest_v ] );
-      for ( Index v = 1; v < facet.outside_set.size(); v++ ) {
-        auto h = height( facet, points[ facet.outside_set[ v ] ] );
-        if ( h > furthest_h ) {
-          furthest_h = h;
-          furthest_v = facet.outside_set[ v ];
-        }
-      }
+      Clock tic;
+      tic.startClock();
+      const Index furthest_v = furthestPoint( facet );
+      phase_timings[ FurthestPoints ] += tic.stopClock();
+      tic.startClock();
       const Point& p = points[ furthest_v ];
       // Extracts Visible facets V and Horizon Ridges H
       std::vector< Index > V;   // visible facets
@@ -1028,6 +1211,8 @@ namespace DGtal
           M.insert( N );
         }
       } // while ( ! E.empty() ) 
+      phase_timings[ VisibleFacets ] += tic.stopClock();
+      tic.startClock();
       if ( debug_level >= 1 ) {
         trace.info() << "#Visible=" << V.size() << " #Horizon=" << H.size()
                   << " furthest_v=" << furthest_v << std::endl;
@@ -1091,38 +1276,26 @@ namespace DGtal
                 makeNeighbors( nfi, nfj );
             }
         }
+      phase_timings[ NewFacets ] += tic.stopClock();
+      tic.startClock();
       // Extracts all outside points from visible facets V
       IndexRange outside_pts;
       for ( auto&& vf : V ) {
         for ( auto&& v : facets[ vf ].outside_set ) {
-          if ( v != furthest_v ) {
-            outside_pts.push_back( v );
-            assignment[ v ] = UNASSIGNED;
-          }
+          if ( v != furthest_v ) outside_pts.push_back( v );
         }
       }
-      // For each new facet F'
-      for ( Index i = 0; i < new_facets.size(); i++ ) {
-        Facet& Fp = facets[ new_facets[ i ] ];
-        Index max_j = outside_pts.size();
-        for ( Index j = 0; j < max_j; ) {
-          const Index v = outside_pts[ j ];
-          if ( above( Fp, points[ v ] ) ) {
-            Fp.outside_set.push_back( v );
-            assignment[ v ]  = new_facets[ i ];
-            outside_pts[ j ] = outside_pts.back();
-            outside_pts.pop_back();
-            max_j--;
-          } else j++;
-        }
-        if ( debug_level >= 3 ) {
-          trace.info() << "- New facet " << new_facets[ i ] << " ";
-          Fp.display( trace.info() );
+      // Assigns each outside point to the first new facet F' it is
+      // above, other points are processed.
+      processed_points.push_back( furthest_v );
+      assignPoints( outside_pts, new_facets );
+      phase_timings[ PointAssignment ] += tic.stopClock();
+      if ( debug_level >= 3 ) {
+        for ( auto nf : new_facets ) {
+          trace.info() << "- New facet " << nf << " ";
+          facets[ nf ].display( trace.info() );
         }
       }
-      // Update processed points
-      processed_points.push_back( furthest_v );
-      for ( auto v : outside_pts ) processed_points.push_back( v );
       
       // Delete the facets in V
       for ( auto&& v : V ) {
@@ -1472,20 +1645,16 @@ namespace DGtal
           for ( auto&& v : isimplex ) facets[ j ].on_set.push_back( v );
           std::sort( facets[ j ].on_set.begin(), facets[ j ].on_set.end() );
         }
-      // List of unassigned vertices
-      for ( Index fi = 0; fi < facets.size(); ++fi ) {
-        Facet& f = facets[ fi ];
-        for ( Index v = 0; v < points.size(); v++ )
-          {
-            if ( assignment[ v ] == UNASSIGNED && above( f, points[ v ] ) ) {
-              f.outside_set.push_back( v );
-              assignment[ v ] = fi;
-            } 
-          }
-      }
-      for ( Index v = 0; v < points.size(); v++ )
-        if ( assignment[ v ] == UNASSIGNED )
-          processed_points.push_back( v );
+      // Assigns each point to the first facet it is above, or lists
+      // it as processed.
+      Clock tic;
+      tic.startClock();
+      IndexRange all_points( points.size() );
+      IndexRange all_facets( facets.size() );
+      for ( Index v = 0; v < points.size(); v++ ) all_points[ v ] = v;
+      for ( Index f = 0; f < facets.size(); f++ ) all_facets[ f ] = f;
+      assignPoints( all_points, all_facets );
+      phase_timings[ InitialAssignment ] += tic.stopClock();
       
       // Display some information
       if ( debug_level >= 2 ) {
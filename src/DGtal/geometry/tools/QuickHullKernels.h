@@ -44,6 +44,8 @@
 #include <string>
 #include <vector>
 #include <array>
+#include <cmath>
+#include <limits>
 #include "DGtal/base/Common.h"
 #include "DGtal/kernel/CInteger.h"
 #include "DGtal/kernel/NumberTraits.h"
@@ -121,9 +123,9 @@ namespace DGtal
       }
       if ( ! remove_duplicates ) {
         output_values.swap( input );
-        input2output.resize( input.size() );
-        output2input.resize( input.size() );
-        for ( Size i = 0; i < input.size(); ++i )
+        input2output.resize( output_values.size() );
+        output2input.resize( output_values.size() );
+        for ( Size i = 0; i < output_values.size(); ++i )
           input2output[ i ] = output2input[ i ] = i;
       }
       else {
@@ -478,6 +480,175 @@ namespace DGtal
 
   }; //   template < Dimension dim >  struct ConvexHullIntegralKernel {
 
+  /////////////////////////////////////////////////////////////////////////////
+  // template class ConvexHullFilteredKernel
+  /**
+     Description of template class 'ConvexHullFilteredKernel' <p>
+     \brief Aim: a geometric kernel to compute the convex hull of
+     digital points with integer-only arithmetic, whose above/below
+     plane tests are first evaluated in double precision.
+
+     Half-spaces are still computed exactly with TInternalInteger,
+     but they also store their normal and intercept as doubles. The
+     predicates `above`, `aboveOrOn` and `on` evaluate the height of
+     a point in double together with an upper bound of its rounding
+     error, and only fall back to the exact integer computation when
+     the sign of the height is not certain (e.g. for points lying on
+     the plane). Results are thus identical to
+     ConvexHullIntegralKernel, but tests are much cheaper when
+     TInternalInteger is a wide or arbitrary precision integer like
+     int128_t or BigInteger.
+
+     @see \ref moduleQuickHull
+
+     @tparam dim the dimension of the space of processed points.
+
+     @tparam TCoordinateInteger the integer type that represents
+     coordinates of lattice points, a model of concepts::CInteger.
+
+     @tparam TInternalInteger the integer type that is used for
+     internal computations of above/below plane tests, a model of
+     concepts::CInteger. Must be at least as precise as
+     TCoordinateInteger.
+  */
+  template < Dimension dim,
+             typename TCoordinateInteger  = DGtal::int64_t,
+             typename TInternalInteger = DGtal::int64_t >
+  struct ConvexHullFilteredKernel
+    : public ConvexHullIntegralKernel< dim, TCoordinateInteger, TInternalInteger >
+  {
+    typedef ConvexHullIntegralKernel< dim, TCoordinateInteger, TInternalInteger > Base;
+    // inheriting types
+    using typename Base::CoordinatePoint;
+    using typename Base::CoordinateVector;
+    using typename Base::CoordinateScalar;
+    using typename Base::InternalPoint;
+    using typename Base::InternalVector;
+    using typename Base::InternalScalar;
+    using typename Base::Size;
+    using typename Base::Index;
+    using typename Base::IndexRange;
+    using typename Base::CombinatorialPlaneSimplex;
+    typedef typename Base::HalfSpace ExactHalfSpace;
+    // inheriting constants
+    using Base::dimension;
+    // inheriting methods
+    using Base::normal;
+    using Base::intercept;
+    using Base::dot;
+    using Base::equal;
+    using Base::height;
+    using Base::volume;
+    using Base::hasInfiniteFacets;
+    using Base::isHalfSpaceFacetInfinite;
+    using Base::makeInput;
+    using Base::convertPointTo;
+
+    /// An exact half-space that also stores its approximation in
+    /// double precision.
+    class HalfSpace : public ExactHalfSpace {
+      friend struct ConvexHullFilteredKernel< dim, TCoordinateInteger, TInternalInteger >;
+      std::array< double, dim > dN; ///< the normal vector in double
+      double dc;                    ///< the intercept in double
+      HalfSpace( const ExactHalfSpace& H )
+        : ExactHalfSpace( H ), dc( NumberTraits< InternalScalar >::castToDouble
+                                   ( H.internalIntercept() ) )
+      {
+        for ( Dimension i = 0; i < dim; i++ )
+          dN[ i ] = NumberTraits< InternalScalar >::castToDouble( H.internalNormal()[ i ] );
+      }
+    public:
+      HalfSpace() = default;
+    };
+
+    /// Default constructor.
+    ConvexHullFilteredKernel() = default;
+
+    /// Computes an halfspace from dimension points specified by \a
+    /// simplex with vertices in a range \a vpoints of Point. It is
+    /// oriented such that the point of index \a idx_below is included
+    /// in the half-space (i.e. below).
+    ///
+    /// @param[in] vpoints a range of points over which the simplex is defined.
+    /// @param[in] simplex a range of dimension indices of points defining an hyperplane.
+    /// @param[in] idx_below the index of a p-oint that is below the hyperplane.
+    ///
+    /// @return the corresponding halfspace (has null normal vector if
+    /// simplex was not full dimensional)
+    HalfSpace
+    compute( const std::vector< CoordinatePoint >& vpoints,
+             const CombinatorialPlaneSimplex& simplex,
+             Index idx_below )
+    {
+      return HalfSpace( Base::compute( vpoints, simplex, idx_below ) );
+    }
+
+    /// Computes an halfspace from dimension points specified by \a
+    /// simplex with vertices in a range \a vpoints of
+    /// Point. Orientation is induced by the order of the points. If
+    /// the simplex is degenrated, the half-space is invalid and has
+    /// null normal.
+    ///
+    /// @param[in] vpoints a range of points over which the simplex is defined.
+    /// @param[in] simplex a range of dimension indices of points defining an hyperplane.
+    ///
+    /// @return the corresponding halfspace (has null normal vector if
+    /// simplex was not full dimensional)
+    HalfSpace
+    compute( const std::vector< CoordinatePoint >& vpoints,
+             const CombinatorialPlaneSimplex& simplex )
+    {
+      return HalfSpace( Base::compute( vpoints, simplex ) );
+    }
+
+    /// @param H the half-space
+    /// @param p any point
+    /// @return the sign (-1, 0 or 1) of the height of \a p wrt this plane.
+    int heightSign( const HalfSpace& H, const CoordinatePoint& p ) const
+    {
+      // Each product is computed with a relative error at most 3u
+      // (conversion of both factors and product) and the sum of
+      // dim+1 terms adds at most dim u relatively to the sum of
+      // their absolute values, u=2^-53. The bound below is twice
+      // this, so that its own rounding is also covered. Overflows
+      // give inf or nan and fail both tests.
+      double s = -H.dc;
+      double m = std::fabs( H.dc );
+      for ( Dimension i = 0; i < dim; i++ )
+        {
+          const double t = H.dN[ i ]
+            * NumberTraits< CoordinateScalar >::castToDouble( p[ i ] );
+          s += t;
+          m += std::fabs( t );
+        }
+      const double e = m * ( double( dim + 4 ) * std::numeric_limits<double>::epsilon() );
+      if ( s >  e ) return  1;
+      if ( s < -e ) return -1;
+      const InternalScalar h = height( H, p );
+      return ( h > 0 ) ? 1 : ( ( h < 0 ) ? -1 : 0 );
+    }
+
+    /// @param H the half-space
+    /// @param p any point
+    /// @return 'true' iff p is strictly above this plane (so in direction N ).
+    bool above( const HalfSpace& H, const CoordinatePoint& p ) const
+    { return heightSign( H, p ) > 0; }
+
+    /// @param H the half-space
+    /// @param p any point
+    /// @return 'true' iff p is above or lies on this plane (so in direction N ).
+    bool aboveOrOn( const HalfSpace& H, const CoordinatePoint& p ) const
+    { return heightSign( H, p ) >= 0; }
+
+    /// @param H the half-space
+    /// @param p any point
+    /// @return 'true' iff p lies on this plane.
+    bool on( const HalfSpace& H, const CoordinatePoint& p ) const
+    { return heightSign( H, p ) == 0; }
+
+  }; //   template < Dimension dim >  struct ConvexHullFilteredKernel {
+
+
 
   /////////////////////////////////////////////////////////////////////////////
   // template class DelaunayIntegralKernel
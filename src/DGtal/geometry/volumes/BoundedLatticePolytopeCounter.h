@@ -43,6 +43,8 @@
 // Inclusions
 #include <iostream>
 #include <map>
+#include <vector>
+#include <utility>
 #include "DGtal/kernel/IntegralIntervals.h"
 #include "DGtal/geometry/volumes/BoundedLatticePolytope.h"
 //////////////////////////////////////////////////////////////////////////////
@@ -60,6 +62,17 @@ namespace DGtal
      It is a model of boost::CopyConstructible,
      boost::DefaultConstructible, boost::Assignable. 
 
+     All the lattice points are enumerated row by row along some
+     axis. Consecutive rows share their dot products with the
+     constraints up to one increment, so that each row costs only one
+     pass over the constraints. Moreover, the constraints that hold on
+     a whole plane of rows are skipped for all these rows.
+
+     When OpenMP is available (WITH_OPENMP) and there are enough
+     rows, contiguous blocks of rows are processed in parallel, and
+     outputs are concatenated in the same order as in the sequential
+     case.
+
      @tparam TSpace an arbitrary model of CSpace.
    */
   template < typename TSpace >
@@ -88,6 +101,13 @@ namespace DGtal
 
     /// Internal type used to represent any lattice point set.
     using LatticeSetByIntervals = std::map< Point, Intervals >;
+
+    /// Flat type used to represent a convex lattice point set, as the
+    /// sequence of its non empty rows, sorted in the domain order.
+    using FlatLatticeSetByInterval = std::vector< std::pair< Point, Interval > >;
+
+    /// Under this number of rows, computations are sequential.
+    static const std::size_t PARALLEL_MIN_ROWS = 1024;
     
     /// Default constructor
     BoundedLatticePolytopeCounter() = default;
@@ -101,6 +121,15 @@ namespace DGtal
     /// @param ptrP any pointer on a polytope or nullptr.
     void init( const Polytope* ptrP );
 
+    /// Sets the number of threads used by counting and enumeration
+    /// services (only when WITH_OPENMP).
+    /// @param nb the number of threads, or 0 for the OpenMP default.
+    void setNbThreads( int nb ) { myNbThreads = nb; }
+
+    /// @return the number of threads used by counting and
+    /// enumeration services (1 without OpenMP).
+    int nbThreads() const;
+
     /// Computes the intersection of the lattice points of the
     /// infinite line going through point \a p along axis \a a and the
     /// current polytope, returned as an interval `[b,e)`, where `b`is
@@ -149,6 +178,17 @@ namespace DGtal
     /// @see longestAxis
     Integer countInteriorAlongAxis( Dimension a ) const;
 
+    /// Counts the lattice points inside the current polytope, but
+    /// stops as soon as \a max points are found (e.g. for convexity
+    /// tests, where one only needs to know if there are more points
+    /// than expected).
+    ///
+    /// @param max the maximum number of points that are counted.
+    /// @param a any axis with 0 <= a < d, where d is the dimension of the space.
+    /// @return the minimum of \a max and of the number of lattice
+    /// points inside the current polytope.
+    Integer countUpToAlongAxis( Integer max, Dimension a ) const;
+
     /// @param[out] pts the range of lattice points that are inside this polytope.
     /// @param a any axis with 0 <= a < d, where d is the dimension of the space.
     ///
@@ -177,6 +217,14 @@ namespace DGtal
     /// axis.
     LatticeSetByInterval getLatticeSet( Dimension a ) const;
 
+    /// @param a any axis with 0 <= a < d, where d is the dimension of the space.
+    ///
+    /// @return the set of lattice points within the current polytope,
+    /// represented as the sorted vector of its non empty rows along
+    /// axis \a a. The row points have a null \a a-th coordinate, as
+    /// in getLatticeSet.
+    FlatLatticeSetByInterval getFlatLatticeSet( Dimension a ) const;
+
     /// @param a any axis with 0 <= a < d, where d is the dimension of the space.
     ///
     /// @return the set of cells (as points with Khalimsky
@@ -206,6 +254,77 @@ namespace DGtal
     Point myLower;
     /// The upper point of the tight bounding box to the associated polytope. 
     Point myUpper;
+    /// The number of threads, or 0 for the OpenMP default.
+    int myNbThreads = 0;
+
+    // --------------------------- internals -----------------------------------
+  protected:
+
+    /// Computes the intersection interval of a row along axis \a a
+    /// from the dot products of the constraints with its first point.
+    ///
+    /// @param c any function giving the dot product of the k-th
+    /// constraint with the point of the row on the lower bound along \a a.
+    /// @param a any axis between 0 (included) and `dimension` (excluded).
+    /// @param interior when 'true', computes the intersection with the interior.
+    /// @return the interval `[b,e)` of intersection.
+    template < typename DotProducts >
+    Interval rowInterval( const DotProducts& c, Dimension a, bool interior ) const;
+
+    /// Restricts the interval `[x_min,x_max)` of a row along axis \a
+    /// a with the k-th constraint.
+    ///
+    /// @param k the index of the constraint.
+    /// @param c the dot product of the constraint with the point of
+    /// the row on the lower bound along \a a.
+    /// @param a any axis between 0 (included) and `dimension` (excluded).
+    /// @param interior when 'true', the constraint is strict.
+    /// @param[inout] x_min the lower bound of the interval.
+    /// @param[inout] x_max the upper bound (excluded) of the interval.
+    /// @return 'false' iff the interval becomes empty.
+    bool restrictRowInterval( Dimension k, const Integer& c, Dimension a, bool interior,
+                              Integer& x_min, Integer& x_max ) const;
+
+    /// @param a any axis between 0 (included) and `dimension` (excluded).
+    /// @return the number of rows along axis \a a in the bounding box.
+    std::size_t nbRows( Dimension a ) const;
+
+    /// @param a any axis between 0 (included) and `dimension` (excluded).
+    /// @param r any row index (the first axis other than \a a varies first).
+    /// @return the first point of the row \a r along axis \a a.
+    Point rowPoint( Dimension a, std::size_t r ) const;
+
+    /// @param nb_rows a number of rows.
+    /// @return the number of contiguous blocks of rows processed in parallel.
+    std::size_t nbRowBlocks( std::size_t nb_rows ) const;
+
+    /// Computes the intersection intervals of the rows \a first
+    /// (included) to \a last (excluded) along axis \a a, and calls
+    /// `f( p, I )` for each of them, where \a p is the first point of
+    /// the row and \a I its interval. The sweep stops as soon as \a
+    /// f returns 'false'.
+    ///
+    /// @param a any axis between 0 (included) and `dimension` (excluded).
+    /// @param interior when 'true', computes the intersections with the interior.
+    /// @param first the first row index.
+    /// @param last the row index after the last one.
+    /// @param f any function `( const Point&, const Interval& ) -> bool`.
+    template < typename RowFunction >
+    void sweepRows( Dimension a, bool interior,
+                    std::size_t first, std::size_t last, RowFunction& f ) const;
+
+    /// Counts the lattice points of the rows along axis \a a, in parallel.
+    /// @param a any axis between 0 (included) and `dimension` (excluded).
+    /// @param interior when 'true', counts the interior points.
+    /// @param max the count stops as soon as it reaches \a max (0 means never).
+    /// @return the number of points, or \a max if it is reached.
+    Integer countRows( Dimension a, bool interior, Integer max ) const;
+
+    /// Appends the lattice points of the rows along axis \a a, in parallel.
+    /// @param[inout] pts the range where the points are appended.
+    /// @param a any axis between 0 (included) and `dimension` (excluded).
+    /// @param interior when 'true', outputs the interior points.
+    void getRowPoints( PointRange& pts, Dimension a, bool interior ) const;
   };
 
 } // namespace DGtal
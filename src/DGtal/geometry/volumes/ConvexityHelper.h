@@ -43,6 +43,7 @@
 #include <iostream>
 #include <string>
 #include <vector>
+#include <type_traits>
 #include "DGtal/base/Common.h"
 #include "DGtal/kernel/CInteger.h"
 #include "DGtal/kernel/SpaceND.h"
@@ -181,7 +182,14 @@ namespace DGtal
     typedef std::size_t                      Index;
     typedef std::vector< Index >             IndexRange;
     typedef std::vector< Point >             PointRange;
-    typedef ConvexHullIntegralKernel< dim, Integer, InternalInteger >
+    /// The kernel used for lattice convex hulls. Above/below tests
+    /// are filtered in double precision when internal integers are
+    /// wider than 64 bits (e.g. int128_t or BigInteger).
+    typedef typename std::conditional
+    < std::is_integral< InternalInteger >::value
+      && ( sizeof( InternalInteger ) <= sizeof( DGtal::int64_t ) ),
+      ConvexHullIntegralKernel< dim, Integer, InternalInteger >,
+      ConvexHullFilteredKernel< dim, Integer, InternalInteger > >::type
     LatticeConvexHullKernel;
     typedef ConvexHullRationalKernel< dim, Integer, InternalInteger >
     RealConvexHullKernel;
@@ -387,6 +387,17 @@ namespace DGtal
     /// translation of X of one along direction \a i.
     PointRange U( Dimension i, const PointRange& X ) const;
 
+    /// Performs the digital Minkowski sum of \a X along direction \a
+    /// i and outputs it in \a Y, by merging \a X with its
+    /// translation (which keeps the lexicographic order). No memory
+    /// is allocated if \a Y has already enough capacity.
+    ///
+    /// @param i any valid dimension
+    /// @param X any \b sorted range of digital points
+    /// @param[out] Y the \b sorted range of digital points X union the
+    /// translation of X of one along direction \a i (must not be \a X).
+    void U( Dimension i, const PointRange& X, PointRange& Y ) const;
+
     /// Tells if a given point range \a X is digitally 0-convex,
     /// i.e. \f$ \mathrm{Cvxh}(X) \cap \mathbb{Z}^d = X \f$. It works
     /// for arbitrary set of points in arbitrary dimenion.
@@ -410,6 +421,25 @@ namespace DGtal
     /// @return 'true' iff \a X is fully digitally convex.
     bool isFullyConvex( const PointRange& X, bool convex0 = false ) const;
 
+    /// Tells if a given point range \a X is fully digitally
+    /// convex. Same as the method above, but the Minkowski sums of \a
+    /// X are stored in the given workspace, which is indexed by
+    /// direction bitmask. Reusing the same workspace for many small
+    /// sets (e.g. local neighborhoods) avoids reallocating these
+    /// point ranges at each call.
+    ///
+    /// @param X any range of \b pairwise \b distinct points
+    ///
+    /// @param convex0 when 'true' indicates that \a X is known to be
+    /// digitally 0-convex, otherwise the method will check it also.
+    ///
+    /// @param[inout] workspace the buffers for the Minkowski sums of
+    /// \a X, resized to \f$ 2^d \f$ ranges if needed.
+    ///
+    /// @return 'true' iff \a X is fully digitally convex.
+    bool isFullyConvex( const PointRange& X, bool convex0,
+                        std::vector< PointRange >& workspace ) const;
+
     /// Tells if a given point range \a X is fully digitally
     /// convex. The test uses the morphological characterization of
     /// full convexity and a fast way to compute lattice points within
@@ -45,6 +45,7 @@
 #include <vector>
 #include <string>
 #include <bitset>
+#include <array>
 #include <unordered_set>
 #include "DGtal/base/Common.h"
 #include "DGtal/base/Clone.h"
@@ -89,6 +90,12 @@ namespace DGtal
        configurations are not recomputed.
      - you can switch on/off the memoizer at object construction
        (e.g. it is useless in 2D).
+     - when the neighborhood and its Minkowski sums with the unit cube
+       fit in 64 bits (3D with K=1, 2D with K<=3), the remaining exact
+       computations are made on bit masks, with precomputed half-space
+       masks for every possible facet normal, hence without building
+       any polytope nor allocating memory. Otherwise, the local point
+       sets and their Minkowski sums are stored in reused buffers.
   */
   template < typename TKSpace, int K >
   class NeighborhoodConvexityAnalyzer
@@ -111,6 +118,12 @@ namespace DGtal
     static const Size      neigh_size = functions::const_pow( 2*K+1, dimension ); 
     static const Size      middle     = functions::const_middle( K, dimension );
     static const bool  false_positive = ( dimension > 2 ) || ( K > 1 );
+    /// The side of the grid that contains the neighborhood and its
+    /// Minkowski sums with the unit cube.
+    static const Size      mask_side  = 2*K+2;
+    /// When 'true', local sets are checked as 64-bit masks.
+    static const bool      use_masks  = ( dimension <= 3 )
+      && ( functions::const_pow( mask_side, dimension ) <= 64 );
 
     typedef std::bitset< functions::const_pow( 2*K+1, dimension ) > Configuration;
     typedef std::bitset< 9 > BasicConfiguration;
@@ -304,9 +317,7 @@ namespace DGtal
               ok = checkBasicConfigurationsFullConvexity( false, with_center );
               if ( ok && false_positive )
                 { // need to do the true computation.
-                  std::vector< Point > localX;
-                  getLocalX( localX, with_center );
-                  ok = myDigConv.isFullyConvex( localX );
+                  ok = checkLocalConvexity( false, with_center, true );
                 }
               myMemoizer.set( cfg, ok );
             }
@@ -316,9 +327,7 @@ namespace DGtal
           ok = checkBasicConfigurationsFullConvexity( false, with_center );
           if ( ok && false_positive )
             { // need to do the true computation.
-              std::vector< Point > localX;
-              getLocalX( localX, with_center );
-              ok = myDigConv.isFullyConvex( localX );
+              ok = checkLocalConvexity( false, with_center, true );
             }
         }
       // auto cfg = makeConfiguration( myCfgX, false, with_center );
@@ -371,9 +380,7 @@ namespace DGtal
               ok = checkBasicConfigurationsFullConvexity( true, with_center );
               if ( ok && false_positive )
                 { // need to do the true computation.
-                  std::vector< Point > localCompX;
-                  getLocalCompX( localCompX, with_center );
-                  ok = myDigConv.isFullyConvex( localCompX );
+                  ok = checkLocalConvexity( true, with_center, true );
                 }
               myMemoizer.set( cfg, ok );
             }
@@ -384,9 +391,7 @@ namespace DGtal
           ok = checkBasicConfigurationsFullConvexity( true, with_center );
           if ( ok && false_positive )
             { // need to do the true computation.
-              std::vector< Point > localCompX;
-              getLocalCompX( localCompX, with_center );
-              ok = myDigConv.isFullyConvex( localCompX );
+              ok = checkLocalConvexity( true, with_center, true );
             }
         }
       // bool memoized = false;
@@ -430,9 +435,7 @@ namespace DGtal
       bool ok = checkBasicConfigurations0Convexity( false, with_center );
       if ( ok && false_positive )
         { // need to do the true computation.
-          std::vector< Point > localX;
-          getLocalX( localX, with_center );
-          ok = myDigConv.is0Convex( localX );
+          ok = checkLocalConvexity( false, with_center, false );
         }
       myComputations |= mask;
       if ( ok ) myResults |= mask;
@@ -453,9 +456,7 @@ namespace DGtal
       bool ok = checkBasicConfigurations0Convexity( true, with_center );
       if ( ok && false_positive )
         { // need to do the true computation.
-          std::vector< Point > localCompX;
-          getLocalCompX( localCompX, with_center );
-          ok = myDigConv.is0Convex( localCompX );
+          ok = checkLocalConvexity( true, with_center, false );
         }
       myComputations |= mask;
       if ( ok ) myResults |= mask;
@@ -497,7 +498,23 @@ namespace DGtal
     ///
     /// @param[in] with_center if 'true' adds the center point.
     void getLocalCompX( std::vector< Point >& localCompX, bool with_center ) const;
-    
+
+    /// Tells if a set of points, given as a mask in the grid of side
+    /// `mask_side` (first coordinate varying first), is digitally
+    /// 0-convex or fully convex. The lattice points of the convex hull
+    /// of the set and of its Minkowski sums are the intersection of
+    /// precomputed half-space masks, whose levels are deduced from
+    /// the extremal values of the set along each candidate normal.
+    ///
+    /// @param X any mask whose points lie in the \f$ (2K+1)^d \f$
+    /// lower corner of the grid (only valid when `use_masks` is true).
+    ///
+    /// @param full when 'true', checks full convexity, otherwise
+    /// checks 0-convexity.
+    ///
+    /// @return 'true' iff the set \a X is 0-convex (resp. fully convex).
+    static bool isMaskConvex( DGtal::uint64_t X, bool full );
+
     /// @}
     
     // ------------------------- Protected Datas ------------------------------
@@ -516,8 +533,15 @@ namespace DGtal
     Size myNbInX;
     /// Stores the local configuration for X (without the center)
     Configuration myCfgX;
+    /// Stores the local configuration of the points within the domain
+    Configuration myCfgInDomain;
     /// Stores the basic local configurations associated to myCfgX, for speed-up
     std::vector< BasicConfiguration > myBasicCfgX;
+    /// Reused buffer for local points, when masks cannot be used.
+    PointRange myLocalPoints;
+    /// Reused buffers for the Minkowski sums of local points, when
+    /// masks cannot be used.
+    std::vector< PointRange > myLocalUSets;
 
     /// Stores the full convexity property of the basic 3x3 neighborhood configurations
     std::bitset< 512 > myBasicFullConvexityTable;
@@ -543,8 +567,55 @@ namespace DGtal
     // ------------------------- Private Datas --------------------------------
   private:
 
+    /// Precomputed tables for checking the convexity of local sets
+    /// represented as masks (see NeighborhoodConvexityAnalyzer::isMaskConvex).
+    struct MaskTables {
+      /// The candidate normal directions, sorted by increasing norm.
+      struct Normal {
+        /// The value of the normal at each cell of the grid.
+        std::array< int, 64 > values;
+        /// The lowest value of the normal on the grid.
+        int lowest;
+        /// The index of the masks of the lowest level in `le` and `ge`.
+        Size offset;
+        /// For each direction alpha, the increase of the maximum
+        /// (resp. the decrease of the minimum) after the Minkowski
+        /// sums along the axes of alpha.
+        std::array< int, 1 << dimension > up, down;
+      };
+      /// For each bit of a configuration, the corresponding grid mask.
+      std::array< DGtal::uint64_t, neigh_size > cfgToGrid;
+      /// The strides of the grid along each axis.
+      std::array< Size, dimension > strides;
+      /// The mask of all the cells of the grid.
+      DGtal::uint64_t all;
+      /// The candidate normals.
+      std::vector< Normal > normals;
+      /// For each normal and level h, the cells with value <= h.
+      std::vector< DGtal::uint64_t > le;
+      /// For each normal and level h, the cells with value >= h.
+      std::vector< DGtal::uint64_t > ge;
+    };
+
     // ------------------------- Internals ------------------------------------
   private:
+    /// @return the precomputed tables for masks, built at first call.
+    static const MaskTables& maskTables();
+
+    /// @param compX when 'true', complements the configuration.
+    /// @param with_center when 'true', makes the center point part of the configuration
+    /// @return the mask of the local set in the grid of side `mask_side`.
+    DGtal::uint64_t localMask( bool compX, bool with_center ) const;
+
+    /// Checks the 0-convexity or full convexity of the local set,
+    /// with masks when possible, otherwise with the reused buffers.
+    ///
+    /// @param compX when 'true', complements the configuration.
+    /// @param with_center when 'true', makes the center point part of the configuration
+    /// @param full when 'true', checks full convexity, otherwise 0-convexity.
+    /// @return 'true' iff the local set is 0-convex (resp. fully convex).
+    bool checkLocalConvexity( bool compX, bool with_center, bool full );
+
     /// Precomputes the table storing for each basic configuration if
     /// it is fully convex.
     void computeBasicFullConvexityTable();
@@ -65,6 +65,14 @@ namespace DGtal
      provides services to compute all the cotangent points to a given
      point, or to compute shortest paths.
 
+     Cotangency is generally checked on the fly, when a shortest path
+     computation visits a point. If many shortest paths are computed
+     on the same set, the cotangency graph may be precomputed once
+     (see computeCotangencyGraph) and stored as compressed sparse
+     rows: shortest paths then only traverse this graph, and several
+     of them may be computed in parallel (see computeShortestPaths).
+     Computations are parallelized with OpenMP when WITH_OPENMP is set.
+
      @see moduleDigitalConvexityApplications
 
      @tparam TKSpace an arbitrary model of CCellularGridSpaceND.
@@ -84,6 +92,7 @@ namespace DGtal
     typedef std::size_t                 Index;
     typedef std::size_t                 Size;
     typedef std::vector< Index >        Path;
+    typedef std::vector< Index >        IndexRange;
     typedef CellGeometry< KSpace >      CellCover;
     typedef LatticeSetByIntervals< Space > LatticeCellCover;
     
@@ -348,7 +357,9 @@ namespace DGtal
 
     protected:
 
-      /// Updates the queue with the cotangent points of the point given in parameter.
+      /// Updates the queue with the cotangent points of the point
+      /// given in parameter, which are read from the cotangency graph
+      /// of the tangency computer when it is computed.
       ///
       /// @param current the index of the point where we determine its
       /// adjacent (here cotangent) to update the queue of the bft.
@@ -505,6 +516,51 @@ namespace DGtal
                         const std::vector< bool > & to_avoid ) const;
     
     /// @}
+
+    // ------------------------- Cotangency graph services ----------------------------
+  public:
+    /// @name Cotangency graph services
+    /// @{
+
+    /// Sets the number of threads used to compute the cotangency
+    /// graph and several shortest paths (only when WITH_OPENMP).
+    /// @param nb the number of threads, or 0 for the OpenMP default.
+    void setNbThreads( int nb )
+    { myNbThreads = nb; }
+
+    /// @return the number of threads used to compute the cotangency
+    /// graph and several shortest paths (1 without OpenMP).
+    int nbThreads() const;
+
+    /// Precomputes the cotangency graph of the digital set, i.e. for
+    /// each point the indices of the points that are cotangent to it
+    /// (as given by getCotangentPoints). Points are processed in
+    /// parallel, and the result does not depend on the number of
+    /// threads. Afterwards, shortest paths only traverse this graph.
+    ///
+    /// @note The graph is cleared by `init`.
+    void computeCotangencyGraph();
+
+    /// Clears the cotangency graph, so that cotangency is again
+    /// checked on the fly by shortest paths.
+    void clearCotangencyGraph();
+
+    /// @return 'true' iff the cotangency graph is computed.
+    bool hasCotangencyGraph() const
+    { return ! myGraphOffsets.empty(); }
+
+    /// @return the offsets of the cotangency graph rows: the
+    /// cotangent points of point \a i are `cotangencyGraphTargets()[
+    /// k ]` for `k` from `cotangencyGraphOffsets()[ i ]` (included)
+    /// to `cotangencyGraphOffsets()[ i+1 ]` (excluded).
+    const IndexRange& cotangencyGraphOffsets() const
+    { return myGraphOffsets; }
+
+    /// @return the indices of cotangent points of the cotangency graph.
+    const IndexRange& cotangencyGraphTargets() const
+    { return myGraphTargets; }
+
+    /// @}
     
     // ------------------------- Shortest paths services --------------------------------
   public:
@@ -589,6 +645,25 @@ namespace DGtal
     shortestPath( Index source, Index target,
                   double secure = sqrt( KSpace::dimension ),
                   bool verbose = false ) const;
+
+    /// Computes the shortest paths from each of the given sources to
+    /// all the points of the digital set, independently and in
+    /// parallel. It is best used after computeCotangencyGraph.
+    ///
+    /// @param[in] sources the indices of the `n` source points.
+    ///
+    /// @param secure This value is used to prune vertices in the
+    /// bft. If it is greater or equal to \f$ \sqrt{d} \f$ where \a d
+    /// is the dimension, the shortest path algorithm is guaranteed to
+    /// output the correct result. If the value is smaller (down to
+    /// 0.0), the algorithm is much faster but a few shortest path may
+    /// be missed. Unused when the cotangency graph is computed.
+    ///
+    /// @return the `n` finished ShortestPaths objects, the i-th one
+    /// giving the distances and paths to the i-th source.
+    std::vector< ShortestPaths >
+    computeShortestPaths( const std::vector< Index >& sources,
+                          double secure = sqrt( KSpace::dimension ) ) const;
     
     /// @}
     
@@ -617,6 +692,14 @@ namespace DGtal
     
     /// A map giving for each point its index.
     std::unordered_map< Point, Index > myPt2Index;
+
+    /// The number of threads, or 0 for the OpenMP default.
+    int myNbThreads = 0;
+    /// The offsets of each point in \ref myGraphTargets (size is
+    /// `size()+1`), or empty if the cotangency graph is not computed.
+    IndexRange myGraphOffsets;
+    /// The cotangent points of each point, stored contiguously.
+    IndexRange myGraphTargets;
     
     // ------------------------- Private Datas --------------------------------
   private:
@@ -627,6 +710,18 @@ namespace DGtal
 
     /// Precomputes some neighborhood tables at construction.
     void setUp();
+
+    /// Extracts the cotangent points of a point by a breadth-first
+    /// traversal, like getCotangentPoints, but marks visited points
+    /// in a buffer instead of a set.
+    ///
+    /// @param[in] i the index of a point.
+    /// @param[inout] marks a buffer of size `size()`, where visited
+    /// points are marked with value `i+1`.
+    /// @param[inout] queue a buffer used for the traversal.
+    /// @param[out] R the indices of the other points that are cotangent to \a i.
+    void getCotangentPoints( Index i, IndexRange& marks, IndexRange& queue,
+                             IndexRange& R ) const;
     
   }; // end of class TangencyComputer
 
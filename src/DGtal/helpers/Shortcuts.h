@@ -58,6 +58,7 @@
 #include <DGtal/images/ImageLinearCellEmbedder.h>
 #include "DGtal/shapes/implicit/ImplicitPolynomial3Shape.h"
 #include "DGtal/shapes/GaussDigitizer.h"
+#include "DGtal/shapes/HierarchicalGaussDigitizer.h"
 #include "DGtal/shapes/ShapeGeometricFunctors.h"
 #include "DGtal/shapes/MeshHelpers.h"
 #include "DGtal/topology/CCellularGridSpaceND.h"
@@ -601,10 +602,12 @@ namespace DGtal
         CountedPtr<BinaryImage> img ( new BinaryImage( shapeDomain ) );
         if ( noise <= 0.0 )
           {
-            std::transform( shapeDomain.begin(), shapeDomain.end(),
-                            img->begin(),
-                            [&shape_digitization]
-                            ( const Point& p ) { return (*shape_digitization)(p); } );
+            // Boxes of the domain entirely inside or outside the shape
+            // are filled at once, only points near its boundary are
+            // evaluated.
+            HierarchicalGaussDigitizer< Space, ImplicitShape3D >
+              digitizer( *shape_digitization );
+            digitizer.digitize( *img );
           }
         else
           {
@@ -1291,6 +1294,39 @@ namespace DGtal
         return makeIdxDigitalSurface( surfels, K, params );
       }    
 
+      /// Builds an indexed digital surface made of all the boundary
+      /// surfels of the digitization of an implicit shape, without
+      /// digitizing the whole domain of \a K into a binary image. The
+      /// surfels are extracted in a narrow band around the boundary of
+      /// the shape by subdividing the domain (see
+      /// HierarchicalGaussDigitizer::sMakeBoundary), so that memory is
+      /// proportional to the number of surfels.
+      ///
+      /// @note It is the same surface as makeIdxDigitalSurface applied
+      /// to the binary image of the digitization, with parameter
+      /// surfaceComponents = "All".
+      ///
+      /// @param[in] shape_digitization a smart pointer on an implicit digital shape.
+      ///
+      /// @param[in] K the Khalimsky space whose domain encompasses the digital shape.
+      ///
+      /// @param[in] params the parameters:
+      ///   - surfelAdjacency   [     0]: specifies the surfel adjacency (1:ext, 0:int)
+      ///
+      /// @return a smart pointer on the indexed digital surface.
+      static CountedPtr<IdxDigitalSurface>
+        makeIdxDigitalSurface
+        ( CountedPtr<DigitizedImplicitShape3D> shape_digitization,
+          const KSpace&                        K,
+          const Parameters&                    params = parametersDigitalSurface() )
+      {
+        SurfelSet surfels;
+        HierarchicalGaussDigitizer< Space, ImplicitShape3D >
+          digitizer( *shape_digitization );
+        digitizer.sMakeBoundary( surfels, K, K.lowerBound(), K.upperBound() );
+        return makeIdxDigitalSurface( surfels, K, params );
+      }
+
       /// Builds an indexed digital surface from a space \a K and an
       /// arbitrary range of surfels.
       ///
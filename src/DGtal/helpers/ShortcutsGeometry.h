@@ -169,6 +169,33 @@ namespace DGtal
       typedef typename functors::IIPrincipalCurvaturesAndDirectionsFunctor<Space>::Quantity   CurvatureTensorQuantity;
       typedef std::vector< CurvatureTensorQuantity >              CurvatureTensorQuantities;
 
+      /// The quantities that can be requested to getIIGeometricQuantities,
+      /// they may be combined with a bitwise or.
+      enum IIQuantity
+        {
+          II_NORMAL                = 1, ///< normal vectors
+          II_MEAN_CURVATURE        = 2, ///< mean curvatures
+          II_GAUSSIAN_CURVATURE    = 4, ///< Gaussian curvatures
+          II_PRINCIPAL_CURVATURES  = 8, ///< first and second principal curvatures
+          II_PRINCIPAL_DIRECTIONS  = 16 ///< first and second principal directions
+        };
+
+      /// The Integral Invariant estimations returned by
+      /// getIIGeometricQuantities, stored as a structure of arrays.
+      /// Only the arrays of requested quantities are filled, the
+      /// others are left empty. Each filled array is in the same order
+      /// as the surfels.
+      struct IIGeometricQuantities
+      {
+        RealVectors normals;            ///< normal vectors (II_NORMAL)
+        Scalars     meanCurvatures;     ///< mean curvatures (II_MEAN_CURVATURE)
+        Scalars     gaussianCurvatures; ///< Gaussian curvatures (II_GAUSSIAN_CURVATURE)
+        Scalars     k1;                 ///< first principal curvatures (II_PRINCIPAL_CURVATURES)
+        Scalars     k2;                 ///< second principal curvatures (II_PRINCIPAL_CURVATURES)
+        RealVectors d1;                 ///< first principal directions (II_PRINCIPAL_DIRECTIONS)
+        RealVectors d2;                 ///< second principal directions (II_PRINCIPAL_DIRECTIONS)
+      };
+
 
       typedef TrueDigitalSurfaceLocalEstimator
         < KSpace, ImplicitShape3D, PositionFunctor >                TruePositionEstimator;
@@ -1330,6 +1357,177 @@ namespace DGtal
         return mc_estimations;
       }
 
+      /// Given a digital shape \a bimage, a sequence of \a surfels,
+      /// a combination of requested quantities and some parameters \a
+      /// params, returns the requested Integral Invariant (II)
+      /// estimations at the specified surfels, in the same order.
+      ///
+      /// @param[in] bimage the characteristic function of the shape as a binary image (inside is true, outside is false).
+      /// @param[in] surfels the sequence of surfels at which we compute the quantities
+      /// @param[in] quantities a bitwise or of IIQuantity values, e.g. `II_NORMAL | II_MEAN_CURVATURE | II_GAUSSIAN_CURVATURE`.
+      /// @param[in] params the parameters:
+      ///   - verbose         [     1]: verbose trace mode 0: silent, 1: verbose.
+      ///   - r-radius        [   3.0]: the constant for kernel radius parameter r in r(h)=r h^alpha (VCM,II,Trivial).
+      ///   - alpha           [  0.33]: the parameter alpha in r(h)=r h^alpha (VCM, II)."
+      ///   - gridstep        [   1.0]: the digitization gridstep (often denoted by h).
+      ///
+      /// @return the requested estimations, see IIGeometricQuantities.
+      ///
+      /// @see getIIGeometricQuantities( const TPointPredicate&, const KSpace&, const SurfelRange&, int, const Parameters& )
+      static IIGeometricQuantities
+      getIIGeometricQuantities( CountedPtr<BinaryImage> bimage,
+                                const SurfelRange&      surfels,
+                                int                     quantities,
+                                const Parameters&       params
+                                = parametersGeometryEstimation()
+                                | parametersKSpace() )
+      {
+        auto K =  getKSpace( bimage, params );
+        return getIIGeometricQuantities( *bimage, K, surfels, quantities, params );
+      }
+
+      /// Given a digitized implicit shape \a dshape, a sequence of \a
+      /// surfels, a combination of requested quantities and some
+      /// parameters \a params, returns the requested Integral
+      /// Invariant (II) estimations at the specified surfels, in the
+      /// same order.
+      ///
+      /// @param[in] dshape the digitized implicit shape, which is an
+      /// implicitly defined characteristic function.
+      ///
+      /// @param[in] surfels the sequence of surfels at which we compute the quantities
+      /// @param[in] quantities a bitwise or of IIQuantity values, e.g. `II_NORMAL | II_MEAN_CURVATURE | II_GAUSSIAN_CURVATURE`.
+      /// @param[in] params the parameters:
+      ///   - verbose         [     1]: verbose trace mode 0: silent, 1: verbose.
+      ///   - r-radius        [   3.0]: the constant for kernel radius parameter r in r(h)=r h^alpha (VCM,II,Trivial).
+      ///   - alpha           [  0.33]: the parameter alpha in r(h)=r h^alpha (VCM, II)."
+      ///   - gridstep        [   1.0]: the digitization gridstep (often denoted by h).
+      ///   - minAABB         [ -10.0]: the min value of the AABB bounding box (domain)
+      ///   - maxAABB         [  10.0]: the max value of the AABB bounding box (domain)
+      ///   - offset          [   5.0]: the digital dilation of the digital space,
+      ///                       useful when you process shapes adding some noise.
+      ///   - closed          [     1]: specifies if the Khalimsky space is closed (!=0) or not (==0)
+      ///
+      /// @return the requested estimations, see IIGeometricQuantities.
+      static IIGeometricQuantities
+      getIIGeometricQuantities( CountedPtr< DigitizedImplicitShape3D > dshape,
+                                const SurfelRange&      surfels,
+                                int                     quantities,
+                                const Parameters&       params
+                                = parametersGeometryEstimation()
+                                | parametersKSpace()
+                                | parametersDigitizedImplicitShape3D() )
+      {
+        auto K =  getKSpace( params );
+        return getIIGeometricQuantities( *dshape, K, surfels, quantities, params );
+      }
+
+      /// Given an arbitrary PointPredicate \a shape: Point -> boolean,
+      /// a Khalimsky space \a K, a sequence of \a surfels, a
+      /// combination of requested quantities and some parameters \a
+      /// params, returns the requested Integral Invariant (II)
+      /// estimations at the specified surfels, in the same order.
+      ///
+      /// Contrary to successive calls to getIINormalVectors,
+      /// getIIMeanCurvatures, getIIGaussianCurvatures and
+      /// getIIPrincipalCurvaturesAndDirections, the kernel is built
+      /// once, the surfels are traversed once and the covariance
+      /// matrix is diagonalized once per surfel, whatever the number
+      /// of requested quantities.
+      ///
+      /// @note Normals are reoriented with respect to Trivial normals,
+      /// as in getIINormalVectors. Gaussian curvatures and principal
+      /// curvatures and directions are identical to the ones of
+      /// getIIGaussianCurvatures and getIIPrincipalCurvaturesAndDirections.
+      /// Mean curvatures are computed as the half sum of principal
+      /// curvatures of the covariance matrix, whereas
+      /// getIIMeanCurvatures uses the volume of the intersection of
+      /// the ball with the shape: both are consistent estimators, but
+      /// their values differ slightly.
+      ///
+      /// @tparam TPointPredicate any type of map Point -> boolean.
+      /// @param[in] shape a function Point -> boolean telling if you are inside the shape.
+      /// @param[in] K the Khalimsky space where the shape and surfels live.
+      /// @param[in] surfels the sequence of surfels at which we compute the quantities
+      /// @param[in] quantities a bitwise or of IIQuantity values, e.g. `II_NORMAL | II_MEAN_CURVATURE | II_GAUSSIAN_CURVATURE`.
+      /// @param[in] params the parameters:
+      ///   - verbose         [     1]: verbose trace mode 0: silent, 1: verbose.
+      ///   - r-radius        [   3.0]: the constant for kernel radius parameter r in r(h)=r h^alpha (VCM,II,Trivial).
+      ///   - alpha           [  0.33]: the parameter alpha in r(h)=r h^alpha (VCM, II)."
+      ///   - gridstep        [   1.0]: the digitization gridstep (often denoted by h).
+      ///
+      /// @return the requested estimations, see IIGeometricQuantities.
+      ///
+      /// @note The function is faster when surfels are in a specific order, as
+      /// given for instance by a depth-first traversal (see @ref getSurfelRange)
+      template <typename TPointPredicate>
+      static IIGeometricQuantities
+      getIIGeometricQuantities( const TPointPredicate&  shape,
+                                const KSpace&           K,
+                                const SurfelRange&      surfels,
+                                int                     quantities,
+                                const Parameters&       params
+                                = parametersGeometryEstimation()
+                                | parametersKSpace() )
+      {
+        typedef functors::IINormalCurvaturesAndDirections3DFunctor<Space> IIFunctor;
+        typedef IntegralInvariantCovarianceEstimator<KSpace, TPointPredicate, IIFunctor> IIEstimator;
+        typedef typename IIFunctor::Quantity IIQuantities;
+
+        IIGeometricQuantities result;
+        if ( quantities == 0 ) return result;
+        int      verbose = params[ "verbose"   ].as<int>();
+        Scalar   h       = params[ "gridstep"  ].as<Scalar>();
+        Scalar   r       = params[ "r-radius"  ].as<Scalar>();
+        Scalar   alpha   = params[ "alpha"     ].as<Scalar>();
+        if ( alpha != 1.0 ) r *= pow( h, alpha-1.0 );
+        if ( verbose > 0 )
+        {
+          trace.info() << "- II geometric quantities alpha=" << alpha << std::endl;
+          trace.info() << "- II geometric quantities r=" << (r*h)  << " (continuous) "
+          << r << " (discrete)" << std::endl;
+        }
+        IIFunctor   functor;
+        functor.init( h, r*h );
+        IIEstimator ii_estimator( functor );
+        ii_estimator.attach( K, shape );
+        ii_estimator.setParams( r );
+        ii_estimator.init( h, surfels.begin(), surfels.end() );
+        std::vector< IIQuantities > estimations;
+        estimations.reserve( surfels.size() );
+        ii_estimator.eval( surfels.begin(), surfels.end(),
+                           std::back_inserter( estimations ) );
+
+        // Scatter the estimations into the requested arrays.
+        const bool normals = ( quantities & II_NORMAL ) != 0;
+        const bool mean    = ( quantities & II_MEAN_CURVATURE ) != 0;
+        const bool gauss   = ( quantities & II_GAUSSIAN_CURVATURE ) != 0;
+        const bool curvs   = ( quantities & II_PRINCIPAL_CURVATURES ) != 0;
+        const bool dirs    = ( quantities & II_PRINCIPAL_DIRECTIONS ) != 0;
+        if ( normals ) result.normals.reserve( surfels.size() );
+        if ( mean    ) result.meanCurvatures.reserve( surfels.size() );
+        if ( gauss   ) result.gaussianCurvatures.reserve( surfels.size() );
+        if ( curvs   ) { result.k1.reserve( surfels.size() ); result.k2.reserve( surfels.size() ); }
+        if ( dirs    ) { result.d1.reserve( surfels.size() ); result.d2.reserve( surfels.size() ); }
+        for ( const auto& q : estimations )
+          {
+            const Scalar k1 = std::get<1>( q );
+            const Scalar k2 = std::get<2>( q );
+            if ( normals ) result.normals.push_back( std::get<0>( q ) );
+            if ( mean    ) result.meanCurvatures.push_back( 0.5 * ( k1 + k2 ) );
+            if ( gauss   ) result.gaussianCurvatures.push_back( k1 * k2 );
+            if ( curvs   ) { result.k1.push_back( k1 ); result.k2.push_back( k2 ); }
+            if ( dirs    ) { result.d1.push_back( std::get<3>( q ) );
+                             result.d2.push_back( std::get<4>( q ) ); }
+          }
+        if ( normals )
+          {
+            const RealVectors n_trivial = getTrivialNormalVectors( K, surfels );
+            orientVectors( result.normals, n_trivial );
+          }
+        return result;
+      }
+
       /// @}
 
       // --------------------------- AT approximation ------------------------------
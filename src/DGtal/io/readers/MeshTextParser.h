@@ -0,0 +1,156 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file MeshTextParser.h
+ *
+ * @date 2026/10/18
+ *
+ * Header file for module MeshTextParser.ih
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(MeshTextParser_RECURSES)
+#error Recursive header files inclusion detected in MeshTextParser.h
+#else // defined(MeshTextParser_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define MeshTextParser_RECURSES
+
+#if !defined MeshTextParser_h
+/** Prevents repeated inclusion of headers. */
+#define MeshTextParser_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <string>
+#include <vector>
+#include "DGtal/base/Common.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+
+  /////////////////////////////////////////////////////////////////////////////
+  // struct MeshTextParser
+  /**
+     Description of struct 'MeshTextParser' <p> \brief Aim: Low-level
+     services for parsing mesh files (OBJ, OFF, PLY) held in memory.
+
+     The whole file is read in one buffer (readAll), which is then
+     split into chunks of lines at newline boundaries (splitLines), so
+     that chunks can be parsed in parallel. Numbers are read in place
+     with std::from_chars (std::strtod for reals if the standard
+     library does not provide it), without copying tokens into
+     strings or streams.
+
+     @see SurfaceMeshReader MeshReader
+  */
+  struct MeshTextParser
+  {
+    typedef std::size_t Size;
+
+    /**
+       Reads all the remaining characters of an input stream.
+       @param[in,out] input any input stream.
+       @param[out] buffer the read characters.
+       @return 'true' if no I/O error occured.
+    */
+    static bool readAll( std::istream & input, std::string & buffer );
+
+    /**
+       Splits a range of characters into at most \a nb chunks of
+       whole lines, with about the same number of characters.
+       @param[in] begin the beginning of the range.
+       @param[in] end the end of the range.
+       @param[in] nb the number of chunks.
+       @return the boundaries of the chunks (the number of chunks plus one),
+       each chunk starting at the beginning of a line.
+    */
+    static std::vector< const char* >
+    splitLines( const char* begin, const char* end, Size nb );
+
+    /**
+       @param[in] size the number of characters to parse.
+       @return the number of chunks used to parse them (several per thread).
+    */
+    static Size nbChunks( Size size );
+
+    /**
+       Computes the beginning of the non empty lines that are not
+       comments (starting with '#'), in parallel.
+       @param[in] begin the beginning of the range.
+       @param[in] end the end of the range.
+       @param[out] starts the beginning of these lines, in order.
+    */
+    static void lineStarts( const char* begin, const char* end,
+                            std::vector< const char* > & starts );
+
+    /// @return 'true' if \a c is a blank character within a line.
+    static bool isBlank( char c )
+    { return c == ' ' || c == '\t' || c == '\r'; }
+
+    /// @return the first non blank character from \a p in the line.
+    static const char* skipBlanks( const char* p, const char* end )
+    {
+      while ( p != end && isBlank( *p ) ) ++p;
+      return p;
+    }
+
+    /// @return the first blank character or end of line from \a p.
+    static const char* skipToken( const char* p, const char* end )
+    {
+      while ( p != end && *p != '\n' && ! isBlank( *p ) ) ++p;
+      return p;
+    }
+
+    /// @return the beginning of the line following the one of \a p.
+    static const char* nextLine( const char* p, const char* end );
+
+    /**
+       Reads a real number after blanks, within the line.
+       @param[in,out] p the position of the parsing, moved after the number if any.
+       @param[in] end the end of the range.
+       @param[out] x the read number.
+       @return 'true' if a number was read.
+    */
+    static bool readReal( const char* & p, const char* end, double & x );
+
+    /**
+       Reads an integer after blanks, within the line.
+       @param[in,out] p the position of the parsing, moved after the number if any.
+       @param[in] end the end of the range.
+       @param[out] x the read number.
+       @return 'true' if a number was read.
+    */
+    static bool readInteger( const char* & p, const char* end, long & x );
+  };
+
+} // namespace DGtal
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "MeshTextParser.ih"
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined MeshTextParser_h
+
+#undef MeshTextParser_RECURSES
+#endif // else defined(MeshTextParser_RECURSES)
@@ -46,6 +46,8 @@
 #include "DGtal/base/Common.h"
 #include "DGtal/helpers/StdDefs.h"
 #include "DGtal/shapes/SurfaceMesh.h"
+#include "DGtal/shapes/PackedSurfaceMesh.h"
+#include "DGtal/io/readers/MeshTextParser.h"
 
 namespace DGtal
 {
@@ -54,7 +56,13 @@ namespace DGtal
   // template class SurfaceMeshReader
   /**
      Description of template class 'SurfaceMeshReader' <p> \brief Aim:
-     An helper class for reading mesh files (Wavefront OBJ at this point) and creating a SurfaceMesh.
+     An helper class for reading mesh files (Wavefront OBJ and PLY at this point) and creating a
+     SurfaceMesh or a PackedSurfaceMesh.
+
+     Files are read in memory in one block, split into chunks of
+     lines that are parsed in parallel (OpenMP) without intermediate
+     strings (see MeshTextParser), and merged into flat arrays of
+     positions and indices.
 
      @tparam TRealPoint an arbitrary model of RealPoint.
      @tparam TRealVector an arbitrary model of RealVector.
@@ -69,6 +77,7 @@ namespace DGtal
     BOOST_STATIC_ASSERT( ( dimension == 3 ) );
 
     typedef DGtal::SurfaceMesh< RealPoint, RealVector > SurfaceMesh;
+    typedef DGtal::PackedSurfaceMesh< RealPoint, RealVector > PackedSurfaceMesh;
     typedef typename SurfaceMesh::Size           Size;
     typedef typename SurfaceMesh::Index          Index;
     typedef typename SurfaceMesh::Vertices       Vertices;
@@ -97,6 +106,200 @@ namespace DGtal
     /// created mesh is ok.
     static
     bool readOBJ( std::istream & input, SurfaceMesh & smesh );
+
+    /// Reads an input file as an OBJ file format and outputs the
+    /// corresponding packed surface mesh. Faces are read directly
+    /// into packed arrays, without intermediate SurfaceMesh.
+    ///
+    /// @param[in,out] input the input stream where the OBJ file is read.
+    /// @param[out] pmesh the output packed surface mesh.
+    ///
+    /// @return 'true' if both reading the input stream was ok and the
+    /// created mesh is ok.
+    static
+    bool readOBJ( std::istream & input, PackedSurfaceMesh & pmesh );
+
+    /// Reads an input file as a PLY file format (ascii or binary,
+    /// little or big endian) and outputs the corresponding surface
+    /// mesh. Vertex positions (x,y,z), vertex normals (nx,ny,nz) and
+    /// faces (vertex_indices or vertex_index) are read, other elements
+    /// and properties are skipped.
+    ///
+    /// @param[in,out] input the input stream where the PLY file is
+    /// read (opened in binary mode for binary files).
+    /// @param[out] smesh the output surface mesh.
+    ///
+    /// @return 'true' if both reading the input stream was ok and the
+    /// created mesh is ok.
+    static
+    bool readPLY( std::istream & input, SurfaceMesh & smesh );
+
+    /// Reads an input file as a PLY file format and outputs the
+    /// corresponding packed surface mesh (see readPLY).
+    ///
+    /// @param[in,out] input the input stream where the PLY file is read.
+    /// @param[out] pmesh the output packed surface mesh.
+    ///
+    /// @return 'true' if both reading the input stream was ok and the
+    /// created mesh is ok.
+    static
+    bool readPLY( std::istream & input, PackedSurfaceMesh & pmesh );
+
+    // ------------------------- Internals ------------------------------------
+  protected:
+    typedef typename PackedSurfaceMesh::Ranges   Ranges;
+
+    /// The elements of a chunk of lines of an OBJ file.
+    struct OBJChunk
+    {
+      std::vector< RealPoint >  vertices;
+      std::vector< RealVector > normals;
+      /// The vertices of faces, local to the chunk if relative.
+      Ranges                    faces;
+      /// The normal indices of the vertices of faces.
+      std::vector< Index >      normal_indices;
+      /// The relative vertex indices, as (position in faces, index
+      /// from the first vertex of the chunk).
+      std::vector< std::pair< Size, long > > relative_vertices;
+      /// The relative normal indices, as (position in faces, index
+      /// from the first normal of the chunk).
+      std::vector< std::pair< Size, long > > relative_normals;
+      /// The number of lines.
+      Size                      nb_lines = 0;
+    };
+
+    /// Normal index of a face vertex without normal index: it is the vertex index.
+    static constexpr Index DEFAULT_NORMAL = Index( -1 );
+    /// Invalid vertex or normal index.
+    static constexpr Index INVALID_INDEX  = Index( -2 );
+
+    /// Reads an OBJ file and initializes a mesh.
+    /// @tparam Mesh either SurfaceMesh or PackedSurfaceMesh.
+    template <typename Mesh>
+    static
+    bool readOBJMesh( std::istream & input, Mesh & mesh );
+
+    /// Reads a PLY file and initializes a mesh.
+    /// @tparam Mesh either SurfaceMesh or PackedSurfaceMesh.
+    template <typename Mesh>
+    static
+    bool readPLYMesh( std::istream & input, Mesh & mesh );
+
+    /// Initializes a surface mesh from positions and faces.
+    /// @return 'true' if all the vertices of faces were valid.
+    static
+    bool initMesh( SurfaceMesh & smesh, std::vector< RealPoint > && vertices,
+                   Ranges && faces );
+
+    /// Initializes a packed surface mesh from positions and faces.
+    /// @return 'true' if all the vertices of faces were valid.
+    static
+    bool initMesh( PackedSurfaceMesh & pmesh, std::vector< RealPoint > && vertices,
+                   Ranges && faces );
+
+    /// Parses an input stream as an OBJ file format.
+    ///
+    /// @param[in,out] input the input stream where the OBJ file is read.
+    /// @param[out] vertices the positions of the vertices.
+    /// @param[out] normals the normal vectors.
+    /// @param[out] faces the vertices of each face.
+    /// @param[out] faces_normals_idx the normal indices of each face.
+    ///
+    /// @return 'true' if reading the input stream was ok.
+    static
+    bool parseOBJ( std::istream & input,
+                   std::vector< RealPoint > & vertices,
+                   std::vector< RealVector > & normals,
+                   Ranges & faces, Ranges & faces_normals_idx );
+
+    /// Parses the lines of a chunk of an OBJ file.
+    ///
+    /// @param[in] begin the beginning of the chunk (beginning of a line).
+    /// @param[in] end the end of the chunk (end of a line).
+    /// @param[out] chunk the elements of the chunk.
+    static
+    void parseOBJChunk( const char* begin, const char* end, OBJChunk & chunk );
+
+    /// @return 'true' if the indices of the range are all distinct.
+    static
+    bool distinctIndices( const Index* it, const Index* itEnd );
+
+    /// The types of PLY properties, the value being their size in bytes.
+    enum PLYType { PLY_NONE = 0, PLY_INT8 = 1, PLY_INT16 = 2, PLY_INT32 = 4,
+                   PLY_UINT8 = 11, PLY_UINT16 = 12, PLY_UINT32 = 14,
+                   PLY_FLOAT32 = 24, PLY_FLOAT64 = 28 };
+
+    /// A property of a PLY element.
+    struct PLYProperty
+    {
+      PLYType type;       ///< the type of the value or of the list items.
+      PLYType count_type; ///< the type of the list count, PLY_NONE if not a list.
+      int     role;       ///< -1 if ignored, 0-2 for x,y,z, 3-5 for nx,ny,nz, 6 for vertex indices.
+    };
+
+    /// An element of a PLY file.
+    struct PLYElement
+    {
+      std::string name;
+      Size        count;
+      std::vector< PLYProperty > properties;
+    };
+
+    /// @return the PLY type corresponding to its name in the header.
+    static
+    PLYType plyType( const std::string & name );
+
+    /// Reads a binary PLY value at \a p, swapping bytes if asked.
+    static
+    double plyValue( const char* p, PLYType type, bool swap );
+
+    /// Reads a record of a PLY element, in binary format.
+    ///
+    /// @param[in,out] p the position of the record, moved after it.
+    /// @param[in] end the end of the data.
+    /// @param[in] element the PLY element.
+    /// @param[in] swap when 'true', values are byte-swapped.
+    /// @param[out] values the values of the properties with a role in 0-5.
+    /// @param[out] list the indices of the property with role 6.
+    /// @return 'true' if the whole record was within the data.
+    static
+    bool readPLYBinaryRecord( const char* & p, const char* end,
+                              const PLYElement & element, bool swap,
+                              double* values, std::vector< Index > & list );
+
+    /// Reads a record of a PLY element, in ascii format.
+    /// @see readPLYBinaryRecord
+    static
+    bool readPLYAsciiRecord( const char* p, const char* end,
+                             const PLYElement & element,
+                             double* values, std::vector< Index > & list );
+
+    /// Parses an input stream as a PLY file format.
+    ///
+    /// @param[in,out] input the input stream where the PLY file is read.
+    /// @param[out] vertices the positions of the vertices.
+    /// @param[out] normals the normal vectors (empty if none).
+    /// @param[out] faces the vertices of each face.
+    ///
+    /// @return 'true' if reading the input stream was ok.
+    static
+    bool parsePLY( std::istream & input,
+                   std::vector< RealPoint > & vertices,
+                   std::vector< RealVector > & normals,
+                   Ranges & faces );
+
+    /// Sets the vertex and face normals of a mesh read from an OBJ file.
+    ///
+    /// @tparam Mesh either SurfaceMesh or PackedSurfaceMesh.
+    /// @param[in,out] mesh the mesh.
+    /// @param[in] normals the normal vectors.
+    /// @param[in] faces_normals_idx the normal indices of each face.
+    ///
+    /// @return 'true' if normals were consistent with the mesh.
+    template <typename Mesh>
+    static
+    bool setNormals( Mesh & mesh, const std::vector< RealVector > & normals,
+                     const Ranges & faces_normals_idx );
   };
   
 } // namespace DGtal
@@ -124,6 +124,57 @@ namespace DGtal
     using type = typename std::common_type<T, U>::type; //! Arithmetic operation result type.
   };
 
+  namespace details
+  {
+    /// Tells if a type is a 128-bit integer.
+    template <typename T>
+    struct IsInt128
+      : std::false_type
+    {
+    };
+
+#ifdef WITH_INT128
+    template <>
+    struct IsInt128<DGtal::int128_t>
+      : std::true_type
+    {
+    };
+
+    template <>
+    struct IsInt128<DGtal::uint128_t>
+      : std::true_type
+    {
+    };
+#endif
+
+    /// Tells if a type is a cv-unqualified arithmetic type or a 128-bit integer.
+    template <typename T>
+    struct IsArithmeticOrInt128
+      : std::integral_constant< bool,
+          ( std::is_arithmetic<T>::value
+            && std::is_same< T, typename std::remove_cv<T>::type >::value )
+          || IsInt128<T>::value >
+    {
+    };
+  } // namespace details
+
+  /** @brief Specialization for 128-bit integers, when the compiler
+   * does not see them as arithmetic types (i.e. in strict ISO mode).
+   *
+   * Resulting type is deduced from usual arithmetic conversion.
+   *
+   * @see ArithmeticConversionTraits
+   */
+  template <typename T, typename U>
+  struct ArithmeticConversionTraits< T, U,
+      typename std::enable_if<    ( details::IsInt128<T>::value || details::IsInt128<U>::value )
+                               && details::IsArithmeticOrInt128<T>::value
+                               && details::IsArithmeticOrInt128<U>::value
+                               && ! ( std::is_arithmetic<T>::value && std::is_arithmetic<U>::value ) >::type >
+  {
+    using type = decltype( std::declval<T>() + std::declval<U>() ); //! Arithmetic operation result type.
+  };
+
   /** @brief Result type of arithmetic binary operators between two given types.
    *
    * @tparam T      First operand type.
@@ -197,7 +248,8 @@ namespace DGtal
    */
   template <typename T, typename GMP1, typename GMP2>
   struct ArithmeticConversionTraits<T, __gmp_expr<GMP1, GMP2>,
-      typename std::enable_if< std::is_integral<T>::value >::type >
+      typename std::enable_if<    std::is_integral<T>::value
+                               && ! details::IsInt128<T>::value >::type >
   {
     using type = BigInteger;
   };
@@ -211,7 +263,8 @@ namespace DGtal
    */
   template <typename GMP1, typename GMP2, typename U>
   struct ArithmeticConversionTraits<__gmp_expr<GMP1, GMP2>, U,
-      typename std::enable_if< std::is_integral<U>::value >::type >
+      typename std::enable_if<    std::is_integral<U>::value
+                               && ! details::IsInt128<U>::value >::type >
   {
     using type = BigInteger;
   };
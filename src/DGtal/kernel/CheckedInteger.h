@@ -0,0 +1,584 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file CheckedInteger.h
+ *
+ * @date 2026/10/18
+ *
+ * @brief Header file for module CheckedInteger.cpp
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(CheckedInteger_RECURSES)
+#error Recursive header files inclusion detected in CheckedInteger.h
+#else // defined(CheckedInteger_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define CheckedInteger_RECURSES
+
+#if !defined CheckedInteger_h
+/** Prevents repeated inclusion of headers. */
+#define CheckedInteger_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <memory>
+#include <type_traits>
+#include "DGtal/base/Common.h"
+#include "DGtal/kernel/NumberTraits.h"
+#include "DGtal/kernel/ArithmeticConversionTraits.h"
+#include "DGtal/kernel/IntegerConverter.h"
+//////////////////////////////////////////////////////////////////////////////
+
+#ifdef WITH_BIGINTEGER
+
+namespace DGtal
+{
+
+  /////////////////////////////////////////////////////////////////////////////
+  // class CheckedInteger
+  /**
+   * Description of class 'CheckedInteger' <p>
+   * \brief Aim: A signed integer that is computed with 64-bit
+   * integers as long as no overflow occurs, and that escalates to
+   * BigInteger only when an operation overflows.
+   *
+   * Exact predicates with int64 coordinates may need a few bits more
+   * than 64, but rarely. Using BigInteger everywhere costs a memory
+   * allocation per operation. A CheckedInteger stores a 64-bit
+   * integer, and each operation checks for overflow (with the
+   * builtins of the compiler when available). Only the operations
+   * that overflow are computed with BigInteger, and a result that
+   * fits again in 63 bits goes back to a 64-bit integer.
+   *
+   * It is a model of concepts::CInteger, hence it may be used as
+   * internal integer of lattice geometry algorithms, for instance
+   * the kernels of QuickHull or ArithmeticalDSS.
+   *
+   * @code
+   CheckedInteger a = DGtal::int64_t( 1 ) << 62;
+   CheckedInteger b = a * a; // BigInteger
+   CheckedInteger c = b / a; // back to int64
+   * @endcode
+   *
+   * @note Only available when DGtal is built with GMP (WITH_BIGINTEGER).
+   *
+   * @see testCheckedInteger.cpp
+   */
+  class CheckedInteger
+  {
+  public:
+    /// The type of small values.
+    typedef DGtal::int64_t Small;
+
+    // ----------------------- Standard services ------------------------------
+  public:
+
+    /// Default constructor, the value is zero.
+    CheckedInteger() : mySmall( 0 ) {}
+
+    /**
+     * Constructor from a built-in integer.
+     * @tparam T any integral type.
+     * @param i any integer.
+     */
+    template < typename T,
+               typename std::enable_if< std::is_integral<T>::value
+                                        && ! details::IsInt128<T>::value, int >::type = 0 >
+    CheckedInteger( T i );
+
+#ifdef WITH_INT128
+    /**
+     * Constructor from a 128-bit integer.
+     * @param i any integer.
+     */
+    CheckedInteger( DGtal::int128_t i );
+#endif
+
+    /**
+     * Constructor from a big integer.
+     * @param i any integer.
+     */
+    explicit CheckedInteger( const BigInteger& i );
+
+    /**
+     * Copy constructor.
+     * @param other the object to clone.
+     */
+    CheckedInteger( const CheckedInteger& other );
+
+    /**
+     * Move constructor.
+     * @param other the object to move.
+     */
+    CheckedInteger( CheckedInteger&& other ) = default;
+
+    /**
+     * Assignment.
+     * @param other the object to copy.
+     * @return a reference on 'this'.
+     */
+    CheckedInteger& operator=( const CheckedInteger& other );
+
+    /**
+     * Move assignment.
+     * @param other the object to move.
+     * @return a reference on 'this'.
+     */
+    CheckedInteger& operator=( CheckedInteger&& other ) = default;
+
+    // ----------------------- Accessors --------------------------------------
+  public:
+
+    /// @return 'true' iff the value is stored as a BigInteger.
+    bool isBig() const { return myBig != nullptr; }
+
+    /// @return the value as a 64-bit integer (truncated if isBig()).
+    Small toInt64() const;
+
+    /// @return the value as a BigInteger.
+    BigInteger toBigInteger() const;
+
+    /// @return the (rounded) value as a double.
+    double toDouble() const;
+
+    /// @return -1, 0 or 1 according to the sign of the value.
+    int sign() const;
+
+    // ----------------------- Arithmetic -------------------------------------
+  public:
+
+    /// @param other any integer.
+    /// @return a reference on 'this', after addition.
+    CheckedInteger& operator+=( const CheckedInteger& other );
+
+    /// @param other any integer.
+    /// @return a reference on 'this', after subtraction.
+    CheckedInteger& operator-=( const CheckedInteger& other );
+
+    /// @param other any integer.
+    /// @return a reference on 'this', after multiplication.
+    CheckedInteger& operator*=( const CheckedInteger& other );
+
+    /// @param other any non-null integer.
+    /// @return a reference on 'this', after (truncated) division.
+    CheckedInteger& operator/=( const CheckedInteger& other );
+
+    /// @param other any non-null integer.
+    /// @return a reference on 'this', after taking the remainder of
+    /// the (truncated) division.
+    CheckedInteger& operator%=( const CheckedInteger& other );
+
+    /// @return a reference on 'this', after incrementation.
+    CheckedInteger& operator++();
+
+    /// @return a reference on 'this', after decrementation.
+    CheckedInteger& operator--();
+
+    /// @return the value before incrementation.
+    CheckedInteger operator++( int );
+
+    /// @return the value before decrementation.
+    CheckedInteger operator--( int );
+
+    /// @return the opposite value.
+    CheckedInteger operator-() const;
+
+    /// @return the same value.
+    CheckedInteger operator+() const { return *this; }
+
+    /**
+     * Compares two integers.
+     * @param other any integer.
+     * @return a negative, null or positive number when 'this' is
+     * respectively less than, equal to or greater than @a other.
+     */
+    int compare( const CheckedInteger& other ) const;
+
+    // ----------------------- Interface --------------------------------------
+  public:
+
+    /**
+     * Writes/Displays the object on an output stream.
+     * @param out the output stream where the object is written.
+     */
+    void selfDisplay ( std::ostream & out ) const;
+
+    /**
+     * Checks the validity/consistency of the object.
+     * @return 'true' if the object is valid, 'false' otherwise.
+     */
+    bool isValid() const;
+
+    // ------------------------- Friends --------------------------------------
+
+    friend CheckedInteger operator+( const CheckedInteger& a, const CheckedInteger& b );
+    friend CheckedInteger operator-( const CheckedInteger& a, const CheckedInteger& b );
+    friend CheckedInteger operator*( const CheckedInteger& a, const CheckedInteger& b );
+    friend bool operator==( const CheckedInteger& a, const CheckedInteger& b );
+    friend bool operator!=( const CheckedInteger& a, const CheckedInteger& b );
+    friend bool operator<( const CheckedInteger& a, const CheckedInteger& b );
+    friend bool operator<=( const CheckedInteger& a, const CheckedInteger& b );
+    friend bool operator>( const CheckedInteger& a, const CheckedInteger& b );
+    friend bool operator>=( const CheckedInteger& a, const CheckedInteger& b );
+
+    // ------------------------- Private Datas --------------------------------
+  private:
+    /// The value when it fits in 64 bits.
+    Small mySmall;
+    /// The value when it does not fit in 64 bits, otherwise nullptr
+    /// (a big value is never in the range of 64-bit integers).
+    std::unique_ptr<BigInteger> myBig;
+
+    // ------------------------- Internals ------------------------------------
+  private:
+
+    /// Stores a big value, going back to a 64-bit integer when possible.
+    /// @param i any integer.
+    void setBig( const BigInteger& i );
+
+    /// Goes back to a 64-bit integer if the big value fits in it.
+    void normalize();
+
+    /// Computes in place `*this = op( *this, other )` with GMP, the
+    /// slow path of the compound operators.
+    /// @param other any integer.
+    /// @param op a GMP function like mpz_add.
+    void bigOperation( const CheckedInteger& other,
+                       void (*op)( mpz_ptr, mpz_srcptr, mpz_srcptr ) );
+
+  }; // end of class CheckedInteger
+
+  /// @param a any integer.
+  /// @param b any integer.
+  /// @return the sum of @a a and @a b.
+  CheckedInteger operator+( const CheckedInteger& a, const CheckedInteger& b );
+
+  /// @param a any integer.
+  /// @param b any integer.
+  /// @return the difference of @a a and @a b.
+  CheckedInteger operator-( const CheckedInteger& a, const CheckedInteger& b );
+
+  /// @param a any integer.
+  /// @param b any integer.
+  /// @return the product of @a a and @a b.
+  CheckedInteger operator*( const CheckedInteger& a, const CheckedInteger& b );
+
+  /// @param a any integer.
+  /// @param b any non-null integer.
+  /// @return the (truncated) quotient of @a a by @a b.
+  CheckedInteger operator/( const CheckedInteger& a, const CheckedInteger& b );
+
+  /// @param a any integer.
+  /// @param b any non-null integer.
+  /// @return the remainder of the (truncated) division of @a a by @a b.
+  CheckedInteger operator%( const CheckedInteger& a, const CheckedInteger& b );
+
+  /// @param a any integer.
+  /// @param b any integer.
+  /// @return 'true' iff @a a is equal to @a b.
+  bool operator==( const CheckedInteger& a, const CheckedInteger& b );
+
+  /// @param a any integer.
+  /// @param b any integer.
+  /// @return 'true' iff @a a is different from @a b.
+  bool operator!=( const CheckedInteger& a, const CheckedInteger& b );
+
+  /// @param a any integer.
+  /// @param b any integer.
+  /// @return 'true' iff @a a is less than @a b.
+  bool operator<( const CheckedInteger& a, const CheckedInteger& b );
+
+  /// @param a any integer.
+  /// @param b any integer.
+  /// @return 'true' iff @a a is less than or equal to @a b.
+  bool operator<=( const CheckedInteger& a, const CheckedInteger& b );
+
+  /// @param a any integer.
+  /// @param b any integer.
+  /// @return 'true' iff @a a is greater than @a b.
+  bool operator>( const CheckedInteger& a, const CheckedInteger& b );
+
+  /// @param a any integer.
+  /// @param b any integer.
+  /// @return 'true' iff @a a is greater than or equal to @a b.
+  bool operator>=( const CheckedInteger& a, const CheckedInteger& b );
+
+  /**
+   * Overloads 'operator<<' for displaying objects of class 'CheckedInteger'.
+   * @param out the output stream where the object is written.
+   * @param object the object of class 'CheckedInteger' to write.
+   * @return the output stream after the writing.
+   */
+  std::ostream&
+  operator<< ( std::ostream & out, const CheckedInteger & object );
+
+  /** @brief Specialization of NumberTraitsImpl for DGtal::CheckedInteger.
+   *
+   * As for DGtal::BigInteger, both IsUnsigned and IsSigned are TagTrue.
+   */
+  template <typename Enable>
+  struct NumberTraitsImpl<DGtal::CheckedInteger, Enable>
+  {
+    typedef TagTrue IsIntegral;     ///< A CheckedInteger is of integral type.
+    typedef TagFalse IsBounded;     ///< A CheckedInteger is not bounded.
+    typedef TagTrue IsUnsigned;     ///< A CheckedInteger can be signed and unsigned.
+    typedef TagTrue IsSigned;       ///< a CheckedInteger can be signed and unsigned.
+    typedef TagTrue IsSpecialized;  ///< Is that a number type with specific traits.
+
+    typedef DGtal::CheckedInteger SignedVersion;    ///< Alias to the signed version of a CheckedInteger (aka a CheckedInteger).
+    typedef DGtal::CheckedInteger UnsignedVersion;  ///< Alias to the unsigned version of a CheckedInteger (aka a CheckedInteger).
+    typedef DGtal::CheckedInteger ReturnType;       ///< Alias to the type that should be used as return type.
+
+    /** @brief Defines a type that represents the "best" way to pass
+     *  a parameter of type T to a function.
+     */
+    typedef const DGtal::CheckedInteger & ParamType;
+
+    /// Constant Zero.
+    static const DGtal::CheckedInteger ZERO;
+
+    /// Constant One.
+    static const DGtal::CheckedInteger ONE;
+
+    /// Return the zero of this integer.
+    static inline
+    ReturnType zero()
+    {
+      return ZERO;
+    }
+
+    /// Return the one of this integer.
+    static inline
+    ReturnType one()
+    {
+      return ONE;
+    }
+
+    /// Return the minimum possible value (trigger an error since CheckedInteger is unbounded).
+    static inline
+    ReturnType min()
+    {
+      FATAL_ERROR_MSG(false, "UnBounded interger type does not support min() function");
+      return ZERO;
+    }
+
+    /// Return the maximum possible value (trigger an error since CheckedInteger is unbounded).
+    static inline
+    ReturnType max()
+    {
+      FATAL_ERROR_MSG(false, "UnBounded interger type does not support max() function");
+      return ZERO;
+    }
+
+    /// Return the number of significant binary digits (trigger an error since CheckedInteger is unbounded).
+    static inline
+    unsigned int digits()
+    {
+      FATAL_ERROR_MSG(false, "UnBounded interger type does not support digits() function");
+      return 0;
+    }
+
+    /** @brief Return the bounding type of the number.
+     *
+     * @return BOUNDED, UNBOUNDED, or BOUND_UNKNOWN.
+     */
+    static inline
+    BoundEnum isBounded() noexcept
+    {
+      return UNBOUNDED;
+    }
+
+    /** @brief Return the sign type of the number.
+     *
+     * @return SIGNED, UNSIGNED or SIGN_UNKNOWN.
+     */
+    static inline
+    SignEnum isSigned() noexcept
+    {
+      return SIGNED;
+    }
+
+    /** @brief
+     * Cast method to DGtal::int64_t (for I/O or board export uses
+     * only).
+     */
+    static inline
+    DGtal::int64_t castToInt64_t(const DGtal::CheckedInteger & aT)
+    {
+      return aT.toInt64();
+    }
+
+    /** @brief
+     * Cast method to DGtal::uint64_t (for I/O or board export uses
+     * only).
+     */
+    static inline
+    DGtal::uint64_t castToUInt64_t(const DGtal::CheckedInteger & aT)
+    {
+      return static_cast<DGtal::uint64_t>( aT.toInt64() );
+    }
+
+    /** @brief
+     * Cast method to double (for I/O or board export uses
+     * only).
+     */
+    static inline
+    double castToDouble(const DGtal::CheckedInteger & aT)
+    {
+      return aT.toDouble();
+    }
+
+    /** @brief Check the parity of a number.
+     *
+     * @param aT any number.
+     * @return 'true' iff the number is even.
+     */
+    static inline
+    bool even( ParamType aT )
+    {
+      return aT.isBig() ? mpz_even_p( aT.toBigInteger().get_mpz_t() ) != 0
+                        : ( aT.toInt64() & 1 ) == 0;
+    }
+
+    /** @brief Check the parity of a number.
+     *
+     * @param aT any number.
+     * @return 'true' iff the number is odd.
+     */
+    static inline
+    bool odd( ParamType aT )
+    {
+      return ! even( aT );
+    }
+  }; // end of class NumberTraits<DGtal::CheckedInteger>.
+
+  // Definition of the static attributes in order to allow ODR-usage.
+  template <typename Enable> const DGtal::CheckedInteger NumberTraitsImpl<DGtal::CheckedInteger, Enable>::ZERO = 0;
+  template <typename Enable> const DGtal::CheckedInteger NumberTraitsImpl<DGtal::CheckedInteger, Enable>::ONE  = 1;
+
+  /** @brief Specialization when first operand is a @ref CheckedInteger.
+   *
+   * @see ArithmeticConversionTraits
+   */
+  template <typename U>
+  struct ArithmeticConversionTraits< DGtal::CheckedInteger, U,
+      typename std::enable_if<    std::is_integral<U>::value
+                               || details::IsInt128<U>::value
+                               || std::is_same<U, DGtal::CheckedInteger>::value >::type >
+  {
+    using type = DGtal::CheckedInteger;
+  };
+
+  /** @brief Specialization when second operand is a @ref CheckedInteger.
+   *
+   * @see ArithmeticConversionTraits
+   */
+  template <typename T>
+  struct ArithmeticConversionTraits< T, DGtal::CheckedInteger,
+      typename std::enable_if<    std::is_integral<T>::value
+                               || details::IsInt128<T>::value >::type >
+  {
+    using type = DGtal::CheckedInteger;
+  };
+
+  /// Allows seamless conversion of integral types and lattice
+  /// points, while checking for errors when going from a more
+  /// precise to a less precise type.
+  ///
+  /// Specialized version for CheckedInteger.
+  ///
+  /// @tparam dim static constant of type DGtal::Dimension that
+  /// specifies the static  dimension of the space and thus the number
+  /// of elements  of the Point or Vector.
+  template < DGtal::Dimension dim >
+  struct IntegerConverter< dim, DGtal::CheckedInteger > {
+    typedef DGtal::CheckedInteger Integer;
+
+    /// @param i any integer
+    /// @return the same integer
+    static DGtal::CheckedInteger cast( DGtal::int32_t i )
+    {
+      return DGtal::CheckedInteger( i );
+    }
+
+    /// @param i any integer
+    /// @return the same integer
+    static DGtal::CheckedInteger cast( DGtal::int64_t i )
+    {
+      return DGtal::CheckedInteger( i );
+    }
+
+#ifdef WITH_INT128
+    /// @param i any integer
+    /// @return the same integer
+    static DGtal::CheckedInteger cast( DGtal::int128_t i )
+    {
+      return DGtal::CheckedInteger( i );
+    }
+#endif
+
+    /// @param i any integer
+    /// @return the same integer
+    static DGtal::CheckedInteger cast( const DGtal::BigInteger& i )
+    {
+      return DGtal::CheckedInteger( i );
+    }
+
+    /// @param i any integer
+    /// @return the same integer
+    static DGtal::CheckedInteger cast( const DGtal::CheckedInteger& i )
+    {
+      return i;
+    }
+
+    /// Conversion of a lattice point.
+    ///
+    /// @tparam TOtherInteger any integer type convertible to CheckedInteger.
+    /// @param p any point
+    /// @return the same point
+    template < typename TOtherInteger >
+    static
+    PointVector< dim, DGtal::CheckedInteger >
+    cast( const PointVector< dim, TOtherInteger >& p )
+    {
+      PointVector< dim, DGtal::CheckedInteger > q;
+      for ( DGtal::Dimension i = 0; i < dim; i++ )
+        q[ i ] = DGtal::CheckedInteger( p[ i ] );
+      return q;
+    }
+  };
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/kernel/CheckedInteger.ih"
+
+#endif // WITH_BIGINTEGER
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined CheckedInteger_h
+
+#undef CheckedInteger_RECURSES
+#endif // else defined(CheckedInteger_RECURSES)
@@ -81,7 +81,7 @@ namespace DGtal
       mpz_t tmp;
       mpz_init( tmp );
       mpz_mod_2exp( tmp, n, 64 );   /* tmp = (lower 64 bits of n) */
-      auto lo = mpz_get_ui( tmp );       /* lo = tmp & 0xffffffff */
+      auto lo = mpz_get_ui( tmp ) & 0xffffffffUL; /* lo = tmp & 0xffffffff */
       mpz_div_2exp( tmp, tmp, 32 ); /* tmp >>= 32 */
       auto hi = mpz_get_ui( tmp );       /* hi = tmp & 0xffffffff */
       mpz_clear( tmp );
@@ -95,6 +95,37 @@ namespace DGtal
     {
       return (long long)mpz_get_ull(n); /* just use unsigned version */
     }
+
+#ifdef WITH_INT128
+    /// @param[inout] n the (initialized) big integer to set
+    /// @param[in] i a signed 128-bit integer to assign to \a n.
+    static inline void mpz_set_si128(mpz_t n, DGtal::int128_t i)
+    {
+      const DGtal::uint128_t u = ( i < 0 ) ? - DGtal::uint128_t( i ) : DGtal::uint128_t( i );
+      mpz_set_ull(n, (unsigned long long)(u >> 64));        /* n = u >> 64 */
+      mpz_mul_2exp(n, n, 32);                               /* n <<= 32 */
+      mpz_add_ui(n, n, (unsigned int)(u >> 32));            /* n += (unsigned int)(u >> 32) */
+      mpz_mul_2exp(n, n, 32);                               /* n <<= 32 */
+      mpz_add_ui(n, n, (unsigned int)u);                    /* n += (unsigned int)u */
+      if ( i < 0 ) mpz_neg(n, n);
+    }
+
+    /// Conversion to int128 is not native for GMP.
+    /// @param n any number
+    /// @return its int128 representation (modulo 2^128).
+    static inline DGtal::int128_t mpz_get_si128(mpz_t n)
+    {
+      mpz_t tmp;
+      mpz_init( tmp );
+      mpz_abs( tmp, n );
+      auto lo = mpz_get_ull( tmp );  /* lo = lower 64 bits of |n| */
+      mpz_div_2exp( tmp, tmp, 64 );  /* tmp >>= 64 */
+      auto hi = mpz_get_ull( tmp );  /* hi = next 64 bits of |n| */
+      mpz_clear( tmp );
+      const DGtal::uint128_t u = ( DGtal::uint128_t( hi ) << 64 ) + lo;
+      return DGtal::int128_t( mpz_sgn( n ) < 0 ? - u : u );
+    }
+#endif
   }
 #endif
     
@@ -192,6 +223,33 @@ namespace DGtal
       return q;
     }
       
+#ifdef WITH_INT128
+    /// @param i any integer
+    /// @return the same integer
+    static DGtal::int32_t cast( DGtal::int128_t i ) 
+    {
+      DGtal::int32_t r = DGtal::int32_t( i );
+      if ( DGtal::int128_t( r ) != i )
+        trace.warning() << "Bad integer conversion: " << i << " -> " << r
+                        << std::endl;
+      return r;
+    }
+
+    /// Conversion of a lattice point.
+    ///
+    /// @param p any point
+    /// @return the same point
+    static
+    PointVector< dim, DGtal::int32_t >
+    cast( PointVector< dim, DGtal::int128_t > p )
+    {
+      PointVector< dim, DGtal::int32_t > q;
+      for ( DGtal::Dimension i = 0; i < dim; i++ )
+        q[ i ] = cast( p[ i ] );
+      return q;
+    }
+#endif
+
 #ifdef WITH_BIGINTEGER
     /// @param i any integer
     /// @return the same integer
@@ -274,6 +332,33 @@ namespace DGtal
       return p;
     }
       
+#ifdef WITH_INT128
+    /// @param i any integer
+    /// @return the same integer
+    static DGtal::int64_t cast( DGtal::int128_t i ) 
+    {
+      DGtal::int64_t r = DGtal::int64_t( i );
+      if ( DGtal::int128_t( r ) != i )
+        trace.warning() << "Bad integer conversion: " << i << " -> " << r
+                        << std::endl;
+      return r;
+    }
+
+    /// Conversion of a lattice point.
+    ///
+    /// @param p any point
+    /// @return the same point
+    static
+    PointVector< dim, DGtal::int64_t >
+    cast( PointVector< dim, DGtal::int128_t > p )
+    {
+      PointVector< dim, DGtal::int64_t > q;
+      for ( DGtal::Dimension i = 0; i < dim; i++ )
+        q[ i ] = cast( p[ i ] );
+      return q;
+    }
+#endif
+      
 #ifdef WITH_BIGINTEGER
     /// @param i any integer
     /// @return the same integer
@@ -306,6 +391,111 @@ namespace DGtal
   };
     
 
+#ifdef WITH_INT128
+  /// Allows seamless conversion of integral types and lattice
+  /// points, while checking for errors when going from a more
+  /// precise to a less precise type.
+  ///
+  /// Specialized version for int128_t.
+  ///
+  /// @tparam dim static constant of type DGtal::Dimension that
+  /// specifies the static  dimension of the space and thus the number
+  /// of elements  of the Point or Vector.
+  template < DGtal::Dimension dim >
+  struct IntegerConverter< dim, DGtal::int128_t > {
+    typedef DGtal::int128_t Integer;
+
+    /// @param i any integer
+    /// @return the same integer
+    static DGtal::int128_t cast( DGtal::int32_t i ) 
+    {
+      return i;
+    }
+
+    /// Conversion of a lattice point.
+    ///
+    /// @param p any point
+    /// @return the same point
+    static
+    PointVector< dim, DGtal::int128_t >
+    cast( PointVector< dim, DGtal::int32_t > p )
+    {
+      PointVector< dim, DGtal::int128_t > q;
+      for ( DGtal::Dimension i = 0; i < dim; i++ )
+        q[ i ] = cast( p[ i ] );
+      return q;
+    }
+
+    /// @param i any integer
+    /// @return the same integer
+    static DGtal::int128_t cast( DGtal::int64_t i ) 
+    {
+      return i;
+    }
+
+    /// Conversion of a lattice point.
+    ///
+    /// @param p any point
+    /// @return the same point
+    static
+    PointVector< dim, DGtal::int128_t >
+    cast( PointVector< dim, DGtal::int64_t > p )
+    {
+      PointVector< dim, DGtal::int128_t > q;
+      for ( DGtal::Dimension i = 0; i < dim; i++ )
+        q[ i ] = cast( p[ i ] );
+      return q;
+    }
+
+    /// @param i any integer
+    /// @return the same integer
+    static DGtal::int128_t cast( DGtal::int128_t i ) 
+    {
+      return i;
+    }
+
+    /// Conversion of a lattice point.
+    ///
+    /// @param p any point
+    /// @return the same point
+    static
+    PointVector< dim, DGtal::int128_t >
+    cast( PointVector< dim, DGtal::int128_t > p )
+    {
+      return p;
+    }
+      
+#ifdef WITH_BIGINTEGER
+    /// @param i any integer
+    /// @return the same integer
+    static DGtal::int128_t cast( DGtal::BigInteger i ) 
+    {
+      DGtal::int128_t r = detail::mpz_get_si128( i.get_mpz_t() );
+      DGtal::BigInteger tmp;
+      detail::mpz_set_si128( tmp.get_mpz_t(), r );
+      if ( tmp != i )
+        trace.warning() << "Bad integer conversion: " << i << " -> " << r
+                        << std::endl;
+      return r;
+    }
+
+    /// Conversion of a lattice point.
+    ///
+    /// @param p any point
+    /// @return the same point
+    static
+    PointVector< dim, DGtal::int128_t >
+    cast( PointVector< dim, DGtal::BigInteger > p )
+    {
+      PointVector< dim, DGtal::int128_t > q;
+      for ( DGtal::Dimension i = 0; i < dim; i++ )
+        q[ i ] = cast( p[ i ] );
+      return q;
+    }
+#endif
+  };
+#endif
+
 #ifdef WITH_BIGINTEGER
   /// Allows seamless conversion of integral types and lattice
   /// points, while checking for errors when going from a more
@@ -364,6 +554,31 @@ namespace DGtal
       return q;
     }
       
+#ifdef WITH_INT128
+    /// @param i any integer
+    /// @return the same integer
+    static DGtal::BigInteger cast( DGtal::int128_t i ) 
+    {
+      DGtal::BigInteger tmp;
+      detail::mpz_set_si128( tmp.get_mpz_t(), i );
+      return tmp;
+    }
+
+    /// Conversion of a lattice point.
+    ///
+    /// @param p any point
+    /// @return the same point
+    static
+    PointVector< dim, DGtal::BigInteger >
+    cast( PointVector< dim, DGtal::int128_t > p )
+    {
+      PointVector< dim, DGtal::BigInteger > q;
+      for ( DGtal::Dimension i = 0; i < dim; i++ )
+        q[ i ] = cast( p[ i ] );
+      return q;
+    }
+#endif
+      
     /// @param i any integer
     /// @return the same integer
     static DGtal::BigInteger cast( DGtal::BigInteger i ) 
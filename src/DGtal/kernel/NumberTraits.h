@@ -396,6 +396,24 @@ namespace DGtal
     using UnsignedVersion = T; ///< Alias to the unsigned version of a floating-point type (aka itself).
   }; // end of class NumberTraitsImpl
 
+#ifdef WITH_INT128
+  /** @brief Specialization of NumberTraitsImpl for 128-bit integers,
+   * when the compiler does not see them as fundamental integer types
+   * (i.e. in strict ISO mode, otherwise the specialization for
+   * fundamental integer types is used).
+   */
+  template <typename T>
+  struct NumberTraitsImpl<T, typename std::enable_if<
+         (    std::is_same<T, DGtal::int128_t>::value
+           || std::is_same<T, DGtal::uint128_t>::value )
+      && ! std::is_integral<T>::value >::type>
+    : details::NumberTraitsImplFundamental<T>
+  {
+    using SignedVersion   = DGtal::int128_t;  ///< Alias to the signed version of the number type.
+    using UnsignedVersion = DGtal::uint128_t; ///< Alias to the unsigned version of the number type.
+  }; // end of class NumberTraitsImpl
+#endif
+
 #ifdef WITH_BIGINTEGER
   /** @brief Specialization of NumberTraitsImpl for DGtal::BigInteger
    *
@@ -578,6 +596,14 @@ namespace DGtal
     typedef int64_t promote_t;
   };
 
+#ifdef WITH_INT128
+  template<>
+  struct promote_trait<int64_t, int128_t>
+  {
+    typedef int128_t promote_t;
+  };
+#endif
+
 } // namespace DGtal
 
 #endif // !defined NumberTraits_h
@@ -0,0 +1,262 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file CompiledMPolynomial.h
+ *
+ * @date 2026/10/18
+ *
+ * Header file for module CompiledMPolynomial.ih
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(CompiledMPolynomial_RECURSES)
+#error Recursive header files inclusion detected in CompiledMPolynomial.h
+#else // defined(CompiledMPolynomial_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define CompiledMPolynomial_RECURSES
+
+#if !defined CompiledMPolynomial_h
+/** Prevents repeated inclusion of headers. */
+#define CompiledMPolynomial_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <array>
+#include <vector>
+#include "DGtal/base/Common.h"
+#include "DGtal/math/MPolynomial.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class CompiledMPolynomial
+  /**
+     Description of template class 'CompiledMPolynomial' <p>
+     \brief Aim: Represents a multivariate polynomial as a flat,
+     read-only, nested Horner scheme, for fast evaluations.
+
+     An MPolynomial<n> is a tree of polynomials with less variables,
+     each one stored in its own vector, which makes its evaluation
+     slow. Here, the polynomial is compiled once into contiguous
+     arrays: the coefficients of the tree at depth k (polynomials in
+     the variables X_k, ..., X_{n-1}) are stored level by level, so
+     that an evaluation is a sequence of Horner schemes over
+     contiguous ranges, without any allocation.
+
+     The method evaluateRow evaluates the polynomial at many points
+     sharing all their coordinates but the first one (e.g. a row of a
+     digital domain). The coefficients in X_0 are then computed once,
+     and the remaining Horner scheme is a simple loop over the points
+     that compilers vectorize.
+
+     The method evaluateInterval bounds the values of the polynomial
+     over a box with interval arithmetic (Horner scheme over
+     intervals), e.g. to know that a box lies entirely on one side of
+     the zero level set.
+
+     @code
+     MPolynomial<3, double> P = mmonomial<double>( 2, 0, 0 ) + mmonomial<double>( 0, 2, 0 )
+       + mmonomial<double>( 0, 0, 2 ) - 1.0 * mmonomial<double>( 0, 0, 0 );
+     CompiledMPolynomial<3, double> C( P );
+     double v = C( RealPoint( 0.5, 0.5, 0.5 ) ); // same as P( 0.5 )( 0.5 )( 0.5 )
+     @endcode
+
+     @tparam n the number of variables or indeterminates (n >= 1).
+     @tparam TRing the type chosen for the coefficients and the variables.
+  */
+  template < int n, typename TRing >
+  class CompiledMPolynomial
+  {
+    BOOST_STATIC_ASSERT(( n >= 1 ));
+
+    // ----------------------- Standard services ------------------------------
+  public:
+    typedef TRing Ring;
+    typedef std::size_t Size;
+
+    /**
+       Constructs the zero polynomial.
+    */
+    CompiledMPolynomial();
+
+    /**
+       Compiles the given polynomial.
+       @param p any polynomial with n variables.
+    */
+    template < typename TAlloc >
+    CompiledMPolynomial( const MPolynomial< n, Ring, TAlloc > & p );
+
+    /**
+       Compiles the given polynomial.
+       @param p any polynomial with n variables.
+    */
+    template < typename TAlloc >
+    void init( const MPolynomial< n, Ring, TAlloc > & p );
+
+    // ----------------------- Interface --------------------------------------
+  public:
+
+    /**
+       @tparam TPoint any type with a const operator[] (e.g. RealPoint).
+       @param x any point, whose coordinates x[0], ..., x[n-1] are the values of the variables.
+       @return the value of the polynomial at \a x.
+    */
+    template < typename TPoint >
+    Ring operator()( const TPoint & x ) const;
+
+    /**
+       Evaluates the polynomial at the \a nb points whose first
+       coordinate is given by \a x0 and whose other coordinates are
+       the ones of \a x, i.e. values[ i ] = P( x0[ i ], x[ 1 ], ..., x[ n-1 ] ).
+
+       @tparam TPoint any type with a const operator[] (e.g. RealPoint).
+       @param[in] x any point giving the values of the variables X_1, ..., X_{n-1}.
+       @param[in] x0 the values of the variable X_0 (an array of size \a nb).
+       @param[in] nb the number of points.
+       @param[out] values the values of the polynomial (an array of size \a nb).
+    */
+    template < typename TPoint >
+    void evaluateRow( const TPoint & x, const Ring* x0, Size nb, Ring* values ) const;
+
+    /**
+       Bounds the values of the polynomial over the box [\a lo, \a up]
+       with interval arithmetic. Bounds are pessimistic, and enlarged
+       so as to account for the rounding errors of both this method
+       and operator(): for any point x of the box, fmin <= P(x) <= fmax
+       where P(x) is computed with operator().
+
+       @tparam TPoint any type with a const operator[] (e.g. RealPoint).
+       @param[in] lo the lowest point of the box.
+       @param[in] up the highest point of the box (lo[k] <= up[k] for all k).
+       @param[out] fmin a lower bound of the polynomial over the box.
+       @param[out] fmax an upper bound of the polynomial over the box.
+    */
+    template < typename TPoint >
+    void evaluateInterval( const TPoint & lo, const TPoint & up,
+                           Ring & fmin, Ring & fmax ) const;
+
+    /**
+       @tparam TPoint any type with a const operator[] (e.g. RealPoint).
+       @param[in] lo the lowest point of the box.
+       @param[in] up the highest point of the box (lo[k] <= up[k] for all k).
+       @return an upper bound of the rounding errors of operator() at
+       any point of the box [\a lo, \a up].
+    */
+    template < typename TPoint >
+    Ring errorBound( const TPoint & lo, const TPoint & up ) const;
+
+    /**
+       @return the number of coefficients stored at the last level
+       (i.e. the size of the compiled polynomial).
+    */
+    Size size() const;
+
+    /**
+     * Writes/Displays the object on an output stream.
+     * @param out the output stream where the object is written.
+     */
+    void selfDisplay ( std::ostream & out ) const;
+
+    /**
+     * Checks the validity/consistency of the object.
+     * @return 'true' if the object is valid, 'false' otherwise.
+     */
+    bool isValid() const;
+
+    // ------------------------- Private Datas --------------------------------
+  private:
+    /// For each depth k, the node i of this depth has its children
+    /// (coefficients in X_k) in the range [myRanges[k][i],
+    /// myRanges[k][i+1]) of the nodes of depth k+1 (or of
+    /// myCoefficients for the last depth). The depth 0 has one node.
+    std::array< std::vector< Size >, n > myRanges;
+    /// The coefficients of the polynomials in X_{n-1}.
+    std::vector< Ring > myCoefficients;
+    /// An upper bound of the total degree of the polynomial.
+    int myDegreeBound;
+
+    // ------------------------- Internals ------------------------------------
+  private:
+
+    /**
+       Compiles the polynomials of depth k.
+       @param polynomials the polynomials of depth k, in order.
+    */
+    template < int k, typename TAlloc >
+    void compileLevel( const std::vector< const MPolynomial< n - k, Ring, TAlloc >* > & polynomials );
+
+    /**
+       @param node a node of depth k.
+       @param x any point.
+       @return the value at \a x of the polynomial of this node.
+    */
+    template < int k, typename TPoint >
+    Ring evaluateNode( Size node, const TPoint & x ) const;
+
+    /**
+       @param[in] node a node of depth k.
+       @param[in] lo the lowest point of the box.
+       @param[in] up the highest point of the box.
+       @param[out] vmin a lower bound of the polynomial of this node over the box.
+       @param[out] vmax an upper bound of the polynomial of this node over the box.
+       @param[out] magnitude an upper bound of the sum of the absolute
+       values of its monomials over the box.
+    */
+    template < int k, typename TPoint >
+    void evaluateNodeInterval( Size node, const TPoint & lo, const TPoint & up,
+                               Ring & vmin, Ring & vmax, Ring & magnitude ) const;
+
+    /**
+       @param magnitude an upper bound of the sum of the absolute
+       values of the monomials.
+       @return the corresponding bound of the rounding errors.
+    */
+    Ring errorOfMagnitude( Ring magnitude ) const;
+
+  }; // end of class CompiledMPolynomial
+
+
+  /**
+   * Overloads 'operator<<' for displaying objects of class 'CompiledMPolynomial'.
+   * @param out the output stream where the object is written.
+   * @param object the object of class 'CompiledMPolynomial' to write.
+   * @return the output stream after the writing.
+   */
+  template < int n, typename TRing >
+  std::ostream&
+  operator<< ( std::ostream & out, const CompiledMPolynomial< n, TRing > & object );
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/math/CompiledMPolynomial.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined CompiledMPolynomial_h
+
+#undef CompiledMPolynomial_RECURSES
+#endif // else defined(CompiledMPolynomial_RECURSES)
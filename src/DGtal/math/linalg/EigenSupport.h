@@ -49,6 +49,7 @@
 //////////////////////////////////////////////////////////////////////////////
 // Inclusions
 #include <iostream>
+#include <algorithm>
 #if defined(__GNUG__) && !defined(__clang__)
 #pragma GCC diagnostic push
 #pragma GCC diagnostic ignored "-Wpragmas"
@@ -83,10 +84,11 @@ namespace DGtal
    * Description of struct 'EigenLinearAlgebraBackend' <p>
    * \brief Aim:
    * Provide linear algebra backend using Eigen dense and sparse matrix as well as dense vector.
-   * 6 linear solvers available:
+   * 7 linear solvers available:
    *  - EigenLinearAlgebraBackend::SolverSimplicialLLT
    *  - EigenLinearAlgebraBackend::SolverSimplicialLDLT
-   *  - EigenLinearAlgebraBackend::SolverConjugateGradient
+   *  - EigenLinearAlgebraBackend::SolverConjugateGradient (Jacobi preconditioner)
+   *  - EigenLinearAlgebraBackend::SolverConjugateGradientIC (incomplete Cholesky preconditioner)
    *  - EigenLinearAlgebraBackend::SolverBiCGSTAB
    *  - EigenLinearAlgebraBackend::SolverSparseLU
    *  - EigenLinearAlgebraBackend::SolverSparseQR
@@ -105,9 +107,55 @@ namespace DGtal
     typedef Eigen::SimplicialLLT<SparseMatrix> SolverSimplicialLLT;
     typedef Eigen::SimplicialLDLT<SparseMatrix> SolverSimplicialLDLT;
     typedef Eigen::ConjugateGradient<SparseMatrix> SolverConjugateGradient;
+    typedef Eigen::ConjugateGradient<SparseMatrix, Eigen::Lower|Eigen::Upper, Eigen::IncompleteCholesky<DenseVector::Scalar, Eigen::Lower, Eigen::AMDOrdering<SparseMatrix::StorageIndex> > > SolverConjugateGradientIC;
     typedef Eigen::BiCGSTAB<SparseMatrix> SolverBiCGSTAB;
     typedef Eigen::SparseLU<SparseMatrix> SolverSparseLU;
     typedef Eigen::SparseQR<SparseMatrix, Eigen::COLAMDOrdering<SparseMatrix::Index> > SolverSparseQR;
+
+    /// Solves the linear systems A X = B for all the columns of @a B,
+    /// given the factorization of A by a SimplicialLDLT solver. The
+    /// columns are processed by blocks (in parallel with OpenMP),
+    /// and the triangular factor is traversed once per block: each
+    /// of its coefficients updates a whole row of the block, stored
+    /// contiguously. This is much faster than solving the systems one
+    /// column after the other when there are many right-hand sides.
+    ///
+    /// @param solver a SimplicialLDLT solver, whose compute method
+    /// has been called.
+    /// @param B the right-hand sides, one per column.
+    /// @return the solutions, one per column.
+    static DenseMatrix solveMultiple( const SolverSimplicialLDLT& solver,
+                                      const DenseMatrix& B )
+    {
+      typedef Eigen::Matrix<double, Eigen::Dynamic, Eigen::Dynamic, Eigen::RowMajor> RowMajorMatrix;
+      const auto& L = solver.matrixL().nestedExpression();
+      const auto& D = solver.vectorD();
+      const long  n = (long) L.outerSize();
+      const long  w = 64;
+      const long  nb_blocks = ( (long) B.cols() + w - 1 ) / w;
+      DenseMatrix X( B.rows(), B.cols() );
+#ifdef WITH_OPENMP
+#pragma omp parallel for schedule(dynamic)
+#endif
+      for ( long b = 0; b < nb_blocks; ++b )
+        {
+          const long     nb_cols  = std::min( w, (long) B.cols() - b * w );
+          const bool     permuted = solver.permutationP().size() > 0;
+          RowMajorMatrix Y        = B.middleCols( b * w, nb_cols );
+          if ( permuted ) Y = solver.permutationP() * Y;
+          for ( long j = 0; j < n; ++j )
+            for ( SparseMatrix::InnerIterator it( L, j ); it; ++it )
+              Y.row( it.index() ) -= it.value() * Y.row( j );
+          for ( long j = 0; j < n; ++j )
+            Y.row( j ) /= D( j );
+          for ( long j = n - 1; j >= 0; --j )
+            for ( SparseMatrix::InnerIterator it( L, j ); it; ++it )
+              Y.row( j ) -= it.value() * Y.row( it.index() );
+          if ( permuted ) X.middleCols( b * w, nb_cols ) = solver.permutationPinv() * Y;
+          else            X.middleCols( b * w, nb_cols ) = Y;
+        }
+      return X;
+    }
   };
   ///////////////////////////////////////////////////////////////////////////////
   
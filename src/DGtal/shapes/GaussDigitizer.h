@@ -148,6 +148,12 @@ namespace DGtal
     */
     const PointEmbedder & pointEmbedder() const;
 
+    /**
+       @return the attached Euclidean shape.
+       @pre a shape has been attached.
+    */
+    const EuclideanShape & shape() const;
+
     /**
        @return the domain chosen for the digitizer.
        @see init
@@ -0,0 +1,301 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file HierarchicalGaussDigitizer.h
+ *
+ * @date 2026/10/18
+ *
+ * Header file for module HierarchicalGaussDigitizer.ih
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(HierarchicalGaussDigitizer_RECURSES)
+#error Recursive header files inclusion detected in HierarchicalGaussDigitizer.h
+#else // defined(HierarchicalGaussDigitizer_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define HierarchicalGaussDigitizer_RECURSES
+
+#if !defined HierarchicalGaussDigitizer_h
+/** Prevents repeated inclusion of headers. */
+#define HierarchicalGaussDigitizer_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <vector>
+#include <utility>
+#include "DGtal/base/Common.h"
+#include "DGtal/shapes/GaussDigitizer.h"
+#include "DGtal/images/ImageContainerBySTLVector.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class HierarchicalGaussDigitizer
+  /**
+     Description of template class 'HierarchicalGaussDigitizer' <p>
+     \brief Aim: Computes the Gauss digitization of a Euclidean shape
+     into an image, by recursive subdivision of the image domain
+     instead of point by point.
+
+     The domain is subdivided as an octree (a 2^n-tree in dimension
+     n). Each box is first classified with the method
+     `orientation( lowerBound, upperBound )` of the shape, which
+     returns INSIDE (resp. OUTSIDE) when every point of the box is
+     inside (resp. outside) the shape, and ON when it is unknown.
+     Classified boxes are filled in bulk, row by row, and the other
+     ones are subdivided until their size is at most the leaf size,
+     where points are classified one by one as GaussDigitizer
+     does. The result is thus the same as GaussDigitizer, while only
+     the points close to the boundary of the shape are evaluated.
+
+     If the shape has a method `void orientationRow( const RealPoint&
+     p, const Scalar* x, std::size_t nb, Orientation* orientations )
+     const` (e.g. ImplicitPolynomial3Shape), giving the orientations
+     of the points (x[i], p[1], ..., p[n-1]), the points of the
+     leaves are classified row by row with it.
+
+     The same subdivision extracts the boundary surfels of the
+     digitization (sMakeBoundary) in a narrow band around the
+     boundary of the shape, without digitizing the whole domain: the
+     memory used is proportional to the number of surfels.
+
+     Boxes and leaves of each level are processed in parallel when
+     OpenMP is available, writes in the image or in the set of surfels
+     being sequential.
+
+     @code
+     GaussDigitizer< Z3i::Space, ImplicitShape > dig;
+     dig.attach( shape );
+     dig.init( shape.getLowerBound(), shape.getUpperBound(), 0.1 );
+     ImageContainerBySTLVector< Z3i::Domain, bool > image( dig.getDomain() );
+     HierarchicalGaussDigitizer< Z3i::Space, ImplicitShape > hdig( dig );
+     hdig.digitize( image );
+     @endcode
+
+     @tparam TSpace the type of digital Space where the digitized
+     object lies.
+
+     @tparam TEuclideanShape a model of CEuclideanOrientedShape, with
+     a method `Orientation orientation( const RealPoint&, const
+     RealPoint& ) const` classifying boxes (e.g. ImplicitPolynomial3Shape
+     or ImplicitBall).
+   */
+  template <typename TSpace, typename TEuclideanShape>
+  class HierarchicalGaussDigitizer
+    : public GaussDigitizer<TSpace, TEuclideanShape>
+  {
+    // ----------------------- Standard services ------------------------------
+  public:
+    typedef GaussDigitizer<TSpace, TEuclideanShape> Base;
+    typedef TSpace Space;
+    typedef typename Space::Integer Integer;
+    typedef typename Space::Point Point;
+    typedef typename Space::Vector Vector;
+    typedef typename Space::RealPoint RealPoint;
+    typedef typename RealPoint::Component Scalar;
+    typedef typename Space::Dimension Dimension;
+    typedef TEuclideanShape EuclideanShape;
+    typedef HyperRectDomain<Space> Domain;
+
+    /**
+       Constructor from a (valid) Gauss digitizer, whose shape and
+       grid steps are used.
+
+       @param digitizer any Gauss digitizer.
+       @param leafSize the size of the boxes below which points are
+       classified one by one (see setLeafSize).
+    */
+    HierarchicalGaussDigitizer( const Base & digitizer, Integer leafSize = 8 );
+
+    /**
+       @param leafSize the size of the boxes below which points are
+       classified one by one (at least 1).
+    */
+    void setLeafSize( Integer leafSize );
+
+    /// @return the size of the boxes below which points are classified one by one.
+    Integer leafSize() const;
+
+    // ----------------------- Interface --------------------------------------
+  public:
+
+    /**
+       Computes the Gauss digitization of the shape in the domain of
+       the given image: each point is set to true (or 1) if it is
+       INSIDE or ON the shape, to false (or 0) otherwise.
+
+       @tparam TValue the type of the values of the image (e.g. bool).
+       @param[in,out] image any image.
+    */
+    template <typename TValue>
+    void digitize( ImageContainerBySTLVector<Domain, TValue> & image );
+
+    /**
+       Extracts the signed surfels lying between points of the
+       digitization and points outside, in the bounds [\a lower, \a
+       upper], as Surfaces::sMakeBoundary does with the digitizer as
+       point predicate. Only boxes close to the boundary of the shape
+       are evaluated. Surfels of all the connected components of the
+       boundary are extracted.
+
+       @tparam KSpace a model of CCellularGridSpaceND.
+       @tparam SCellSet a model of a set of SCell (e.g. std::set<SCell>).
+
+       @param[in,out] surfels the set where the boundary surfels are inserted.
+       @param[in] K any cellular grid space.
+       @param[in] lower the lowest point of the bounds (in \a K).
+       @param[in] upper the highest point of the bounds (in \a K).
+    */
+    template <typename KSpace, typename SCellSet>
+    void sMakeBoundary( SCellSet & surfels, const KSpace & K,
+                        const Point & lower, const Point & upper );
+
+    /// @return the number of boxes classified by the last call to digitize or sMakeBoundary.
+    std::size_t nbClassifiedBoxes() const;
+
+    /// @return the number of points classified one by one by the last call to digitize or sMakeBoundary.
+    std::size_t nbEvaluatedPoints() const;
+
+    /**
+     * Writes/Displays the object on an output stream.
+     * @param out the output stream where the object is written.
+     */
+    void selfDisplay ( std::ostream & out ) const;
+
+    /**
+     * Checks the validity/consistency of the object.
+     * @return 'true' if the object is valid, 'false' otherwise.
+     */
+    bool isValid() const;
+
+    // ------------------------- Private Datas --------------------------------
+  private:
+    /// The size of the boxes below which points are classified one by one.
+    Integer myLeafSize;
+    /// The number of boxes classified by the last call to digitize.
+    std::size_t myNbClassifiedBoxes;
+    /// The number of points classified one by one by the last call to digitize.
+    std::size_t myNbEvaluatedPoints;
+
+    // ------------------------- Internals ------------------------------------
+  private:
+    /// A box of the domain, as its lowest and highest points.
+    typedef std::pair<Point, Point> Box;
+
+    /**
+       Calls f( p, n ) for each row of the box, p being the first
+       point of the row and n its number of points.
+    */
+    template <typename Function>
+    static void forEachRow( const Box & box, Function f );
+
+    /**
+       Subdivides the box \a root level by level, each box B being
+       classified through the box extend( B ). Boxes classified INSIDE
+       or OUTSIDE are given to uniform( B, orientation ), and the
+       unclassified leaves of each level to leaves( vector of B ).
+    */
+    template <typename Extend, typename Uniform, typename Leaves>
+    void traverse( const Box & root, Extend extend, Uniform uniform, Leaves leaves );
+
+    /**
+       Classifies all the points of a box.
+       @param[in] box any box.
+       @param[in] x the embedded x coordinates of the points from \a x0.
+       @param[in] x0 the first coordinate of the point x[0].
+       @param[in,out] buffer the classification (true if INSIDE or ON)
+       of the points of \a box, in the order of forEachRow, is appended to this vector.
+    */
+    void classifyPoints( const Box & box, const std::vector<Scalar> & x, Integer x0,
+                         std::vector<char> & buffer ) const;
+
+    /// @return the embedded x coordinates of the points of the box.
+    std::vector<Scalar> embedX( const Box & box ) const;
+
+    /// @return the orientation of the box (INSIDE, OUTSIDE or ON if unknown).
+    Orientation classify( const Box & box ) const;
+
+    /// @return 'true' if the box is small enough to be a leaf.
+    bool isLeaf( const Box & box ) const;
+
+    /**
+       Subdivides the box by halving its sides larger than the leaf size.
+       @param[in] box any box.
+       @param[in,out] children the children are appended to this vector.
+    */
+    void split( const Box & box, std::vector<Box> & children ) const;
+
+    /**
+       Classifies the points of a row one by one.
+       @param[in] shape the shape.
+       @param[in] p the first point of the row.
+       @param[in] n the number of points of the row.
+       @param[in] x the embedded x coordinates of the points of the row.
+       @param[in,out] buffer the classification (true if INSIDE or ON) is appended to this vector.
+    */
+    template <typename Shape>
+    void classifyRow( const Shape & shape, Point p, Integer n, const Scalar* x,
+                      std::vector<char> & buffer, long ) const;
+
+    /**
+       Classifies the points of a row with the method orientationRow of the shape.
+       @param[in] shape the shape.
+       @param[in] p the first point of the row.
+       @param[in] n the number of points of the row.
+       @param[in] x the embedded x coordinates of the points of the row.
+       @param[in,out] buffer the classification (true if INSIDE or ON) is appended to this vector.
+    */
+    template <typename Shape>
+    auto classifyRow( const Shape & shape, const Point & p, Integer n, const Scalar* x,
+                      std::vector<char> & buffer, int ) const
+      -> decltype( shape.orientationRow( std::declval<RealPoint>(), x,
+                                         std::size_t( 0 ), (Orientation*) 0 ), void() );
+
+  }; // end of class HierarchicalGaussDigitizer
+
+
+  /**
+   * Overloads 'operator<<' for displaying objects of class 'HierarchicalGaussDigitizer'.
+   * @param out the output stream where the object is written.
+   * @param object the object of class 'HierarchicalGaussDigitizer' to write.
+   * @return the output stream after the writing.
+   */
+  template <typename TSpace, typename TEuclideanShape>
+  std::ostream&
+  operator<< ( std::ostream & out,
+               const HierarchicalGaussDigitizer<TSpace,TEuclideanShape> & object );
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/shapes/HierarchicalGaussDigitizer.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined HierarchicalGaussDigitizer_h
+
+#undef HierarchicalGaussDigitizer_RECURSES
+#endif // else defined(HierarchicalGaussDigitizer_RECURSES)
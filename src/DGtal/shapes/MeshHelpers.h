@@ -41,6 +41,9 @@
 //////////////////////////////////////////////////////////////////////////////
 // Inclusions
 #include <iostream>
+#include <array>
+#include <utility>
+#include <vector>
 #include "DGtal/base/Common.h"
 #include "DGtal/topology/CCellEmbedder.h"
 #include "DGtal/topology/CDigitalSurfaceContainer.h"
@@ -228,6 +231,32 @@ namespace DGtal
      const CellEmbedder& cembedder,
      SurfaceMesh<typename CellEmbedder::Value,typename CellEmbedder::Value>& polysurf,
      CellMap& cellmap );
+
+    /// Numbers the primal vertices (0-cells) of a digital surface in
+    /// K^3 (class DigitalSurface) and gives the quadrangular face of
+    /// each surfel, as flat arrays. Vertices are numbered in the order
+    /// of their first appearance when visiting the surfels of \a dsurf
+    /// and their ccw primal vertices, as
+    /// digitalSurface2PrimalPolygonalSurface does.
+    ///
+    /// Surfels are cut into slabs of consecutive surfels, processed in
+    /// parallel when OpenMP is available: each slab sorts the 0-cells
+    /// of its surfels into a local vertex table, and the tables are
+    /// then merged, 0-cells shared by several slabs being stitched by
+    /// a canonical key (their Khalimsky coordinates packed into a 64
+    /// bits integer when the surface is small enough).
+    ///
+    /// @tparam DigitalSurfaceContainer the container chosen for the digital surface.
+    ///
+    /// @param[in]  dsurf the input digital surface.
+    /// @param[out] vertices the 0-cells of \a dsurf in increasing order, each one with its index.
+    /// @param[out] faces the indices of the ccw primal vertices of each surfel of \a dsurf, in the order of the surfels.
+    template < typename DigitalSurfaceContainer >
+    static
+    void digitalSurface2PrimalFaces
+    ( const DigitalSurface<DigitalSurfaceContainer>& dsurf,
+      std::vector< std::pair< typename DigitalSurfaceContainer::KSpace::Cell, std::size_t > >& vertices,
+      std::vector< std::array< std::size_t, 4 > >& faces );
     
     
     /// Builds a mesh (class Mesh) from a triangulated surface (class
@@ -340,6 +369,25 @@ namespace DGtal
       const Color& diffuse_color,
       const Color& specular_color );
 
+    // ------------------------- Internals ------------------------------------
+  private:
+
+    /// Numbers the distinct keys of a range in the order of their
+    /// first appearance. The range is cut into slabs sorted in
+    /// parallel, whose tables are merged.
+    ///
+    /// @tparam Key any type with operator< and operator==.
+    ///
+    /// @param[in]  keys the keys, each position being called a slot.
+    /// @param[out] groups for each distinct key, in increasing order, its first slot and its number.
+    /// @param[out] slot_numbers for each slot, the number of its key.
+    template < typename Key >
+    static
+    void numberKeys
+    ( const std::vector< Key >& keys,
+      std::vector< std::pair< std::size_t, std::size_t > >& groups,
+      std::vector< std::size_t >& slot_numbers );
+
   }; // end of class MeshHelpers
 
 } // namespace DGtal
@@ -37,6 +37,8 @@
 #include "DGtal/shapes/Mesh.h"
 #include "DGtal/shapes/IntersectionTarget.h"
 #include "DGtal/kernel/SpaceND.h"
+#include <vector>
+#include <unordered_map>
 #include "DGtal/kernel/sets/CDigitalSet.h"
 #include "DGtal/geometry/tools/determinant/PredicateFromOrientationFunctor2.h"
 #include "DGtal/geometry/tools/determinant/InHalfPlaneBySimple3x3Matrix.h"
@@ -71,6 +73,18 @@ namespace DGtal
    @image html 6-sep.png "Template for 6-separating digitization"
    @image html 26-sep.png "Template for 26-separating digitization"
 
+   The voxelizer may also be set in conservative mode (see
+   setConservative). Then, a voxel belongs to the digitization if
+   and only if its unit cube intersects the triangle, whatever the
+   separation. The triangle/box overlap test of Schwarz and Seidel
+   (2010) is applied column by column: the plane of the triangle
+   gives the range of voxels of each column of its bounding box.
+
+   When voxelizing a mesh, voxels are collected in a sparse set of
+   bit-packed 4x4x4 tiles, which are inserted in the output set at
+   the end. With OpenMP (WITH_OPENMP), each thread has its own tiles,
+   and they are merged without locks.
+
 
    @tparam TDigitalSet a DigitalSet (model of concepts::CDigitalSet)
    @tparam Separation strategy of the voxelization (6 or 26)
@@ -110,6 +124,23 @@ namespace DGtal
      */
     MeshVoxelizer() = default;
 
+    /**
+     * Sets the voxelization mode.
+     * @param conservative when 'true', all the voxels whose unit cube
+     * intersects the triangles are output, otherwise the voxels whose
+     * separating template intersects them.
+     */
+    void setConservative( bool conservative = true )
+    {
+      myConservative = conservative;
+    }
+
+    /// @return 'true' iff the voxelization is conservative.
+    bool isConservative() const
+    {
+      return myConservative;
+    }
+
     // ----------------------- Standard services ------------------------------
     /**
      * Voxelize the mesh into the digital set.
@@ -201,20 +232,94 @@ namespace DGtal
      * @param C Point C
      * @param n normal of ABC
      * @param bbox bounding box of ABC
+     * @tparam VoxelSet any type with methods `domain()` and `insert( PointZ3 )`.
      */
-    void voxelizeTriangle(DigitalSet &outputSet,
+    template <typename VoxelSet>
+    void voxelizeTriangle(VoxelSet &outputSet,
                           const PointR3& A,
                           const PointR3& B,
                           const PointR3& C,
                           const VectorR3& n,
                           const std::pair<PointZ3, PointZ3>& bbox);
 
+    /**
+     * Conservative voxelization of ABC to the digitalSet: outputs
+     * the voxels whose unit cube intersects ABC.
+     * @param [out] outputSet the set that collects the voxels.
+     * @param A Point A
+     * @param B Point B
+     * @param C Point C
+     * @tparam VoxelSet any type with methods `domain()` and `insert( PointZ3 )`.
+     */
+    template <typename VoxelSet>
+    static
+    void voxelizeTriangleConservative(VoxelSet &outputSet,
+                                      const PointR3& A,
+                                      const PointR3& B,
+                                      const PointR3& C);
+
+    // ----------------------- Internal types ------------------------------
+
+  private:
+
+    /**
+     * A sparse set of voxels of a domain, made of 4x4x4 tiles whose
+     * voxels are the bits of a 64-bit word. Used by each thread to
+     * collect voxels when voxelizing a mesh.
+     */
+    struct VoxelTiles
+    {
+      /// Constructor.
+      /// @param aDomain the domain of the voxels.
+      VoxelTiles( const Domain& aDomain );
+
+      /// @return the domain of the voxels.
+      const Domain& domain() const
+      {
+        return myDomain;
+      }
+
+      /// Inserts a voxel.
+      /// @param v any voxel of the domain.
+      void insert( const PointZ3& v );
+
+      /// Merges several sets of tiles and inserts their voxels.
+      /// @param tiles the sets of tiles, which are cleared.
+      /// @param [out] outputSet the set that collects the voxels.
+      static void merge( std::vector< VoxelTiles >& tiles, DigitalSet& outputSet );
+
+      /// The domain of the voxels.
+      Domain myDomain;
+      /// The number of tiles along x and y.
+      DGtal::uint64_t myNbTiles[ 2 ];
+      /// The bits of the non empty tiles.
+      std::unordered_map< DGtal::uint64_t, DGtal::uint64_t > myWords;
+    };
+
+    /**
+     * Voxelize the triangle (a,b,c), according to the voxelization mode.
+     * @param [out] outputSet the set that collects the voxels.
+     * @param [in] a the first point of the triangle
+     * @param [in] b the second point of the triangle
+     * @param [in] c the third point of the triangle
+     * @param [in] scaleFactor the scale factor to apply to the triangle
+     * @tparam VoxelSet any type with methods `domain()` and `insert( PointZ3 )`.
+     * @tparam MeshPoint the type of point of the triangle.
+     */
+    template<typename VoxelSet, typename MeshPoint>
+    void voxelizeFace(VoxelSet &outputSet,
+                      const MeshPoint &a, const MeshPoint &b, const MeshPoint &c,
+                      const double scaleFactor);
+
     // ----------------------- Members ------------------------------
 
   private:
 
     ///Intersection target
     IntersectionTarget myIntersectionTarget;
+
+    ///When 'true', the voxelization is conservative.
+    bool myConservative = false;
   };
 }
 
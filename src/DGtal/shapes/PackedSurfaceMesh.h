@@ -0,0 +1,686 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file PackedSurfaceMesh.h
+ *
+ * @date 2026/10/18
+ *
+ * Header file for module PackedSurfaceMesh.ih
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(PackedSurfaceMesh_RECURSES)
+#error Recursive header files inclusion detected in PackedSurfaceMesh.h
+#else // defined(PackedSurfaceMesh_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define PackedSurfaceMesh_RECURSES
+
+#if !defined PackedSurfaceMesh_h
+/** Prevents repeated inclusion of headers. */
+#define PackedSurfaceMesh_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <vector>
+#include <set>
+#include <map>
+#include <tuple>
+#include <utility>
+#include "DGtal/base/Common.h"
+#include "DGtal/base/IntegerSequenceIterator.h"
+#include "DGtal/shapes/SurfaceMesh.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+  /////////////////////////////////////////////////////////////////////////////
+  // template class PackedSurfaceMesh
+  /**
+     Description of template class 'PackedSurfaceMesh' <p> \brief Aim:
+     Represents a frozen SurfaceMesh, whose incidence and adjacency
+     relations are packed in compressed sparse row (CSR) format.
+
+     A SurfaceMesh stores each range of incident vertices, incident
+     faces, neighbors or faces around an edge in its own
+     std::vector, i.e. one memory allocation per vertex, face and
+     edge. Here, all the ranges of a relation are stored contiguously
+     in one array of indices, the range of element i being delimited
+     by offsets[i] and offsets[i+1] (see Ranges). The topology of the
+     mesh cannot be modified, but positions and normals can.
+
+     The mesh exposes the same query services as SurfaceMesh (same
+     indices, same ranges in the same order), except that ranges are
+     returned as lightweight views (see Range) instead of references
+     to vectors. It is built from a SurfaceMesh, from positions and
+     faces (computing the relations directly into packed arrays), or
+     by SurfaceMeshReader::readOBJ.
+
+     @code
+     SurfaceMesh< RealPoint, RealVector > smesh = ...;
+     PackedSurfaceMesh< RealPoint, RealVector > pmesh( smesh );
+     for ( auto f : pmesh.incidentFaces( 0 ) ) ...
+     @endcode
+
+     @tparam TRealPoint an arbitrary model of 3D RealPoint.
+     @tparam TRealVector an arbitrary model of 3D RealVector.
+  */
+  template < typename TRealPoint, typename TRealVector >
+  struct PackedSurfaceMesh
+  {
+    typedef TRealPoint                                  RealPoint;
+    typedef TRealVector                                 RealVector;
+    typedef PackedSurfaceMesh< RealPoint, RealVector >  Self;
+    typedef DGtal::SurfaceMesh< RealPoint, RealVector > SurfaceMesh;
+
+    static const Dimension dimension = RealPoint::dimension;
+    BOOST_STATIC_ASSERT( ( dimension == 3 ) );
+
+    typedef typename SurfaceMesh::Scalar            Scalar;
+    typedef typename SurfaceMesh::Scalars           Scalars;
+    typedef typename SurfaceMesh::Size              Size;
+    typedef typename SurfaceMesh::Index             Index;
+    typedef typename SurfaceMesh::Face              Face;
+    typedef typename SurfaceMesh::Edge              Edge;
+    typedef typename SurfaceMesh::Vertex            Vertex;
+    typedef typename SurfaceMesh::WeightedEdge      WeightedEdge;
+    typedef typename SurfaceMesh::WeightedFace      WeightedFace;
+    typedef typename SurfaceMesh::Vertices          Vertices;
+    typedef typename SurfaceMesh::Edges             Edges;
+    typedef typename SurfaceMesh::WeightedEdges     WeightedEdges;
+    typedef typename SurfaceMesh::Faces             Faces;
+    typedef typename SurfaceMesh::WeightedFaces     WeightedFaces;
+    typedef typename SurfaceMesh::VertexPair        VertexPair;
+
+    // Required by CUndirectedSimpleLocalGraph
+    typedef std::set<Vertex>                   VertexSet;
+    template <typename Value> struct           VertexMap {
+      typedef typename std::map<Vertex, Value> Type;
+    };
+
+    // Required by CUndirectedSimpleGraph
+
+    /// Non mutable iterator for visiting vertices.
+    typedef IntegerSequenceIterator< Vertex >       ConstIterator;
+
+    /// The algorithms shared with SurfaceMesh.
+    typedef SurfaceMeshAlgorithms< Self >           Algorithms;
+
+    /// A non mutable view on a contiguous range of indices.
+    struct Range
+    {
+      typedef Index          value_type;
+      typedef const Index*   const_iterator;
+      typedef const Index*   iterator;
+      typedef const Index&   const_reference;
+      typedef const Index&   reference;
+      typedef Size           size_type;
+
+      Range() : myBegin( nullptr ), myEnd( nullptr ) {}
+      Range( const Index* b, const Index* e ) : myBegin( b ), myEnd( e ) {}
+
+      const_iterator begin() const  { return myBegin; }
+      const_iterator end() const    { return myEnd; }
+      const_iterator cbegin() const { return myBegin; }
+      const_iterator cend() const   { return myEnd; }
+      Size size() const             { return myEnd - myBegin; }
+      bool empty() const            { return myBegin == myEnd; }
+      const Index& operator[]( Size i ) const { return myBegin[ i ]; }
+      const Index& front() const    { return *myBegin; }
+      const Index& back() const     { return *( myEnd - 1 ); }
+      /// @return a copy of the range as a vector.
+      operator std::vector< Index >() const
+      { return std::vector< Index >( myBegin, myEnd ); }
+
+    private:
+      const Index* myBegin;
+      const Index* myEnd;
+    };
+
+    /**
+       Ranges of indices packed in compressed sparse row format: the
+       range i is `indices[ offsets[ i ] ... offsets[ i+1 ] - 1 ]`.
+    */
+    struct Ranges
+    {
+      /// The offsets of the ranges (the number of ranges plus one).
+      std::vector< Size >  offsets;
+      /// The indices of all the ranges, one after the other.
+      std::vector< Index > indices;
+
+      Ranges() : offsets( 1, 0 ) {}
+      /// Builds ranges from a range of ranges of indices (e.g. std::vector< Vertices >).
+      template <typename RangesIterator>
+      Ranges( RangesIterator it, RangesIterator itEnd );
+
+      /// @return the number of ranges.
+      Size size() const { return offsets.size() - 1; }
+      /// @return 'true' if there is no range.
+      bool empty() const { return size() == 0; }
+      /// @param i any valid range index.
+      /// @return the view on the range \a i.
+      Range operator[]( Size i ) const
+      { return Range( indices.data() + offsets[ i ], indices.data() + offsets[ i + 1 ] ); }
+      /// Removes all the ranges.
+      void clear() { offsets.assign( 1, 0 ); indices.clear(); }
+      /// Appends a range of indices as a new range.
+      template <typename IndexIterator>
+      void push_back( IndexIterator it, IndexIterator itEnd )
+      {
+        indices.insert( indices.end(), it, itEnd );
+        offsets.push_back( indices.size() );
+      }
+    };
+
+    //---------------------------------------------------------------------------
+  public:
+    /// @name Standard services
+    /// @{
+
+    /// Default destructor.
+    ~PackedSurfaceMesh() = default;
+    /// Default constructor. The mesh is empty.
+    PackedSurfaceMesh() = default;
+    /// Default copy constructor.
+    /// @param other the object to clone
+    PackedSurfaceMesh( const Self& other ) = default;
+    /// Default move constructor.
+    /// @param other the object to move
+    PackedSurfaceMesh( Self&& other ) = default;
+    /// Default assignment constructor.
+    /// @param other the object to clone
+    /// @return a reference to 'this'.
+    Self& operator=( const Self& other ) = default;
+    /// Default move assignment.
+    /// @param other the object to move
+    /// @return a reference to 'this'.
+    Self& operator=( Self&& other ) = default;
+
+    /// Packs the given surface mesh, with its normals.
+    /// @param smesh any surface mesh.
+    explicit PackedSurfaceMesh( const SurfaceMesh& smesh );
+
+    /// Packs the given surface mesh, with its normals (clears everything before).
+    /// @param smesh any surface mesh.
+    void init( const SurfaceMesh& smesh );
+
+    /// Initializes a mesh from vertex positions and polygonal faces
+    /// (clears everything before), as SurfaceMesh::init. All relations
+    /// are computed directly in packed form.
+    ///
+    /// @tparam RealPointIterator any forward iterator on RealPoint.
+    /// @tparam VerticesIterator any forward iterator on a range of vertices.
+    ///
+    /// @param itPos start of range of iterators pointing on the positions of vertices of the mesh
+    /// @param itPosEnd end of range of iterators pointing on the positions of vertices of the mesh.
+    /// @param itVertices start of range of iterators pointing on the (oriented)
+    ///   faces of the mesh, each face being a range of vertex indices.
+    /// @param itVerticesEnd end of range of iterators pointing on the (oriented)
+    ///   faces of the mesh, each face being a range of vertex indices.
+    /// @return 'true' if all the vertices of faces were valid (invalid ones are ignored).
+    template <typename RealPointIterator, typename VerticesIterator>
+    bool init( RealPointIterator itPos, RealPointIterator itPosEnd,
+               VerticesIterator itVertices, VerticesIterator itVerticesEnd );
+
+    /// Initializes a mesh from vertex positions and packed polygonal faces
+    /// (clears everything before). All relations are computed directly
+    /// in packed form.
+    ///
+    /// @param positions the positions of the vertices (moved into the mesh).
+    /// @param faces the (oriented) faces of the mesh, each face being a range of vertex indices (moved into the mesh).
+    /// @return 'true' if all the vertices of faces were valid (invalid ones are ignored).
+    bool init( std::vector< RealPoint >&& positions, Ranges&& faces );
+
+    /// Clears everything. The object is empty.
+    void clear();
+
+    /// @}
+
+    //---------------------------------------------------------------------------
+  public:
+    /// @name Vertex and face vectors initialization and conversion services
+    /// @{
+
+    /// Given a range of real vectors, sets the normals of every
+    /// vertex to the given vectors.
+    template <typename RealVectorIterator>
+    bool setVertexNormals( RealVectorIterator itN, RealVectorIterator itNEnd );
+
+    /// Given a range of real vectors, sets the normals of every
+    /// face to the given vectors.
+    template <typename RealVectorIterator>
+    bool setFaceNormals( RealVectorIterator itN, RealVectorIterator itNEnd );
+
+    /// Uses the positions of vertices to compute a normal vector to
+    /// each face of the mesh (see SurfaceMesh::computeFaceNormalsFromPositions).
+    void computeFaceNormalsFromPositions();
+
+    /// Uses the positions of vertices to compute a normal vector to
+    /// the face \a f of the mesh.
+    /// @param f any valid index of face.
+    void computeFaceNormalFromPositions( const Face f );
+
+    /// Uses the normals associated with vertices to compute a normal
+    /// vector to each face of the mesh, by averaging.
+    void computeFaceNormalsFromVertexNormals();
+
+    /// Uses the normals associated with faces to compute a normal
+    /// vector to each vertex of the mesh, by averaging.
+    void computeVertexNormalsFromFaceNormals();
+
+    /// Uses the normals associated with faces to compute a normal
+    /// vector to each vertex of the mesh, with Max's weights \cite max1999weights.
+    void computeVertexNormalsFromFaceNormalsWithMaxWeights();
+
+    /// @param vvalues any vector of vertex values.
+    /// @return a vector of face values approximating \a vvalues.
+    /// @tparam AnyRing any summable and averagable type.
+    template <typename AnyRing>
+    std::vector<AnyRing> computeFaceValuesFromVertexValues
+    ( const std::vector<AnyRing>& vvalues ) const;
+
+    /// @param fvalues any vector of vertex values.
+    /// @return a vector of vertex values approximating \a fvalues.
+    /// @tparam AnyRing any summable and averagable type.
+    template <typename AnyRing>
+    std::vector<AnyRing> computeVertexValuesFromFaceValues
+    ( const std::vector<AnyRing>& fvalues ) const;
+
+    /// @param vuvectors any vector of unit vectors on vertices.
+    /// @return a vector of unit vectors on faces approximating \a vuvectors.
+    std::vector<RealVector> computeFaceUnitVectorsFromVertexUnitVectors
+    ( const std::vector<RealVector>& vuvectors ) const;
+
+    /// @param fuvectors any vector of unit vectors on faces.
+    /// @return a vector of unit vectors on vertices approximating \a fuvectors.
+    std::vector<RealVector> computeVertexUnitVectorsFromFaceUnitVectors
+    ( const std::vector<RealVector>& fuvectors ) const;
+
+    /// @}
+
+    //---------------------------------------------------------------------------
+  public:
+    /// @name Accessors
+    /// @{
+
+    /// @return the number of vertices of the mesh.
+    Size nbVertices() const
+    { return myPositions.size(); }
+    /// @return the number of (unordered) edges of the mesh.
+    Size nbEdges() const
+    { return myEdgeVertices.size(); }
+    /// @return the number of faces of the mesh.
+    Size nbFaces() const
+    { return myIncidentVertices.size(); }
+    /// @return the euler characteristic of the mesh.
+    long Euler() const
+    { return nbVertices() - nbEdges() + nbFaces(); }
+    /// @param i any vertex of the mesh
+    /// @param j any vertex of the mesh
+    /// @return the edge index of edge (i,j) or `nbEdges()` if this
+    /// edge does not exist.
+    /// @note O(log E) time complexity.
+    Edge makeEdge( Vertex i, Vertex j ) const;
+    /// @param f any face
+    /// @return the range giving for face \a f its incident vertices.
+    Range incidentVertices( Face f ) const
+    { return myIncidentVertices[ f ]; }
+    /// @param v any vertex
+    /// @return the range giving for vertex \a v its incident faces.
+    Range incidentFaces( Vertex v ) const
+    { return myIncidentFaces[ v ]; }
+    /// @param f any face
+    /// @return the range of neighbor faces for face \a f.
+    Range neighborFaces( Face f ) const
+    { return myNeighborFaces[ f ]; }
+    /// @param v any vertex
+    /// @return the range of neighbor vertices for vertex \a v.
+    Range neighborVertices( Vertex v ) const
+    { return myNeighborVertices[ v ]; }
+    /// @param e any edge
+    /// @return a pair giving for edge \a e its two vertices (as a
+    /// pair (i,j), i<j).
+    VertexPair edgeVertices( Edge e ) const
+    { return myEdgeVertices[ e ]; }
+    /// @param e any edge
+    /// @return the range giving for edge \a e its incident faces
+    /// (one, two, or more if non manifold)
+    Range edgeFaces( Edge e ) const
+    { return myEdgeFaces[ e ]; }
+    /// @param e any edge
+    /// @return the range giving for edge \a e its incident faces to
+    /// its right, i.e. some `(..., j, i, ... )`.
+    Range edgeRightFaces( Edge e ) const
+    { return myEdgeRightFaces[ e ]; }
+    /// @param e any edge
+    /// @return the range giving for edge \a e its incident faces to
+    /// its left, i.e. some `(..., i, j, ... )`.
+    Range edgeLeftFaces( Edge e ) const
+    { return myEdgeLeftFaces[ e ]; }
+    /// @return the packed incident vertices of all faces.
+    const Ranges& allIncidentVertices() const
+    { return myIncidentVertices; }
+    /// @return the packed incident faces of all vertices.
+    const Ranges& allIncidentFaces() const
+    { return myIncidentFaces; }
+    /// @return the packed neighbor faces of all faces.
+    const Ranges& allNeighborFaces() const
+    { return myNeighborFaces; }
+    /// @return the packed neighbor vertices of all vertices.
+    const Ranges& allNeighborVertices() const
+    { return myNeighborVertices; }
+    /// @return a vector giving for each edge its two vertices (as a
+    /// pair (i,j), i<j).
+    const std::vector< VertexPair >& allEdgeVertices() const
+    { return myEdgeVertices; }
+    /// @return the packed incident faces of all edges.
+    const Ranges& allEdgeFaces() const
+    { return myEdgeFaces; }
+    /// @return the packed right incident faces of all edges.
+    const Ranges& allEdgeRightFaces() const
+    { return myEdgeRightFaces; }
+    /// @return the packed left incident faces of all edges.
+    const Ranges& allEdgeLeftFaces() const
+    { return myEdgeLeftFaces; }
+
+    /// @}
+
+    //---------------------------------------------------------------------------
+  public:
+    /// @name Other topological services
+    /// @{
+
+    /// @return the edges that lie on the boundary of the mesh,
+    /// i.e. they have only one incident face.
+    Edges computeManifoldBoundaryEdges() const;
+    /// @return the edges that lie on the inside of the mesh, with
+    /// two incident faces, consistently oriented or not.
+    Edges computeManifoldInnerEdges() const;
+    /// @return the edges that lie on the inside of the mesh, with
+    /// one left incident face, and one right incident face.
+    Edges computeManifoldInnerConsistentEdges() const;
+    /// @return the edges that have two incident faces, but not
+    /// correctly oriented.
+    Edges computeManifoldInnerUnconsistentEdges() const;
+    /// @return the edges that are non manifold, i.e. neither boundary
+    /// or inner edges.
+    Edges computeNonManifoldEdges() const;
+    /// An edge is (topologically) flippable iff: (1) it does not lie
+    /// on the boundary, (2) it is bordered by two triangles, one that
+    /// to its right, one to its left, (3) the two other vertices of
+    /// the quad are not already neighbors (see SurfaceMesh::isFlippable).
+    /// @param e any edge.
+    /// @return 'true' if the edge \a e is topologically flippable.
+    bool isFlippable( const Edge e ) const;
+    /// @pre `isFlippable( e )` must be true.
+    /// @param e any edge.
+    /// @return the two other vertices of the quadrilateral around the edge \a e.
+    VertexPair otherDiagonal( const Edge e ) const;
+
+    /// @}
+
+    // ----------------------- Undirected simple graph services ----------------------
+  public:
+    /// @name Undirected simple graph services
+    /// @{
+
+    /// @return the number of vertices of the surface.
+    Size size() const
+    { return nbVertices(); }
+    /// @return an estimate of the maximum number of neighbors for this adjacency
+    Size bestCapacity() const
+    { return 8; }
+    /// @param v any vertex
+    /// @return the number of neighbors of this vertex
+    Size degree( const Vertex & v ) const
+    { return myNeighborVertices[ v ].size(); }
+    /**
+     * Writes the neighbors of a vertex using an output iterator
+     * @param it the output iterator
+     * @param v the vertex whose neighbors will be writen
+     */
+    template <typename OutputIterator>
+    void
+    writeNeighbors( OutputIterator &it ,
+                    const Vertex & v ) const
+    {
+      for ( auto&& nv : myNeighborVertices[ v ] )
+        *it++ = nv;
+    }
+    /**
+     * Writes the neighbors of a vertex which satisfy a predicate using an
+     * output iterator
+     * @param it the output iterator
+     * @param v the vertex whose neighbors will be written
+     * @param pred the predicate that must be satisfied
+     */
+    template <typename OutputIterator, typename VertexPredicate>
+    void
+    writeNeighbors( OutputIterator &it ,
+                    const Vertex & v,
+                    const VertexPredicate & pred) const
+    {
+      for ( auto&& nv : myNeighborVertices[ v ] )
+        if ( pred( nv ) ) *it++ = nv;
+    }
+    /// @return a (non mutable) iterator pointing on the first vertex.
+    ConstIterator begin() const
+    { return ConstIterator( 0 ); }
+    /// @return a (non mutable) iterator pointing after the last vertex.
+    ConstIterator end() const
+    { return ConstIterator( nbVertices() ); }
+
+    /// @}
+
+    //---------------------------------------------------------------------------
+  public:
+    /// @name Geometric services
+    /// @{
+
+    /// @return a const reference to the vector of positions (of vertices).
+    const std::vector< RealPoint >& positions() const
+    { return myPositions; }
+    /// Mutable accessor to vertex position.
+    /// @param v any vertex.
+    /// @return the mutable position associated to \a v.
+    RealPoint& position( Vertex v )
+    { return myPositions[ v ]; }
+    /// Const accessor to vertex position.
+    /// @param v any vertex.
+    /// @return the non-mutable position associated to \a v.
+    const RealPoint& position( Vertex v ) const
+    { return myPositions[ v ]; }
+    /// @return a const reference to the vector of normals to vertices.
+    const std::vector< RealVector >& vertexNormals() const
+    { return myVertexNormals; }
+    /// @return a reference to the vector of normals to vertices.
+    std::vector< RealVector >& vertexNormals()
+    { return myVertexNormals; }
+    /// Mutable accessor to vertex normal.
+    /// @param v any vertex.
+    /// @return the mutable normal associated to \a v.
+    RealVector& vertexNormal( Vertex v )
+    { return myVertexNormals[ v ]; }
+    /// Const accessor to vertex normal.
+    /// @param v any vertex.
+    /// @return the non-mutable normal associated to \a v.
+    const RealVector& vertexNormal( Vertex v ) const
+    { return myVertexNormals[ v ]; }
+    /// @return a const reference to the vector of normals to faces.
+    const std::vector< RealVector >& faceNormals() const
+    { return myFaceNormals; }
+    /// @return a reference to the vector of normals to faces.
+    std::vector< RealVector >& faceNormals()
+    { return myFaceNormals; }
+    /// Mutable accessor to face normal.
+    /// @param f any face.
+    /// @return the mutable normal associated to \a f.
+    RealVector& faceNormal( Face f )
+    { return myFaceNormals[ f ]; }
+    /// Const accessor to face normal.
+    /// @param f any face.
+    /// @return the non-mutable normal associated to \a f.
+    const RealVector& faceNormal( Face f ) const
+    { return myFaceNormals[ f ]; }
+    /// @return the average of the length of edges.
+    Scalar averageEdgeLength() const;
+    ///@return the Euclidean distance between any two vertices i and j.
+    ///@param i first vertex
+    ///@param j second vertex
+    Scalar distance( const Vertex i, const Vertex j ) const
+    { return ( myPositions[ i ] - myPositions[ j ] ).norm(); }
+    /// @param f any valid face index
+    /// @return the average distance between the centroid of face \a f
+    /// and its vertices.
+    Scalar localWindow( Face f ) const;
+    /// @param e any valid edge index.
+    /// @return the centroid (or barycenter) of edge \a f.
+    RealPoint edgeCentroid( Index e ) const;
+    /// @param f any valid face index.
+    /// @return the centroid (or barycenter) of face \a f.
+    RealPoint faceCentroid( Index f ) const;
+    /// @param f any valid face index.
+    /// @return the area of face \a f.
+    Scalar faceArea( Index f ) const;
+    /// @param v any valid vertex index.
+    /// @return the Max's weights for each incident face to \a v, in the same order as `incidentFaces( v )`.
+    Scalars getMaxWeights( Index v ) const;
+    /// @param r the radius of the ball.
+    /// @param f the face where the ball is centered.
+    /// @return the faces intersecting the ball of radius \a r
+    /// centered on the centroid of \a f, with their ratio of
+    /// inclusion (see SurfaceMesh::computeFacesInclusionsInBall).
+    WeightedFaces
+    computeFacesInclusionsInBall( Scalar r, Index f ) const;
+    /// @param r the radius of the ball.
+    /// @param f the face where the ball is centered.
+    /// @param p the position on the face where the ball is centered.
+    /// @return the faces intersecting the ball of radius \a r
+    /// centered on \a p, with their ratio of inclusion (see
+    /// SurfaceMesh::computeFacesInclusionsInBall).
+    WeightedFaces
+    computeFacesInclusionsInBall( Scalar r, Index f, RealPoint p ) const;
+    /// @param r the radius of the ball.
+    /// @param f the face where the ball is centered.
+    /// @return the vertices/edges/faces intersecting the ball of
+    /// radius \a r centered on the centroid of \a f, edges and faces
+    /// with their ratio of inclusion (see SurfaceMesh::computeCellsInclusionsInBall).
+    std::tuple< Vertices, WeightedEdges, WeightedFaces >
+    computeCellsInclusionsInBall( Scalar r, Index f ) const;
+    /// @param r the radius of the ball.
+    /// @param f the face where the ball is centered.
+    /// @param p the position on the face where the ball is centered.
+    /// @return the vertices/edges/faces intersecting the ball of
+    /// radius \a r centered on \a p, edges and faces with their ratio
+    /// of inclusion (see SurfaceMesh::computeCellsInclusionsInBall).
+    std::tuple< Vertices, WeightedEdges, WeightedFaces >
+    computeCellsInclusionsInBall( Scalar r, Index f, RealPoint p ) const;
+    /// @param p the center of the ball.
+    /// @param r the radius of the ball.
+    /// @param f any index of face.
+    /// @return an approximation of the inclusion ratio of face \a f in the ball.
+    Scalar faceInclusionRatio( RealPoint p, Scalar r, Index f ) const;
+    /// @param p the center of the ball.
+    /// @param r the radius of the ball.
+    /// @param e any index of edge.
+    /// @return an approximation of the inclusion ratio of edge \a e in the ball.
+    Scalar edgeInclusionRatio( RealPoint p, Scalar r, Index e ) const;
+    /// @param p the center of the ball.
+    /// @param r the radius of the ball.
+    /// @param v any index of vertex.
+    /// @return the inclusion ratio of vertex \a v in the ball, either 0 or 1.
+    Scalar vertexInclusionRatio( RealPoint p, Scalar r, Index v ) const;
+
+    /// @}
+
+    // ----------------------- Interface --------------------------------------
+  public:
+
+    /**
+     * Writes/Displays the object on an output stream.
+     * @param out the output stream where the object is written.
+     */
+    void selfDisplay ( std::ostream & out ) const;
+
+    /**
+     * Checks the validity/consistency of the object.
+     * @return 'true' if the object is valid, 'false' otherwise.
+     */
+    bool isValid() const;
+
+    // ------------------------- Protected Datas ------------------------------
+  protected:
+    /// For each face, its range of incident vertices
+    Ranges                      myIncidentVertices;
+    /// For each vertex, its range of incident faces
+    Ranges                      myIncidentFaces;
+    /// For each vertex, its position
+    std::vector< RealPoint >    myPositions;
+    /// For each vertex, its normal vector
+    std::vector< RealVector >   myVertexNormals;
+    /// For each face, its normal vector
+    std::vector< RealVector >   myFaceNormals;
+    /// For each face, its range of neighbor faces
+    Ranges                      myNeighborFaces;
+    /// For each vertex, its range of neighbor vertices
+    Ranges                      myNeighborVertices;
+    /// For each edge, its two vertices
+    std::vector< VertexPair >   myEdgeVertices;
+    /// The edges sorted by vertex pairs (for makeEdge).
+    std::vector< Edge >         mySortedEdges;
+    /// For each edge, its faces (one, two, or more if non manifold)
+    Ranges                      myEdgeFaces;
+    /// For each edge, its faces to its right
+    Ranges                      myEdgeRightFaces;
+    /// For each edge, its faces to its left
+    Ranges                      myEdgeLeftFaces;
+
+    // ------------------------- Internals ------------------------------------
+  protected:
+
+    /// Computes all the relations from the incident vertices of
+    /// faces, with the same orders as SurfaceMesh.
+    void computeRelations();
+
+  }; // end of class PackedSurfaceMesh
+
+  /**
+   * Overloads 'operator<<' for displaying objects of class 'PackedSurfaceMesh'.
+   * @param out the output stream where the object is written.
+   * @param object the object of class 'PackedSurfaceMesh' to write.
+   * @return the output stream after the writing.
+   */
+  template < typename TRealPoint, typename TRealVector >
+  std::ostream&
+  operator<< ( std::ostream & out,
+               const PackedSurfaceMesh<TRealPoint, TRealVector> & object );
+
+} // namespace DGtal
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "PackedSurfaceMesh.ih"
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined PackedSurfaceMesh_h
+
+#undef PackedSurfaceMesh_RECURSES
+#endif // else defined(PackedSurfaceMesh_RECURSES)
@@ -46,6 +46,7 @@
 #include "DGtal/base/Common.h"
 #include "DGtal/base/IntegerSequenceIterator.h"
 #include "DGtal/helpers/StdDefs.h"
+#include "DGtal/shapes/SurfaceMeshAlgorithms.h"
 
 namespace DGtal
 {
@@ -127,6 +128,9 @@ namespace DGtal
     
     /// Non mutable iterator for visiting vertices.
     typedef IntegerSequenceIterator< Vertex >       ConstIterator;
+
+    /// The algorithms shared with PackedSurfaceMesh.
+    typedef SurfaceMeshAlgorithms< Self >           Algorithms;
     
     //---------------------------------------------------------------------------
   public:
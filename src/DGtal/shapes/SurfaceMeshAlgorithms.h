@@ -0,0 +1,271 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file SurfaceMeshAlgorithms.h
+ *
+ * @date 2026/10/18
+ *
+ * Header file for module SurfaceMeshAlgorithms.ih
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(SurfaceMeshAlgorithms_RECURSES)
+#error Recursive header files inclusion detected in SurfaceMeshAlgorithms.h
+#else // defined(SurfaceMeshAlgorithms_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define SurfaceMeshAlgorithms_RECURSES
+
+#if !defined SurfaceMeshAlgorithms_h
+/** Prevents repeated inclusion of headers. */
+#define SurfaceMeshAlgorithms_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <vector>
+#include <tuple>
+#include <utility>
+#include "DGtal/base/Common.h"
+#include "DGtal/kernel/NumberTraits.h"
+
+namespace DGtal
+{
+  /////////////////////////////////////////////////////////////////////////////
+  // template class SurfaceMeshAlgorithms
+  /**
+     Description of template class 'SurfaceMeshAlgorithms' <p> \brief
+     Aim: Static class that gathers the algorithms shared by
+     SurfaceMesh and PackedSurfaceMesh, which only differ by the
+     storage of their relations.
+
+     Topological services build the relations from the faces, given
+     as any range of ranges of vertices (e.g. `std::vector<Vertices>`
+     or PackedSurfaceMesh::Ranges). Geometric services only use the
+     public queries of the mesh, whose ranges may be containers or
+     views.
+
+     @tparam TMesh the type of mesh, i.e. SurfaceMesh or PackedSurfaceMesh.
+  */
+  template < typename TMesh >
+  struct SurfaceMeshAlgorithms
+  {
+    typedef TMesh                                Mesh;
+    typedef typename Mesh::RealPoint             RealPoint;
+    typedef typename Mesh::RealVector            RealVector;
+    typedef typename Mesh::Scalar                Scalar;
+    typedef typename Mesh::Scalars               Scalars;
+    typedef typename Mesh::Size                  Size;
+    typedef typename Mesh::Index                 Index;
+    typedef typename Mesh::Face                  Face;
+    typedef typename Mesh::Edge                  Edge;
+    typedef typename Mesh::Vertex                Vertex;
+    typedef typename Mesh::Vertices              Vertices;
+    typedef typename Mesh::Edges                 Edges;
+    typedef typename Mesh::Faces                 Faces;
+    typedef typename Mesh::WeightedEdges         WeightedEdges;
+    typedef typename Mesh::WeightedFaces         WeightedFaces;
+    typedef typename Mesh::VertexPair            VertexPair;
+
+    //---------------------------------------------------------------------------
+  public:
+    /// @name Topological services
+    /// @{
+
+    /// Stitches the sides of faces into edges. Each side (i,j) of a
+    /// face belongs to the edge (min(i,j),max(i,j)), and is a left
+    /// side if i < j, a right side otherwise.
+    ///
+    /// @tparam FaceRanges any range of ranges of vertices.
+    /// @tparam EdgeVisitor the type of a function `( const VertexPair&, const Faces&, const Faces& )`.
+    ///
+    /// @param faces the incident vertices of each face.
+    /// @param visit called once per edge, by increasing vertex pair,
+    /// with its right faces and its left faces, both by increasing index.
+    template <typename FaceRanges, typename EdgeVisitor>
+    static void stitchEdges( const FaceRanges& faces, EdgeVisitor visit );
+
+    /// Outputs the neighbor faces of a face, i.e. the other faces
+    /// incident to two of its vertices, by increasing index.
+    ///
+    /// @tparam SortedFaceRanges any range of ranges of sorted vertices.
+    /// @tparam VertexRanges any range of ranges of faces.
+    /// @tparam OutputIterator any output iterator on Face.
+    ///
+    /// @param sorted_vertices the incident vertices of each face, sorted.
+    /// @param incident_faces the incident faces of each vertex.
+    /// @param f any valid face index.
+    /// @param candidates a buffer, that may be reused between calls.
+    /// @param out the output iterator where neighbor faces are written.
+    /// @return the output iterator after the writing.
+    template <typename SortedFaceRanges, typename VertexRanges,
+              typename OutputIterator>
+    static OutputIterator
+    neighborFaces( const SortedFaceRanges& sorted_vertices,
+                   const VertexRanges& incident_faces,
+                   Face f, Faces& candidates, OutputIterator out );
+
+    /// @param mesh any mesh.
+    /// @return the edges with exactly one incident face.
+    static Edges computeManifoldBoundaryEdges( const Mesh& mesh );
+    /// @param mesh any mesh.
+    /// @return the edges with exactly two incident faces.
+    static Edges computeManifoldInnerEdges( const Mesh& mesh );
+    /// @param mesh any mesh.
+    /// @return the edges with exactly one face to its right and one to its left.
+    static Edges computeManifoldInnerConsistentEdges( const Mesh& mesh );
+    /// @param mesh any mesh.
+    /// @return the edges with two faces to its right or two to its left.
+    static Edges computeManifoldInnerUnconsistentEdges( const Mesh& mesh );
+    /// @param mesh any mesh.
+    /// @return the edges with three or more incident faces.
+    static Edges computeNonManifoldEdges( const Mesh& mesh );
+
+    /// @param mesh any mesh.
+    /// @param e any edge.
+    /// @return 'true' iff edge \a e is (topologically) flippable (see SurfaceMesh::isFlippable).
+    static bool isFlippable( const Mesh& mesh, const Edge e );
+    /// @pre `isFlippable( mesh, e )` must be true.
+    /// @param mesh any mesh.
+    /// @param e any edge.
+    /// @return the two other vertices of the quadrilateral around the edge \a e.
+    static VertexPair otherDiagonal( const Mesh& mesh, const Edge e );
+
+    /// @}
+
+    //---------------------------------------------------------------------------
+  public:
+    /// @name Geometric services
+    /// @{
+
+    /// @param mesh any mesh.
+    /// @param f any valid face index.
+    /// @return the unit normal of face \a f computed from the
+    /// positions of its vertices, or zero if it is degenerated.
+    static RealVector faceNormalFromPositions( const Mesh& mesh, Face f );
+
+    /// @tparam AnyRing any ring of values (scalars, vectors).
+    /// @tparam ElementRanges any range of ranges of indices.
+    /// @param values the values at the elements (e.g. vertices).
+    /// @param ranges the incident elements (e.g. vertices) of each output element (e.g. face).
+    /// @return the average of \a values over each range.
+    template <typename AnyRing, typename ElementRanges>
+    static std::vector<AnyRing>
+    averageValues( const std::vector<AnyRing>& values,
+                   const ElementRanges& ranges );
+
+    /// @tparam ElementRanges any range of ranges of indices.
+    /// @param vectors the vectors at the elements (e.g. vertices).
+    /// @param ranges the incident elements (e.g. vertices) of each output element (e.g. face).
+    /// @return the normalized sum of \a vectors over each range.
+    template <typename ElementRanges>
+    static std::vector<RealVector>
+    averageUnitVectors( const std::vector<RealVector>& vectors,
+                        const ElementRanges& ranges );
+
+    /// @pre the mesh must have face normals.
+    /// @param mesh any mesh.
+    /// @return the vertex normals, as the sums of the normals of
+    /// their incident faces weighted by Max's weights, normalized.
+    static std::vector<RealVector> vertexNormalsWithMaxWeights( const Mesh& mesh );
+
+    /// @param mesh any mesh.
+    /// @param v any valid vertex index.
+    /// @return the Max's weights for each incident face to \a v, in the same order as `incidentFaces( v )`.
+    static Scalars getMaxWeights( const Mesh& mesh, Index v );
+
+    /// @param mesh any mesh.
+    /// @return the average length of the edges of the mesh.
+    static Scalar averageEdgeLength( const Mesh& mesh );
+    /// @param mesh any mesh.
+    /// @param f any valid face index
+    /// @return the average distance between the centroid of face \a f
+    /// and its vertices.
+    static Scalar localWindow( const Mesh& mesh, Face f );
+    /// @param mesh any mesh.
+    /// @param e any valid edge index.
+    /// @return the centroid (or barycenter) of edge \a e.
+    static RealPoint edgeCentroid( const Mesh& mesh, Index e );
+    /// @param mesh any mesh.
+    /// @param f any valid face index.
+    /// @return the centroid (or barycenter) of face \a f.
+    static RealPoint faceCentroid( const Mesh& mesh, Index f );
+    /// @param mesh any mesh.
+    /// @param f any valid face index.
+    /// @return the area of face \a f.
+    static Scalar faceArea( const Mesh& mesh, Index f );
+
+    /// @param mesh any mesh.
+    /// @param r the radius of the ball.
+    /// @param f the face where the ball is centered.
+    /// @param p the position on the face where the ball is centered.
+    /// @return the faces intersecting the ball, with their ratio of
+    /// inclusion (see SurfaceMesh::computeFacesInclusionsInBall).
+    static WeightedFaces
+    computeFacesInclusionsInBall( const Mesh& mesh,
+                                  Scalar r, Index f, RealPoint p );
+    /// @param mesh any mesh.
+    /// @param r the radius of the ball.
+    /// @param f the face where the ball is centered.
+    /// @param p the position on the face where the ball is centered.
+    /// @return the vertices/edges/faces intersecting the ball, edges
+    /// and faces with their ratio of inclusion (see
+    /// SurfaceMesh::computeCellsInclusionsInBall).
+    static std::tuple< Vertices, WeightedEdges, WeightedFaces >
+    computeCellsInclusionsInBall( const Mesh& mesh,
+                                  Scalar r, Index f, RealPoint p );
+    /// @param mesh any mesh.
+    /// @param p the center of the ball.
+    /// @param r the radius of the ball.
+    /// @param f any index of face.
+    /// @return an approximation of the inclusion ratio of face \a f in the ball.
+    static Scalar faceInclusionRatio( const Mesh& mesh,
+                                      RealPoint p, Scalar r, Index f );
+    /// @param mesh any mesh.
+    /// @param p the center of the ball.
+    /// @param r the radius of the ball.
+    /// @param e any index of edge.
+    /// @return an approximation of the inclusion ratio of edge \a e in the ball.
+    static Scalar edgeInclusionRatio( const Mesh& mesh,
+                                      RealPoint p, Scalar r, Index e );
+    /// @param mesh any mesh.
+    /// @param p the center of the ball.
+    /// @param r the radius of the ball.
+    /// @param v any index of vertex.
+    /// @return the inclusion ratio of vertex \a v in the ball, either 0 or 1.
+    static Scalar vertexInclusionRatio( const Mesh& mesh,
+                                        RealPoint p, Scalar r, Index v );
+
+    /// @}
+
+  }; // end of class SurfaceMeshAlgorithms
+
+} // namespace DGtal
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "SurfaceMeshAlgorithms.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined SurfaceMeshAlgorithms_h
+
+#undef SurfaceMeshAlgorithms_RECURSES
+#endif // else defined(SurfaceMeshAlgorithms_RECURSES)
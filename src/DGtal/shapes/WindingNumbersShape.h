@@ -38,6 +38,8 @@
 
 #include <vector>
 #include <algorithm>
+#include <cmath>
+#include <unordered_map>
 #include <DGtal/base/Common.h>
 #include <DGtal/base/CountedConstPtrOrConstPtr.h>
 #include <DGtal/base/ConstAlias.h>
@@ -68,6 +70,12 @@ namespace DGtal
    function from an oriented point cloud. The implicit function is given by the
    generalized winding number  of the oriented point cloud  @cite barill2018fast .
    We use the libIGL implementation.
+
+   For the digitization of the shape on a grid, digitize() classifies
+   the cells of an octree of the domain: cells far from the samples
+   are filled from the winding number at their center, and only
+   cells close to the samples are refined. Its cost thus grows with
+   the area of the surface rather than with the volume of the domain.
    
    @see testWindingNumberShape,  windingNumberShape
    
@@ -118,6 +126,7 @@ namespace DGtal
         {
           trace.warning()<<"[WindingNumberShape] Too few points to use CGAL point_areas. Using the constant area setting."<<std::endl;
         }
+      updateExpansions();
     }
     
     /// Construct a WindingNumberShape Euclidean shape from an oriented point cloud.
@@ -134,6 +143,7 @@ namespace DGtal
       myNormals = normals;
       myPointAreas = areas;
       igl::octree(*myPoints,myO_PI,myO_CH,myO_CN,myO_W);
+      updateExpansions();
     }
     
     
@@ -142,6 +152,26 @@ namespace DGtal
     void setPointAreas(ConstAlias<Eigen::VectorXd> areas)
     {
       myPointAreas = areas;
+      updateExpansions();
+    }
+
+    /// Precomputes the far field expansions of the octree cells,
+    /// which are used by all queries. Must be called if the points,
+    /// normals or areas are changed.
+    void updateExpansions()
+    {
+      igl::fast_winding_number(*myPoints,*myNormals,myPointAreas,myO_PI,myO_CH,2,myO_CM,myO_R,myO_EC);
+    }
+
+    /// Generalized winding numbers of a set of points (queries).
+    ///
+    /// @param queries [in] a "nx3" matrix with the query points in space.
+    /// @return the "n" vector of winding numbers.
+    Eigen::VectorXd windingNumbers(const Eigen::MatrixXd & queries) const
+    {
+      Eigen::VectorXd W;
+      igl::fast_winding_number(*myPoints,*myNormals,myPointAreas,myO_PI,myO_CH,myO_CM,myO_R,myO_EC,queries,2,W);
+      return W;
     }
     
     /// Orientation of a point using the winding number value from
@@ -170,15 +200,8 @@ namespace DGtal
     std::vector<Orientation> orientationBatch(const Eigen::MatrixXd & queries,
                                               const double threshold = 0.3) const
     {
-      Eigen::VectorXd W;
       std::vector<Orientation> results( queries.rows(), DGtal::OUTSIDE );
-      Eigen::MatrixXd O_CM;
-      Eigen::VectorXd O_R;
-      Eigen::MatrixXd O_EC;
-    
-      //Checking if the areas
-      igl::fast_winding_number(*myPoints,*myNormals,myPointAreas,myO_PI,myO_CH,2,O_CM,O_R,O_EC);
-      igl::fast_winding_number(*myPoints,*myNormals,myPointAreas,myO_PI,myO_CH,O_CM,O_R,O_EC,queries,2,W);
+      const Eigen::VectorXd W = windingNumbers(queries);
       
       //Reformating the output
       for(auto i=0u; i < queries.rows(); ++i)
@@ -193,6 +216,166 @@ namespace DGtal
       }
       return results;
     }
+
+    /// Digitizes the shape in a binary image: the voxel @a v is set
+    /// to 'true' iff the point @a h*v is INSIDE the shape (as given by
+    /// orientation()), 'false' otherwise.
+    ///
+    /// The domain of the image is hierarchically decomposed into
+    /// cubic cells. A cell is filled from the winding number at its
+    /// center if no sample is at distance lower than @a margin of its
+    /// voxel centers, otherwise it is split into eight cells. Cells of
+    /// each level are classified in parallel and evaluated with a
+    /// single batch query.
+    ///
+    /// @note The result is the same as with pointwise queries as long
+    /// as the winding number does not cross the threshold farther than
+    /// @a margin from the samples, which holds for a dense sampling of
+    /// a closed surface.
+    ///
+    /// @tparam TImage the type of image, whose values are set from
+    /// 'bool' values (e.g. ImageContainerBySTLVector< Domain, bool >).
+    /// @param image [inout] the image to fill on its whole domain.
+    /// @param h [in] the gridstep, i.e. the size of voxels.
+    /// @param threshold [in] the iso-value of the surface of the winding number implicit map (default = 0.3).
+    /// @param margin [in] the distance to the samples under which
+    /// cells are refined, or 0.0 to use twice the square root of the
+    /// largest point area (default = 0.0).
+    template <typename TImage>
+    void digitize(TImage & image,
+                  const double h = 1.0,
+                  const double threshold = 0.3,
+                  double margin = 0.0) const
+    {
+      using Point     = typename TImage::Domain::Point;
+      using Integer   = typename Point::Component;
+      using Bucket    = typename Space::Point;
+      using BucketMap = std::unordered_map<Bucket, std::vector<Eigen::Index> >;
+
+      const Point lo = image.domain().lowerBound();
+      const Point hi = image.domain().upperBound();
+      if (margin <= 0.0)
+        margin = 2.0 * std::sqrt(myPointAreas.maxCoeff());
+      if (margin <= 0.0)
+        margin = h;
+
+      // Samples are sorted in buckets of size margin.
+      auto bucket = [margin] (double x, double y, double z)
+      {
+        return Bucket( (typename Bucket::Component) std::floor(x / margin),
+                       (typename Bucket::Component) std::floor(y / margin),
+                       (typename Bucket::Component) std::floor(z / margin) );
+      };
+      BucketMap buckets;
+      for (Eigen::Index i = 0; i < myPoints->rows(); ++i)
+        buckets[ bucket((*myPoints)(i,0), (*myPoints)(i,1), (*myPoints)(i,2)) ].push_back(i);
+
+      // Tells if some sample is at distance lower than margin of the
+      // box [a,b] (in space coordinates).
+      auto isNearSamples = [&] (const RealPoint& a, const RealPoint& b)
+      {
+        auto isNear = [&] (const std::vector<Eigen::Index>& samples)
+        {
+          for (auto i : samples)
+          {
+            double d2 = 0.0;
+            for (auto k = 0; k < 3; ++k)
+            {
+              const double x = (*myPoints)(i,k);
+              const double d = x < a[k] ? a[k] - x : ( x > b[k] ? x - b[k] : 0.0 );
+              d2 += d * d;
+            }
+            if (d2 <= margin * margin) return true;
+          }
+          return false;
+        };
+        const Bucket bl = bucket(a[0] - margin, a[1] - margin, a[2] - margin);
+        const Bucket bu = bucket(b[0] + margin, b[1] + margin, b[2] + margin);
+        double nb = 1.0;
+        for (auto k = 0; k < 3; ++k)
+          nb *= double(bu[k] - bl[k] + 1);
+        if (nb > double(buckets.size()))
+        {
+          for (const auto& bs : buckets)
+            if (bl.isLower(bs.first) && bs.first.isLower(bu) && isNear(bs.second)) return true;
+          return false;
+        }
+        Bucket c;
+        for (c[2] = bl[2]; c[2] <= bu[2]; ++c[2])
+          for (c[1] = bl[1]; c[1] <= bu[1]; ++c[1])
+            for (c[0] = bl[0]; c[0] <= bu[0]; ++c[0])
+            {
+              const auto it = buckets.find(c);
+              if (it != buckets.end() && isNear(it->second)) return true;
+            }
+        return false;
+      };
+
+      // Octree traversal, level by level, from a cell covering the domain.
+      struct Cell { Point first; Point last; };
+      Integer size = 1;
+      const Point extent = hi - lo;
+      while (size <= *std::max_element(extent.begin(), extent.end()))
+        size *= 2;
+      std::vector<Cell> cells = { Cell{ lo, hi } };
+      while (! cells.empty())
+      {
+        // Cells of size 1 are always evaluated.
+        std::vector<char> refine(cells.size(), 0);
+        if (size > 1)
+        {
+#ifdef WITH_OPENMP
+#pragma omp parallel for schedule(dynamic)
+#endif
+          for (long i = 0; i < (long) cells.size(); ++i)
+            refine[i] = isNearSamples(h * RealPoint(cells[i].first),
+                                      h * RealPoint(cells[i].last)) ? 1 : 0;
+        }
+        // Evaluates the other cells at their center, with one query.
+        std::vector<std::size_t> evaluated;
+        for (std::size_t i = 0; i < cells.size(); ++i)
+          if (! refine[i]) evaluated.push_back(i);
+        Eigen::MatrixXd queries(evaluated.size(), 3);
+        for (std::size_t j = 0; j < evaluated.size(); ++j)
+        {
+          const Cell& cell = cells[evaluated[j]];
+          for (auto k = 0; k < 3; ++k)
+            queries(j,k) = 0.5 * h * double(cell.first[k] + cell.last[k]);
+        }
+        const Eigen::VectorXd W = windingNumbers(queries);
+        for (std::size_t j = 0; j < evaluated.size(); ++j)
+        {
+          const Cell& cell = cells[evaluated[j]];
+          const bool inside = std::abs(W(j)) > threshold;
+          Point p = cell.first;
+          for (p[2] = cell.first[2]; p[2] <= cell.last[2]; ++p[2])
+            for (p[1] = cell.first[1]; p[1] <= cell.last[1]; ++p[1])
+              for (p[0] = cell.first[0]; p[0] <= cell.last[0]; ++p[0])
+                image.setValue(p, inside);
+        }
+        // Splits the cells close to the samples.
+        std::vector<Cell> children;
+        size /= 2;
+        for (std::size_t i = 0; i < cells.size(); ++i)
+        {
+          if (! refine[i]) continue;
+          const Cell& cell = cells[i];
+          for (int c = 0; c < 8; ++c)
+          {
+            Cell child;
+            bool empty = false;
+            for (auto k = 0; k < 3; ++k)
+            {
+              child.first[k] = cell.first[k] + ( ( c >> k ) & 1 ) * size;
+              child.last[k]  = std::min(child.first[k] + size - 1, cell.last[k]);
+              empty = empty || child.first[k] > cell.last[k];
+            }
+            if (! empty) children.push_back(child);
+          }
+        }
+        cells.swap(children);
+      }
+    }
     
     ///Const alias to the points
     CountedConstPtrOrConstPtr<Eigen::MatrixXd> myPoints;
@@ -209,6 +392,12 @@ namespace DGtal
     Eigen::MatrixXd myO_CN;
     ///libIGL octree for fast queries data structure
     Eigen::VectorXd myO_W;
+    ///libIGL far field expansions of the octree cells (centers)
+    Eigen::MatrixXd myO_CM;
+    ///libIGL far field expansions of the octree cells (radii)
+    Eigen::VectorXd myO_R;
+    ///libIGL far field expansions of the octree cells (coefficients)
+    Eigen::MatrixXd myO_EC;
     
     
   };
@@ -110,6 +110,40 @@ namespace DGtal
           return ON;
     }
 
+    /**
+     * Orientation of a whole box, from the nearest and farthest
+     * points of the box to the center.
+     *
+     * @param lowerBound the lowest point of the box.
+     * @param upperBound the highest point of the box.
+     *
+     * @return INSIDE (resp. OUTSIDE) if the orientation of every point
+     * of the box is INSIDE (resp. OUTSIDE), ON otherwise.
+     */
+    inline
+    Orientation orientation(const RealPoint &lowerBound,
+                            const RealPoint &upperBound) const
+    {
+      double dmin2 = 0.0, dmax2 = 0.0;
+      for ( typename RealPoint::Dimension k = 0; k < RealPoint::dimension; ++k )
+        {
+          const double a = lowerBound[ k ] - myCenter[ k ];
+          const double b = upperBound[ k ] - myCenter[ k ];
+          const double n = ( a > 0.0 ) ? a : ( ( b < 0.0 ) ? -b : 0.0 );
+          const double f = std::max( std::abs( a ), std::abs( b ) );
+          dmin2 += n * n;
+          dmax2 += f * f;
+        }
+      // Margin for the rounding errors of operator().
+      const double margin = 1e-12 * ( myRadius + std::sqrt( dmax2 ) );
+      if ( myRadius - std::sqrt( dmax2 ) > margin )
+        return INSIDE;
+      else if ( myRadius - std::sqrt( dmin2 ) < -margin )
+        return OUTSIDE;
+      else
+        return ON;
+    }
+
     inline
     RealPoint getLowerBound() const
     {
@@ -46,6 +46,7 @@
 #include "DGtal/base/CPredicate.h"
 #include "DGtal/kernel/NumberTraits.h"
 #include "DGtal/math/MPolynomial.h"
+#include "DGtal/math/CompiledMPolynomial.h"
 #include "DGtal/shapes/implicit/CImplicitFunction.h"
 //////////////////////////////////////////////////////////////////////////////
 
@@ -60,6 +61,11 @@ namespace DGtal
    *
    * Model of CImplicitFunction
    *
+   * The polynomial and its first order partial derivatives are
+   * compiled (see CompiledMPolynomial), so that the value and the
+   * gradient are quickly evaluated. Whole rows of points can also be
+   * evaluated at once with evaluateRow.
+   *
    * @tparam TSpace the Digital space definition.
    */
 
@@ -75,6 +81,7 @@ namespace DGtal
     typedef typename RealPoint::Coordinate Ring;
     typedef typename Space::Integer Integer;
     typedef MPolynomial< 3, Ring > Polynomial3;
+    typedef CompiledMPolynomial< 3, Ring > CompiledPolynomial3;
     typedef Ring Value;
 
     BOOST_STATIC_ASSERT(( Space::dimension == 3 ));
@@ -116,6 +123,19 @@ namespace DGtal
     */
     double operator()(const RealPoint &aPoint) const;
 
+    /**
+       Evaluates the polynomial at the points (x[i], aPoint[1],
+       aPoint[2]) for i in [0,nb), which is much faster than separate
+       evaluations.
+
+       @param[in] aPoint any point in the Euclidean space, giving the y and z coordinates.
+       @param[in] x the x coordinates of the points (an array of size \a nb).
+       @param[in] nb the number of points.
+       @param[out] values the values of the polynomial at these points (an array of size \a nb).
+    */
+    void evaluateRow( const RealPoint &aPoint, const Ring* x,
+                      std::size_t nb, Ring* values ) const;
+
     /**
        @param aPoint any point in the Euclidean space.
        @return 'true' if the polynomial value is < 0.
@@ -130,6 +150,36 @@ namespace DGtal
     */
     Orientation orientation(const RealPoint &aPoint) const;
 
+    /**
+       Orientation of a whole box, computed by bounding the polynomial
+       over the box with interval arithmetic (see
+       CompiledMPolynomial::evaluateInterval), and with its mean value
+       form (its value at the center of the box plus bounds of its
+       gradient). Used by HierarchicalGaussDigitizer.
+
+       @param lowerBound the lowest point of the box.
+       @param upperBound the highest point of the box.
+
+       @return INSIDE (resp. OUTSIDE) if the orientation of every point
+       of the box is INSIDE (resp. OUTSIDE), ON when it is unknown
+       (e.g. the box may intersect the zero level set).
+    */
+    Orientation orientation(const RealPoint &lowerBound,
+                            const RealPoint &upperBound) const;
+
+    /**
+       Orientations of the points (x[i], aPoint[1], aPoint[2]) for i
+       in [0,nb), computed with evaluateRow. Used by
+       HierarchicalGaussDigitizer.
+
+       @param[in] aPoint any point in the Euclidean space, giving the y and z coordinates.
+       @param[in] x the x coordinates of the points (an array of size \a nb).
+       @param[in] nb the number of points.
+       @param[out] orientations the orientations of these points (an array of size \a nb).
+    */
+    void orientationRow( const RealPoint &aPoint, const Ring* x,
+                         std::size_t nb, Orientation* orientations ) const;
+
     /**
        @param aPoint any point in the Euclidean space.
        @return the gradient vector of the polynomial at \a aPoint.
@@ -262,6 +312,13 @@ namespace DGtal
     Polynomial3 myUpPolynome;
     Polynomial3 myLowPolynome;
 
+    /// The compiled polynomial and first order partial derivatives,
+    /// used for fast evaluations.
+    CompiledPolynomial3 myCompiledPolynomial;
+    CompiledPolynomial3 myCompiledFx;
+    CompiledPolynomial3 myCompiledFy;
+    CompiledPolynomial3 myCompiledFz;
+
 
     // ------------------------- Hidden services ------------------------------
   protected:
@@ -311,6 +311,136 @@ test_derivative(int domain_size)
     }
 }
 
+template <typename CalculusA, typename CalculusB, typename Container>
+bool
+equal_operators(const CalculusA& calculus_a, const Container& aa, const CalculusB& calculus_b, const Container& bb,
+    const DGtal::Order order_in, const DGtal::Duality duality_in, const DGtal::Order order_out, const DGtal::Duality duality_out)
+{
+    typedef typename Container::Index Index;
+    if (aa.rows() != calculus_a.kFormLength(order_out, duality_out)) return false;
+    if (aa.cols() != calculus_a.kFormLength(order_in, duality_in)) return false;
+
+    // indexes of the cells of calculus_a in calculus_b
+    std::vector<Index> rows, cols;
+    for (Index ii=0; ii<aa.rows(); ii++)
+        rows.push_back(calculus_b.getCellIndex(calculus_b.myKSpace.unsigns(calculus_a.getSCell(order_out, duality_out, ii))));
+    for (Index jj=0; jj<aa.cols(); jj++)
+        cols.push_back(calculus_b.getCellIndex(calculus_b.myKSpace.unsigns(calculus_a.getSCell(order_in, duality_in, jj))));
+
+    for (Index ii=0; ii<aa.rows(); ii++)
+        for (Index jj=0; jj<aa.cols(); jj++)
+            if (std::abs(aa.coeff(ii,jj) - bb.coeff(rows[ii],cols[jj])) > 1e-10)
+                return false;
+    return true;
+}
+
+template <DGtal::Dimension dimEmbedded, typename LinearAlgebraBackend, typename KSpace>
+void
+test_dense_calculus(const KSpace& kspace, const std::vector<typename KSpace::SCell>& ncells,
+    const typename KSpace::SCell& isolated_ncell, const bool add_border)
+{
+    typedef typename KSpace::SCell SCell;
+    DGtal::trace.info() << "dimension=" << dimEmbedded << "/" << KSpace::dimension << std::endl;
+    DGtal::trace.info() << "add_border=" << add_border << std::endl;
+    DGtal::trace.info() << "ncells.size()=" << ncells.size() << std::endl;
+
+    typedef DGtal::DiscreteExteriorCalculusFactory<LinearAlgebraBackend> CalculusFactory;
+    typedef DGtal::DiscreteExteriorCalculus<dimEmbedded, KSpace::dimension, LinearAlgebraBackend> Calculus;
+
+    // dense n-cells use dense arrays, an isolated n-cell far away forces the generic algorithm
+    const Calculus dense_calculus = CalculusFactory::template createFromNSCells<dimEmbedded>(ncells.begin(), ncells.end(), add_border);
+    std::vector<SCell> sparse_ncells = ncells;
+    sparse_ncells.push_back(isolated_ncell);
+    const Calculus sparse_calculus = CalculusFactory::template createFromNSCells<dimEmbedded>(sparse_ncells.begin(), sparse_ncells.end(), add_border);
+
+    DGtal::trace.beginBlock("testing dense structure properties");
+    bool test_result = true;
+    const typename Calculus::Properties& dense_properties = dense_calculus.getProperties();
+    const typename Calculus::Properties& sparse_properties = sparse_calculus.getProperties();
+    DGtal::trace.info() << "properties.size()=" << dense_properties.size() << std::endl;
+    for (typename Calculus::ConstIterator iter=dense_calculus.begin(), iter_end=dense_calculus.end(); iter!=iter_end; iter++)
+    {
+        const typename Calculus::Properties::const_iterator sparse_iter = sparse_properties.find(iter->first);
+        test_result &= (sparse_iter != sparse_properties.end());
+        if (sparse_iter == sparse_properties.end()) continue;
+        test_result &= (iter->second.primal_size == sparse_iter->second.primal_size);
+        test_result &= (iter->second.dual_size == sparse_iter->second.dual_size);
+        test_result &= (iter->second.flipped == sparse_iter->second.flipped);
+        test_result &= (iter->second.index == dense_calculus.getCellIndex(iter->first));
+        test_result &= dense_calculus.containsCell(iter->first);
+        test_result &= (dense_calculus.isCellFlipped(iter->first) == sparse_calculus.isCellFlipped(iter->first));
+    }
+    // the isolated n-cell comes with its faces when border is added
+    test_result &= (dense_properties.size() + (add_border ? std::pow(3, dimEmbedded) : 1) == sparse_properties.size());
+    test_result &= !dense_calculus.containsCell(kspace.unsigns(isolated_ncell));
+    DGtal::trace.endBlock();
+    FATAL_ERROR(test_result);
+
+    DGtal::trace.beginBlock("testing dense structure operators");
+    test_result &= equal_operators(dense_calculus, dense_calculus.template laplace<DGtal::PRIMAL>().myContainer,
+        sparse_calculus, sparse_calculus.template laplace<DGtal::PRIMAL>().myContainer, 0, DGtal::PRIMAL, 0, DGtal::PRIMAL);
+    test_result &= equal_operators(dense_calculus, dense_calculus.template laplace<DGtal::DUAL>().myContainer,
+        sparse_calculus, sparse_calculus.template laplace<DGtal::DUAL>().myContainer, 0, DGtal::DUAL, 0, DGtal::DUAL);
+    test_result &= equal_operators(dense_calculus, dense_calculus.template derivative<0, DGtal::PRIMAL>().myContainer,
+        sparse_calculus, sparse_calculus.template derivative<0, DGtal::PRIMAL>().myContainer, 0, DGtal::PRIMAL, 1, DGtal::PRIMAL);
+    test_result &= equal_operators(dense_calculus, dense_calculus.template hodge<1, DGtal::PRIMAL>().myContainer,
+        sparse_calculus, sparse_calculus.template hodge<1, DGtal::PRIMAL>().myContainer, 1, DGtal::PRIMAL, Calculus::dimensionEmbedded-1, DGtal::DUAL);
+    for (DGtal::Dimension dir=0; dir<Calculus::dimensionAmbient; dir++)
+    {
+        test_result &= equal_operators(dense_calculus, dense_calculus.template sharpDirectional<DGtal::PRIMAL>(dir).myContainer,
+            sparse_calculus, sparse_calculus.template sharpDirectional<DGtal::PRIMAL>(dir).myContainer, 1, DGtal::PRIMAL, 0, DGtal::PRIMAL);
+        test_result &= equal_operators(dense_calculus, dense_calculus.template flatDirectional<DGtal::DUAL>(dir).myContainer,
+            sparse_calculus, sparse_calculus.template flatDirectional<DGtal::DUAL>(dir).myContainer, 0, DGtal::DUAL, 1, DGtal::DUAL);
+    }
+    DGtal::trace.endBlock();
+    FATAL_ERROR(test_result);
+}
+
+template <typename DigitalSet, typename LinearAlgebraBackend>
+void
+test_dense_structure(int domain_size, const bool add_border)
+{
+    typedef typename DigitalSet::Domain Domain;
+    typedef typename DigitalSet::Point Point;
+    typedef DGtal::KhalimskySpaceND<Domain::Space::dimension, DGtal::int32_t> KSpace;
+    typedef typename KSpace::SCell SCell;
+    Domain domain(Point(), Point::diagonal(domain_size-1));
+
+    // random spels filling most of the domain
+    KSpace kspace;
+    kspace.init(Point::diagonal(-1000), Point::diagonal(1000), true);
+    std::vector<SCell> spels;
+    for (typename Domain::ConstIterator di=domain.begin(), die=domain.end(); di!=die; di++)
+    {
+        if (std::rand()%3==0) continue;
+        spels.push_back(kspace.sSpel(*di));
+    }
+
+    test_dense_calculus<Domain::Space::dimension, LinearAlgebraBackend>(kspace, spels, kspace.sSpel(Point::diagonal(500)), add_border);
+}
+
+template <typename LinearAlgebraBackend>
+void
+test_dense_embedded_structure(int domain_size, const bool add_border)
+{
+    typedef DGtal::Z3i::Point Point;
+    typedef DGtal::KhalimskySpaceND<3, DGtal::int32_t> KSpace;
+    typedef KSpace::SCell SCell;
+
+    // random surfels filling most of a plane patch, with random orientations
+    KSpace kspace;
+    kspace.init(Point::diagonal(-1000), Point::diagonal(1000), true);
+    std::vector<SCell> surfels;
+    for (int y=0; y<domain_size; y++)
+        for (int x=0; x<domain_size; x++)
+        {
+            if (std::rand()%8==0) continue;
+            surfels.push_back(kspace.sCell(Point(2*x+1, 2*y+1, 0), std::rand()%2 ? KSpace::POS : KSpace::NEG));
+        }
+
+    test_dense_calculus<2, LinearAlgebraBackend>(kspace, surfels, kspace.sCell(Point(1001, 1001, 1000)), add_border);
+}
+
 template <typename LinearAlgebraBackend>
 void
 test_concepts()
@@ -549,6 +679,15 @@ test_backend(const int& ntime, const int& maxdim)
         DGtal::trace.endBlock();
     }
 
+    DGtal::trace.beginBlock("testing dense structures");
+    if (maxdim>=2) test_dense_structure<DGtal::Z2i::DigitalSet, LinearAlgebraBackend>(8, true);
+    if (maxdim>=2) test_dense_structure<DGtal::Z2i::DigitalSet, LinearAlgebraBackend>(8, false);
+    if (maxdim>=3) test_dense_structure<DGtal::Z3i::DigitalSet, LinearAlgebraBackend>(5, true);
+    if (maxdim>=3) test_dense_structure<DGtal::Z3i::DigitalSet, LinearAlgebraBackend>(5, false);
+    if (maxdim>=3) test_dense_embedded_structure<LinearAlgebraBackend>(16, true);
+    if (maxdim>=3) test_dense_embedded_structure<LinearAlgebraBackend>(16, false);
+    DGtal::trace.endBlock();
+
     test_concepts<LinearAlgebraBackend>();
 }
 
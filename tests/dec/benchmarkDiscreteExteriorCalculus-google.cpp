@@ -0,0 +1,129 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file benchmarkDiscreteExteriorCalculus-google.cpp
+ * @ingroup Tests
+ *
+ * @date 2026/10/18
+ *
+ * This file is part of the DGtal library
+ */
+
+/**
+ * Description of benchmarkDiscreteExteriorCalculus-google <p>
+ * Aim: cost of building a DiscreteExteriorCalculus with
+ * DiscreteExteriorCalculusFactory::createFromNSCells from all the
+ * pixels of a n x n image or all the voxels of a n x n x n image,
+ * and of building its usual operators. The argument is n.
+ */
+
+#include <iostream>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include "DGtal/base/Common.h"
+#include "DGtal/helpers/StdDefs.h"
+#include "DGtal/math/linalg/EigenSupport.h"
+#include "DGtal/dec/DiscreteExteriorCalculus.h"
+#include "DGtal/dec/DiscreteExteriorCalculusFactory.h"
+
+using namespace DGtal;
+using namespace std;
+
+typedef DiscreteExteriorCalculusFactory< EigenLinearAlgebraBackend > CalculusFactory;
+
+/// @return the n-cells of all the spels of a n^dim domain.
+template < typename KSpace >
+std::vector< typename KSpace::SCell > makeSpels( int n )
+{
+  typedef typename KSpace::Point Point;
+  typedef HyperRectDomain< typename KSpace::Space > Domain;
+  KSpace K;
+  K.init( Point::diagonal( 0 ), Point::diagonal( n - 1 ), true );
+  std::vector< typename KSpace::SCell > spels;
+  for ( auto p : Domain( Point::diagonal( 0 ), Point::diagonal( n - 1 ) ) )
+    spels.push_back( K.sSpel( p ) );
+  return spels;
+}
+
+static void BM_CreateFromNSCells2D( benchmark::State& state )
+{
+  const auto spels = makeSpels< Z2i::KSpace >( int( state.range( 0 ) ) );
+  for ( auto _ : state )
+    {
+      const auto calculus = CalculusFactory::createFromNSCells< 2 >( spels.cbegin(), spels.cend() );
+      benchmark::DoNotOptimize( calculus.kFormLength( 0, PRIMAL ) );
+    }
+  state.SetItemsProcessed( spels.size() * state.iterations() );
+}
+
+static void BM_CreateFromNSCells3D( benchmark::State& state )
+{
+  const auto spels = makeSpels< Z3i::KSpace >( int( state.range( 0 ) ) );
+  for ( auto _ : state )
+    {
+      const auto calculus = CalculusFactory::createFromNSCells< 3 >( spels.cbegin(), spels.cend() );
+      benchmark::DoNotOptimize( calculus.kFormLength( 0, PRIMAL ) );
+    }
+  state.SetItemsProcessed( spels.size() * state.iterations() );
+}
+
+static void BM_Operators2D( benchmark::State& state )
+{
+  const auto spels = makeSpels< Z2i::KSpace >( int( state.range( 0 ) ) );
+  const auto calculus = CalculusFactory::createFromNSCells< 2 >( spels.cbegin(), spels.cend() );
+  for ( auto _ : state )
+    {
+      const auto laplace = calculus.laplace< PRIMAL >();
+      const auto dual_laplace = calculus.laplace< DUAL >();
+      const auto d1 = calculus.derivative< 1, PRIMAL >();
+      const auto h2 = calculus.hodge< 2, PRIMAL >();
+      benchmark::DoNotOptimize( laplace.myContainer.nonZeros() + dual_laplace.myContainer.nonZeros()
+                                + d1.myContainer.nonZeros() + h2.myContainer.nonZeros() );
+    }
+  state.SetItemsProcessed( spels.size() * state.iterations() );
+}
+
+static void BM_SharpFlat2D( benchmark::State& state )
+{
+  const auto spels = makeSpels< Z2i::KSpace >( int( state.range( 0 ) ) );
+  for ( auto _ : state )
+    {
+      state.PauseTiming();
+      auto calculus = CalculusFactory::createFromNSCells< 2 >( spels.cbegin(), spels.cend() );
+      state.ResumeTiming();
+      // the first call builds the cached sharp and flat operators.
+      benchmark::DoNotOptimize( calculus.sharpDirectional< PRIMAL >( 0 ).myContainer.nonZeros() );
+    }
+  state.SetItemsProcessed( spels.size() * state.iterations() );
+}
+
+BENCHMARK( BM_CreateFromNSCells2D )->Arg( 128 )->Arg( 512 )->Unit( benchmark::kMillisecond );
+BENCHMARK( BM_CreateFromNSCells3D )->Arg( 32 )->Arg( 128 )->Unit( benchmark::kMillisecond );
+BENCHMARK( BM_Operators2D )->Arg( 128 )->Arg( 512 )->Unit( benchmark::kMillisecond );
+BENCHMARK( BM_SharpFlat2D )->Arg( 128 )->Arg( 512 )->Unit( benchmark::kMillisecond );
+
+int main(int argc, char* argv[])
+{
+  benchmark::Initialize(&argc, argv);
+  benchmark::RunSpecifiedBenchmarks();
+
+  return 0;
+}
+
+/** @ingroup Tests **/
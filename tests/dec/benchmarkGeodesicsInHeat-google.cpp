@@ -0,0 +1,120 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file benchmarkGeodesicsInHeat-google.cpp
+ * @ingroup Tests
+ *
+ * @date 2026/10/18
+ *
+ * This file is part of the DGtal library
+ */
+
+/**
+ * Description of benchmarkGeodesicsInHeat-google <p>
+ * Aim: cost of the geodesic distances from many landmarks with
+ * GeodesicsInHeat on a bumpy 200x200 grid of quads, one landmark
+ * after the other or all of them at once. The argument is the number
+ * of landmarks.
+ */
+
+#include <iostream>
+#include <vector>
+#include <cmath>
+
+#include <benchmark/benchmark.h>
+
+#include "DGtal/base/Common.h"
+#include "DGtal/helpers/StdDefs.h"
+#include "DGtal/shapes/SurfaceMesh.h"
+#include "DGtal/dec/PolygonalCalculus.h"
+#include "DGtal/dec/GeodesicsInHeat.h"
+
+using namespace DGtal;
+using namespace std;
+
+typedef Z3i::RealPoint                               RealPoint;
+typedef SurfaceMesh< RealPoint, RealPoint >          Mesh;
+typedef PolygonalCalculus< RealPoint, RealPoint >    Calculus;
+typedef GeodesicsInHeat< Calculus >                  Heat;
+
+/// @return a n x n grid of quads, with a bumpy height.
+Mesh makeGrid( int n )
+{
+  std::vector< RealPoint > positions;
+  std::vector< Mesh::Vertices > faces;
+  for ( int j = 0; j <= n; ++j )
+    for ( int i = 0; i <= n; ++i )
+      positions.push_back( RealPoint( i, j, std::sin( 0.3 * i ) * std::cos( 0.2 * j ) ) );
+  for ( int j = 0; j < n; ++j )
+    for ( int i = 0; i < n; ++i )
+      {
+        const Mesh::Vertex v = j * ( n + 1 ) + i;
+        faces.push_back( { v, v + 1, v + n + 2, v + n + 1 } );
+      }
+  return Mesh( positions.cbegin(), positions.cend(), faces.cbegin(), faces.cend() );
+}
+
+/// @return nb landmarks spread over the vertices of the mesh.
+std::vector< std::vector< Heat::Vertex > > landmarks( const Mesh& mesh, int nb )
+{
+  std::vector< std::vector< Heat::Vertex > > sources;
+  for ( int i = 0; i < nb; ++i )
+    sources.push_back( { ( i * 7919 ) % mesh.nbVertices() } );
+  return sources;
+}
+
+static void BM_GeodesicsOneByOne( benchmark::State& state )
+{
+  const Mesh mesh = makeGrid( 200 );
+  Calculus calculus( mesh );
+  Heat heat( calculus );
+  heat.init( 1.0 );
+  const auto sources = landmarks( mesh, int( state.range( 0 ) ) );
+  for ( auto _ : state )
+    for ( const auto& s : sources )
+      {
+        heat.clearSource();
+        heat.addSource( s[ 0 ] );
+        benchmark::DoNotOptimize( heat.compute() );
+      }
+  state.SetItemsProcessed( sources.size() * state.iterations() );
+}
+
+static void BM_GeodesicsBatched( benchmark::State& state )
+{
+  const Mesh mesh = makeGrid( 200 );
+  Calculus calculus( mesh );
+  Heat heat( calculus );
+  heat.init( 1.0 );
+  const auto sources = landmarks( mesh, int( state.range( 0 ) ) );
+  for ( auto _ : state )
+    benchmark::DoNotOptimize( heat.compute( sources ) );
+  state.SetItemsProcessed( sources.size() * state.iterations() );
+}
+
+BENCHMARK( BM_GeodesicsOneByOne )->Arg( 16 )->Arg( 128 )->Unit( benchmark::kMillisecond );
+BENCHMARK( BM_GeodesicsBatched )->Arg( 16 )->Arg( 128 )->Unit( benchmark::kMillisecond );
+
+int main(int argc, char* argv[])
+{
+  benchmark::Initialize(&argc, argv);
+  benchmark::RunSpecifiedBenchmarks();
+
+  return 0;
+}
+
+/** @ingroup Tests **/
@@ -0,0 +1,124 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file benchmarkGeometricMultigridSolver-google.cpp
+ * @ingroup Tests
+ *
+ * @date 2026/10/18
+ *
+ * This file is part of the DGtal library
+ */
+
+/**
+ * Description of benchmarkGeometricMultigridSolver-google <p>
+ * Aim: cost of solving (factorization and solve) a screened
+ * laplacian on the primal 0-forms of a 3D digital ball, with a sparse
+ * direct solver, conjugate gradients (Jacobi or incomplete Cholesky
+ * preconditioners) and GeometricMultigridSolver. The argument is the
+ * radius of the ball.
+ */
+
+#include <iostream>
+#include <vector>
+#include <cmath>
+
+#include <benchmark/benchmark.h>
+
+#include "DGtal/base/Common.h"
+#include "DGtal/helpers/StdDefs.h"
+#include "DGtal/math/linalg/EigenSupport.h"
+#include "DGtal/dec/DiscreteExteriorCalculus.h"
+#include "DGtal/dec/DiscreteExteriorCalculusFactory.h"
+#include "DGtal/dec/DiscreteExteriorCalculusSolver.h"
+#include "DGtal/dec/GeometricMultigridSolver.h"
+
+using namespace DGtal;
+using namespace std;
+
+typedef DiscreteExteriorCalculus< 3, 3, EigenLinearAlgebraBackend > Calculus;
+
+/// @return the calculus of a digital ball of radius R.
+Calculus makeCalculus( int R )
+{
+  typedef Z3i::Point Point;
+  const Z3i::Domain domain( Point::diagonal( -R-1 ), Point::diagonal( R+1 ) );
+  Z3i::DigitalSet set( domain );
+  for ( auto p : domain )
+    if ( p.norm() <= R ) set.insertNew( p );
+  return DiscreteExteriorCalculusFactory< EigenLinearAlgebraBackend >::createFromDigitalSet( set );
+}
+
+/// Tolerance of the iterative solvers.
+template < typename LinearAlgebraSolver >
+void setTolerance( LinearAlgebraSolver& solver ) { solver.setTolerance( 1e-8 ); }
+void setTolerance( EigenLinearAlgebraBackend::SolverSimplicialLDLT& ) {}
+
+template < typename LinearAlgebraSolver >
+void solveLaplace( benchmark::State& state )
+{
+  typedef DiscreteExteriorCalculusSolver< Calculus, LinearAlgebraSolver, 0, PRIMAL, 0, PRIMAL > Solver;
+  const Calculus calculus = makeCalculus( int( state.range( 0 ) ) );
+  const Calculus::PrimalDerivative0 d0 = calculus.derivative< 0, PRIMAL >();
+  const Calculus::PrimalIdentity0 laplace = d0.transpose() * d0
+    + 0.01 * calculus.identity< 0, PRIMAL >();
+  Calculus::PrimalForm0 input( calculus );
+  for ( Calculus::Index i = 0; i < input.length(); i++ )
+    input.myContainer( i ) = std::cos( 0.37 * i );
+  for ( auto _ : state )
+    {
+      Solver solver;
+      setTolerance( solver.myLinearAlgebraSolver );
+      solver.compute( laplace );
+      benchmark::DoNotOptimize( solver.solve( input ) );
+    }
+  state.counters[ "unknowns" ] = double( input.length() );
+}
+
+static void BM_SimplicialLDLT( benchmark::State& state )
+{
+  solveLaplace< EigenLinearAlgebraBackend::SolverSimplicialLDLT >( state );
+}
+
+static void BM_ConjugateGradient( benchmark::State& state )
+{
+  solveLaplace< EigenLinearAlgebraBackend::SolverConjugateGradient >( state );
+}
+
+static void BM_ConjugateGradientIC( benchmark::State& state )
+{
+  solveLaplace< EigenLinearAlgebraBackend::SolverConjugateGradientIC >( state );
+}
+
+static void BM_GeometricMultigrid( benchmark::State& state )
+{
+  solveLaplace< GeometricMultigridSolver< Calculus > >( state );
+}
+
+BENCHMARK( BM_SimplicialLDLT )->Arg( 10 )->Arg( 20 )->Unit( benchmark::kMillisecond );
+BENCHMARK( BM_ConjugateGradient )->Arg( 10 )->Arg( 20 )->Unit( benchmark::kMillisecond );
+BENCHMARK( BM_ConjugateGradientIC )->Arg( 10 )->Arg( 20 )->Unit( benchmark::kMillisecond );
+BENCHMARK( BM_GeometricMultigrid )->Arg( 10 )->Arg( 20 )->Unit( benchmark::kMillisecond );
+
+int main(int argc, char* argv[])
+{
+  benchmark::Initialize(&argc, argv);
+  benchmark::RunSpecifiedBenchmarks();
+
+  return 0;
+}
+
+/** @ingroup Tests **/
@@ -0,0 +1,126 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file benchmarkPolygonalCalculus-google.cpp
+ * @ingroup Tests
+ *
+ * @date 2026/10/18
+ *
+ * This file is part of the DGtal library
+ */
+
+/**
+ * Description of benchmarkPolygonalCalculus-google <p>
+ * Aim: cost of the assembly of the global Laplace-Beltrami operator
+ * of PolygonalCalculus on a bumpy grid of quads, compared to a
+ * sequential assembly with triplets, and cost of the lumped mass
+ * matrix. The arguments are the number of quads per side of the
+ * grid and, for the Laplace-Beltrami operator, whether the internal
+ * cache is enabled (then only the assembly itself is measured).
+ */
+
+#include <iostream>
+#include <vector>
+#include <cmath>
+
+#include <benchmark/benchmark.h>
+
+#include "DGtal/base/Common.h"
+#include "DGtal/helpers/StdDefs.h"
+#include "DGtal/shapes/SurfaceMesh.h"
+#include "DGtal/dec/PolygonalCalculus.h"
+
+using namespace DGtal;
+using namespace std;
+
+typedef Z3i::RealPoint                               RealPoint;
+typedef SurfaceMesh< RealPoint, RealPoint >          Mesh;
+typedef PolygonalCalculus< RealPoint, RealPoint >    Calculus;
+
+/// @return a n x n grid of quads, with a bumpy height.
+Mesh makeGrid( int n )
+{
+  std::vector< RealPoint > positions;
+  std::vector< Mesh::Vertices > faces;
+  for ( int j = 0; j <= n; ++j )
+    for ( int i = 0; i <= n; ++i )
+      positions.push_back( RealPoint( i, j, std::sin( 0.3 * i ) * std::cos( 0.2 * j ) ) );
+  for ( int j = 0; j < n; ++j )
+    for ( int i = 0; i < n; ++i )
+      {
+        const Mesh::Vertex v = j * ( n + 1 ) + i;
+        faces.push_back( { v, v + 1, v + n + 2, v + n + 1 } );
+      }
+  return Mesh( positions.cbegin(), positions.cend(), faces.cbegin(), faces.cend() );
+}
+
+static void BM_LaplaceBeltramiTriplets( benchmark::State& state )
+{
+  const Mesh mesh = makeGrid( int( state.range( 0 ) ) );
+  Calculus calculus( mesh, state.range( 1 ) != 0 );
+  for ( auto _ : state )
+    {
+      Calculus::SparseMatrix L( mesh.nbVertices(), mesh.nbVertices() );
+      std::vector< Calculus::Triplet > triplets;
+      for ( Calculus::Face f = 0; f < mesh.nbFaces(); ++f )
+        {
+          const auto Lf = calculus.laplaceBeltrami( f );
+          const auto& vertices = mesh.incidentVertices( f );
+          for ( auto i = 0u; i < vertices.size(); ++i )
+            for ( auto j = 0u; j < vertices.size(); ++j )
+              if ( Lf( i, j ) != 0.0 )
+                triplets.emplace_back( vertices[ i ], vertices[ j ], Lf( i, j ) );
+        }
+      L.setFromTriplets( triplets.begin(), triplets.end() );
+      benchmark::DoNotOptimize( L.nonZeros() );
+    }
+  state.SetItemsProcessed( mesh.nbFaces() * state.iterations() );
+}
+
+static void BM_LaplaceBeltrami( benchmark::State& state )
+{
+  const Mesh mesh = makeGrid( int( state.range( 0 ) ) );
+  Calculus calculus( mesh, state.range( 1 ) != 0 );
+  for ( auto _ : state )
+    benchmark::DoNotOptimize( calculus.globalLaplaceBeltrami().nonZeros() );
+  state.SetItemsProcessed( mesh.nbFaces() * state.iterations() );
+}
+
+static void BM_LumpedMassMatrix( benchmark::State& state )
+{
+  const Mesh mesh = makeGrid( int( state.range( 0 ) ) );
+  Calculus calculus( mesh );
+  for ( auto _ : state )
+    benchmark::DoNotOptimize( calculus.globalLumpedMassMatrix().nonZeros() );
+  state.SetItemsProcessed( mesh.nbFaces() * state.iterations() );
+}
+
+BENCHMARK( BM_LaplaceBeltramiTriplets )->Args( { 100, 0 } )->Args( { 300, 0 } )
+  ->Args( { 300, 1 } )->Unit( benchmark::kMillisecond );
+BENCHMARK( BM_LaplaceBeltrami )->Args( { 100, 0 } )->Args( { 300, 0 } )
+  ->Args( { 300, 1 } )->Unit( benchmark::kMillisecond );
+BENCHMARK( BM_LumpedMassMatrix )->Arg( 100 )->Arg( 300 )->Unit( benchmark::kMillisecond );
+
+int main(int argc, char* argv[])
+{
+  benchmark::Initialize(&argc, argv);
+  benchmark::RunSpecifiedBenchmarks();
+
+  return 0;
+}
+
+/** @ingroup Tests **/
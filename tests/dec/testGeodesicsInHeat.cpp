@@ -88,5 +88,40 @@ TEST_CASE( "Testing GeodesicsInHeat" )
     auto sources = heat.source();
     REQUIRE(sources.sum() == 0);
   }
+
+  SECTION("Batched computation")
+  {
+    typedef GeodesicsInHeat<PolygonalCalculus<RealPoint,RealVector>> Heat;
+    std::vector< std::vector< Heat::Vertex > > sets = { { 0 }, { 5 }, { 2, 9 }, { 9, 2 } };
+    for ( bool boundary : { false, true } )
+      {
+        Heat heat(boxCalculus);
+        heat.init(0.1, 1.0, boundary);
+        Heat::DenseMatrix D = heat.compute( sets );
+        REQUIRE( (size_t)D.rows() == positions.size() );
+        REQUIRE( (size_t)D.cols() == sets.size() );
+        for ( std::size_t i = 0; i < sets.size(); ++i )
+          {
+            heat.clearSource();
+            for ( auto v : sets[ i ] ) heat.addSource( v );
+            Heat::Vector d = heat.compute();
+            REQUIRE( ( D.col( i ) - d ).norm() == Approx(0.0).margin(1e-10) );
+          }
+        if ( ! boundary ) REQUIRE( D( 5, 0 ) == Approx(1.444608) );
+      }
+  }
+
+  SECTION("Solving with many right-hand sides")
+  {
+    typedef PolygonalCalculus<RealPoint,RealVector> Calculus;
+    Calculus::SparseMatrix A = boxCalculus.globalLumpedMassMatrix()
+      - 0.1 * boxCalculus.globalLaplaceBeltrami();
+    Calculus::Solver solver;
+    solver.compute( A );
+    Calculus::DenseMatrix B = Calculus::DenseMatrix::Random( A.rows(), 100 );
+    Calculus::DenseMatrix X = Calculus::LinAlg::solveMultiple( solver, B );
+    Calculus::DenseMatrix Y = solver.solve( B );
+    REQUIRE( ( X - Y ).norm() == Approx(0.0).margin(1e-10) );
+  }
 }
 /** @ingroup Tests **/
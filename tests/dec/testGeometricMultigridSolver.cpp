@@ -0,0 +1,192 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file
+ * @ingroup Tests
+ *
+ * @date 2026/10/18
+ *
+ * Functions for testing class GeometricMultigridSolver, the iterative
+ * solvers of DiscreteExteriorCalculusSolver and of ATSolver2D.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include <vector>
+#include "DGtal/base/Common.h"
+#include "ConfigTest.h"
+#include "DGtalCatch.h"
+#include "DGtal/helpers/StdDefs.h"
+
+#include "DGtal/math/linalg/EigenSupport.h"
+#include "DGtal/dec/DiscreteExteriorCalculus.h"
+#include "DGtal/dec/DiscreteExteriorCalculusFactory.h"
+#include "DGtal/dec/DiscreteExteriorCalculusSolver.h"
+#include "DGtal/dec/GeometricMultigridSolver.h"
+#include "DGtal/dec/ATSolver2D.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+
+typedef DiscreteExteriorCalculusFactory<EigenLinearAlgebraBackend> CalculusFactory;
+
+TEST_CASE( "Testing GeometricMultigridSolver on a 3D domain" )
+{
+  typedef DiscreteExteriorCalculus<3, 3, EigenLinearAlgebraBackend> Calculus;
+  typedef Z3i::Domain Domain;
+  typedef Z3i::Point  Point;
+  const Domain domain( Point( 0, 0, 0 ), Point( 15, 15, 15 ) );
+  Z3i::DigitalSet set( domain );
+  for ( auto p : domain )
+    if ( ( p - Point::diagonal( 8 ) ).norm() < 8.5 ) set.insertNew( p );
+  const Calculus calculus = CalculusFactory::createFromDigitalSet( set );
+
+  // The solvers require symmetric positive definite operators.
+  const Calculus::PrimalDerivative0 d0 = calculus.derivative<0, PRIMAL>();
+  const Calculus::PrimalIdentity0 laplace = d0.transpose() * d0
+    + 0.01 * calculus.identity<0, PRIMAL>();
+  Calculus::PrimalForm0 input( calculus );
+  for ( Calculus::Index i = 0; i < input.length(); i++ )
+    input.myContainer( i ) = std::cos( 0.37 * i );
+
+  typedef DiscreteExteriorCalculusSolver<Calculus, EigenLinearAlgebraBackend::SolverSimplicialLDLT, 0, PRIMAL, 0, PRIMAL> DirectSolver;
+  DirectSolver direct;
+  direct.compute( laplace );
+  const Calculus::PrimalForm0 expected = direct.solve( input );
+  REQUIRE( direct.isValid() );
+
+  SECTION( "Multigrid hierarchy and solution" )
+  {
+    typedef GeometricMultigridSolver<Calculus> LinearAlgebraSolver;
+    typedef DiscreteExteriorCalculusSolver<Calculus, LinearAlgebraSolver, 0, PRIMAL, 0, PRIMAL> Solver;
+    Solver solver;
+    solver.myLinearAlgebraSolver.setCoarsestSize( 100 ).setTolerance( 1e-10 );
+    solver.compute( laplace );
+    REQUIRE( solver.myLinearAlgebraSolver.nbLevels() > 2 );
+    const Calculus::PrimalForm0 x = solver.solve( input );
+    REQUIRE( solver.isValid() );
+    REQUIRE( ( x.myContainer - expected.myContainer ).lpNorm<Eigen::Infinity>()
+             == Approx( 0.0 ).margin( 1e-6 ) );
+    // A good preconditioner converges in few iterations.
+    REQUIRE( solver.myLinearAlgebraSolver.iterations() < 30 );
+  }
+
+  SECTION( "Warm start" )
+  {
+    typedef GeometricMultigridSolver<Calculus> LinearAlgebraSolver;
+    typedef DiscreteExteriorCalculusSolver<Calculus, LinearAlgebraSolver, 0, PRIMAL, 0, PRIMAL> Solver;
+    Solver solver;
+    solver.myLinearAlgebraSolver.setCoarsestSize( 100 ).setTolerance( 1e-6 );
+    solver.compute( laplace );
+    solver.solve( input );
+    const auto cold = solver.myLinearAlgebraSolver.iterations();
+    const Calculus::PrimalForm0 x = solver.solveWithGuess( input, expected );
+    REQUIRE( solver.isValid() );
+    REQUIRE( solver.myLinearAlgebraSolver.iterations() == 0 );
+    REQUIRE( cold > 0 );
+    REQUIRE( ( x.myContainer - expected.myContainer ).lpNorm<Eigen::Infinity>()
+             == Approx( 0.0 ).margin( 1e-10 ) );
+  }
+
+  SECTION( "Multigrid on dual forms" )
+  {
+    const Calculus::DualIdentity0 dual_laplace = calculus.laplace<DUAL>()
+      + 0.01 * calculus.identity<0, DUAL>();
+    Calculus::DualForm0 dual_input( calculus );
+    for ( Calculus::Index i = 0; i < dual_input.length(); i++ )
+      dual_input.myContainer( i ) = std::sin( 0.11 * i );
+    typedef DiscreteExteriorCalculusSolver<Calculus, EigenLinearAlgebraBackend::SolverSimplicialLDLT, 0, DUAL, 0, DUAL> DualDirectSolver;
+    typedef DiscreteExteriorCalculusSolver<Calculus, GeometricMultigridSolver<Calculus>, 0, DUAL, 0, DUAL> DualSolver;
+    DualDirectSolver dual_direct;
+    dual_direct.compute( dual_laplace );
+    DualSolver solver;
+    solver.myLinearAlgebraSolver.setCoarsestSize( 100 ).setTolerance( 1e-10 );
+    solver.compute( dual_laplace );
+    REQUIRE( solver.myLinearAlgebraSolver.nbLevels() > 1 );
+    const Calculus::DualForm0 x = solver.solve( dual_input );
+    REQUIRE( solver.isValid() );
+    REQUIRE( ( x.myContainer - dual_direct.solve( dual_input ).myContainer ).lpNorm<Eigen::Infinity>()
+             == Approx( 0.0 ).margin( 1e-6 ) );
+  }
+
+  SECTION( "Conjugate gradient with incomplete Cholesky and guesses" )
+  {
+    typedef DiscreteExteriorCalculusSolver<Calculus, EigenLinearAlgebraBackend::SolverConjugateGradientIC, 0, PRIMAL, 0, PRIMAL> Solver;
+    Solver solver;
+    solver.myLinearAlgebraSolver.setTolerance( 1e-10 );
+    solver.compute( laplace );
+    const Calculus::PrimalForm0 x = solver.solve( input );
+    REQUIRE( solver.isValid() );
+    REQUIRE( ( x.myContainer - expected.myContainer ).lpNorm<Eigen::Infinity>()
+             == Approx( 0.0 ).margin( 1e-6 ) );
+    solver.solveWithGuess( input, expected );
+    REQUIRE( solver.myLinearAlgebraSolver.iterations() == 0 );
+    // Direct solvers ignore the guess.
+    const Calculus::PrimalForm0 y = direct.solveWithGuess( input, input );
+    REQUIRE( ( y.myContainer - expected.myContainer ).lpNorm<Eigen::Infinity>() == 0.0 );
+  }
+}
+
+TEST_CASE( "Testing ATSolver2D with iterative solvers" )
+{
+  typedef Z2i::KSpace KSpace;
+  typedef Z2i::Domain Domain;
+  typedef Z2i::Point  Point;
+  const Domain domain( Point( 0, 0 ), Point( 31, 31 ) );
+  Z2i::DigitalSet set( domain );
+  for ( auto p : domain ) set.insertNew( p );
+  const auto calculus = CalculusFactory::createFromDigitalSet( set );
+  typedef decltype( calculus ) ConstCalculus;
+  typedef typename std::remove_const<ConstCalculus>::type Calculus;
+
+  // A noisy step function on pixels.
+  std::vector<KSpace::SCell> pixels;
+  std::vector<double> input;
+  for ( Calculus::Index i = 0; i < calculus.kFormLength( 2, PRIMAL ); i++ )
+    {
+      const auto cell = calculus.getSCell( 2, PRIMAL, i );
+      pixels.push_back( cell );
+      const auto x = calculus.myKSpace.sKCoord( cell, 0 );
+      input.push_back( ( x < 32 ? 0.0 : 1.0 ) + 0.1 * std::cos( 1.7 * i ) );
+    }
+
+  ATSolver2D< KSpace > direct( calculus );
+  direct.initInputScalarFieldU2( input, pixels.cbegin(), pixels.cend() );
+  direct.setUp( 0.1, 0.01 );
+  direct.solveGammaConvergence( 2.0, 0.5, 2.0 );
+  std::vector<double> expected( input.size() );
+  direct.getOutputScalarFieldU2( expected, pixels.cbegin(), pixels.cend() );
+
+  typedef ATSolver2D< KSpace, EigenLinearAlgebraBackend, GeometricMultigridSolver<Calculus> > MultigridATSolver;
+  MultigridATSolver at( calculus );
+  at.solver_setup = [] ( GeometricMultigridSolver<Calculus>& solver )
+    { solver.setCoarsestSize( 100 ).setTolerance( 1e-10 ); };
+  at.initInputScalarFieldU2( input, pixels.cbegin(), pixels.cend() );
+  at.setUp( 0.1, 0.01 );
+  REQUIRE( at.solveGammaConvergence( 2.0, 0.5, 2.0 ) );
+  std::vector<double> output( input.size() );
+  at.getOutputScalarFieldU2( output, pixels.cbegin(), pixels.cend() );
+  double error = 0.0;
+  for ( std::size_t i = 0; i < output.size(); i++ )
+    error = std::max( error, std::fabs( output[ i ] - expected[ i ] ) );
+  REQUIRE( error == Approx( 0.0 ).margin( 1e-5 ) );
+}
+
+/** @ingroup Tests **/
@@ -272,9 +272,54 @@ TEST_CASE( "Testing PolygonalCalculus" )
     auto tpsC = trace.endBlock();
     REQUIRE(tpsC < tps);
     REQUIRE(L.norm() == Approx(LC.norm()));
-    
+
+    boxCalculusCached.disableInternalGlobalCache();
+    REQUIRE(boxCalculusCached.globalLaplaceBeltrami().isApprox(boxCalculus.globalLaplaceBeltrami()));
+    boxCalculusCached.enableInternalGlobalCache();
+    REQUIRE(boxCalculusCached.globalLaplaceBeltrami().isApprox(boxCalculus.globalLaplaceBeltrami()));
   }
-  
+
+  SECTION("Global operators assembly")
+  {
+    typedef PolygonalCalculus< RealPoint,RealVector > Calculus;
+    // Reference assembly with triplets.
+    auto assemble = [&](const std::function<Calculus::DenseMatrix(Calculus::Face)> &op,
+                        const unsigned int k)
+    {
+      Calculus::SparseMatrix M(k*box.nbVertices(), k*box.nbVertices());
+      std::vector<Calculus::Triplet> triplets;
+      for(Calculus::Face f = 0; f < box.nbFaces(); ++f)
+      {
+        const auto L = op(f);
+        const auto vertices = box.incidentVertices(f);
+        for(auto i = 0u; i < k*vertices.size(); ++i)
+          for(auto j = 0u; j < k*vertices.size(); ++j)
+            if (L(i,j) != 0.0)
+              triplets.emplace_back(k*vertices[i/k] + i%k, k*vertices[j/k] + j%k, L(i,j));
+      }
+      M.setFromTriplets(triplets.begin(), triplets.end());
+      return M;
+    };
+    const auto L = boxCalculus.globalLaplaceBeltrami(0.5);
+    const auto Lref = assemble([&](Calculus::Face f){ return boxCalculus.laplaceBeltrami(f,0.5); }, 1);
+    REQUIRE( L.nonZeros() == Lref.nonZeros() );
+    REQUIRE( (L - Lref).norm() == Approx(0.0).margin(1e-12) );
+    const auto CL = boxCalculus.globalConnectionLaplace(0.5);
+    const auto CLref = assemble([&](Calculus::Face f){ return boxCalculus.connectionLaplacian(f,0.5); }, 2);
+    REQUIRE( CL.rows() == 2*(long)box.nbVertices() );
+    REQUIRE( CL.nonZeros() == CLref.nonZeros() );
+    REQUIRE( (CL - CLref).norm() == Approx(0.0).margin(1e-12) );
+    const auto M  = boxCalculus.globalLumpedMassMatrix();
+    const auto M2 = boxCalculus.doubledGlobalLumpedMassMatrix();
+    REQUIRE( M.nonZeros() == (long)box.nbVertices() );
+    REQUIRE( M2.nonZeros() == 2*(long)box.nbVertices() );
+    for( Calculus::Vertex v = 0; v < box.nbVertices(); ++v )
+    {
+      REQUIRE( M2.coeff(2*v,2*v) == M.coeff(v,v) );
+      REQUIRE( M2.coeff(2*v+1,2*v+1) == M.coeff(v,v) );
+    }
+  }
+
 }
 
 TEST_CASE( "Testing PolygonalCalculus and DirichletConditions" )
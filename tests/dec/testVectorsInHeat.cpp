@@ -89,5 +89,33 @@ TEST_CASE( "Testing VectorsInHeat" )
     VectorsInHeat<PolygonalCalculus<RealPoint,RealVector>>::Vector sources=heat.vectorSource();
     REQUIRE( sources.sum() == 0);
   }
+
+  SECTION("Batched computation")
+  {
+    typedef VectorsInHeat<PolygonalCalculus<RealPoint,RealVector>> Heat;
+    typedef Heat::Vector Vector;
+    std::vector< Heat::VectorSources > sets =
+      { { { 0, Eigen::Vector3d(0.1,0.2,0.3) } },
+        { { 5, Eigen::Vector3d(1.0,0.0,0.0) }, { 9, Eigen::Vector3d(0.0,0.5,1.0) } } };
+    for ( bool boundary : { false, true } )
+      {
+        Heat heat(boxCalculus);
+        heat.init(0.1, 1.0, boundary);
+        auto batch = heat.compute( sets );
+        REQUIRE( batch.size() == sets.size() );
+        for ( std::size_t i = 0; i < sets.size(); ++i )
+          {
+            heat.clearSource();
+            for ( const auto& s : sets[ i ] ) heat.addSource( s.first, s.second );
+            std::vector<Vector> d = heat.compute();
+            REQUIRE( batch[ i ].size() == d.size() );
+            double error = 0.0;
+            for ( std::size_t v = 0; v < d.size(); ++v )
+              error = std::max( error, ( batch[ i ][ v ] - d[ v ] ).norm() );
+            REQUIRE( error == Approx(0.0).margin(1e-10) );
+          }
+        if ( ! boundary ) REQUIRE( batch[ 0 ][ 5 ][ 0 ] == Approx(-0.111302) );
+      }
+  }
 }
 /** @ingroup Tests **/
@@ -0,0 +1,199 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file testPackedFreemanChain.cpp
+ * @ingroup Tests
+ *
+ * @date 2026/10/18
+ *
+ * Functions for testing class PackedFreemanChain.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include <fstream>
+#include <vector>
+#include <cstdlib>
+#include "DGtal/base/Common.h"
+#include "ConfigTest.h"
+#include "DGtalCatch.h"
+#include "DGtal/geometry/curves/FreemanChain.h"
+#include "DGtal/geometry/curves/ArithmeticalDSSComputer.h"
+#include "DGtal/geometry/curves/GreedySegmentation.h"
+#include "DGtal/geometry/curves/PackedFreemanChain.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+
+typedef FreemanChain<int>         FC;
+typedef PackedFreemanChain<int>   PFC;
+typedef std::vector<FC::Point>    Range;
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for testing class PackedFreemanChain.
+///////////////////////////////////////////////////////////////////////////////
+
+/// A random chain made of runs of random lengths of two or three codes.
+FC randomChain( unsigned int n )
+{
+  std::string s;
+  char c = '0';
+  while ( s.size() < n )
+    {
+      const unsigned int l = 1 + rand() % ( ( rand() % 8 == 0 ) ? 100 : 6 );
+      s += std::string( l, c );
+      c = FC::addToCode( c, ( rand() % 4 == 0 ) ? 3 : 1 );
+      s += c;
+      c = FC::addToCode( c, 3 );
+    }
+  return FC( s, 3, -7 );
+}
+
+/// Checks that the DSS of the packed chain are the ones of GreedySegmentation.
+void checkGreedySegmentation( const FC& fc )
+{
+  typedef StandardDSS4Computer<Range::const_iterator> SegmentComputer;
+  Range points( fc.begin(), fc.end() );
+  GreedySegmentation<SegmentComputer> segmentation( points.begin(), points.end(),
+                                                    SegmentComputer() );
+  std::vector<PFC::DSS> expected;
+  for ( auto it = segmentation.begin(), itEnd = segmentation.end(); it != itEnd; ++it )
+    expected.push_back( it->primitive() );
+  PFC pfc( fc );
+  const auto segments = pfc.greedyDSSSegmentation();
+  REQUIRE( segments.size() == expected.size() );
+  unsigned int nb_ok = 0;
+  for ( std::size_t i = 0; i < segments.size(); ++i )
+    nb_ok += segments[ i ].equalsTo( expected[ i ] ) ? 1 : 0;
+  REQUIRE( nb_ok == expected.size() );
+}
+
+TEST_CASE( "Testing PackedFreemanChain" )
+{
+  std::string filename = testPath + "samples/manche.fc";
+  std::fstream fst;
+  fst.open( filename.c_str(), std::ios::in );
+  FC fc( fst );
+  PFC pfc( fc );
+
+  SECTION( "Packing" )
+    {
+      REQUIRE( pfc.size() == fc.size() );
+      REQUIRE( pfc.isValid() );
+      REQUIRE( pfc.toFreemanChain() == fc );
+      REQUIRE( pfc.words().size() * sizeof( PFC::Word ) <= fc.size() / 4 + sizeof( PFC::Word ) );
+      REQUIRE( pfc.firstPoint() == fc.firstPoint() );
+      REQUIRE( pfc.lastPoint() == fc.lastPoint() );
+      unsigned int nb_ok = 0;
+      for ( PFC::Index i = 0; i <= fc.size(); ++i )
+        nb_ok += ( pfc.getPoint( i ) == fc.getPoint( i ) ) ? 1 : 0;
+      REQUIRE( nb_ok == fc.size() + 1 );
+      PFC pfc2( fc.x0, fc.y0 );
+      for ( auto c : fc.chain ) pfc2.extend( c );
+      REQUIRE( pfc2.words() == pfc.words() );
+      REQUIRE( pfc2.lastPoint() == fc.lastPoint() );
+    }
+
+  SECTION( "Run-length decoding" )
+    {
+      std::string s;
+      for ( auto r : pfc.runs() ) s += std::string( r.second, r.first );
+      REQUIRE( s == fc.chain );
+      unsigned int nb_ok = 0;
+      for ( PFC::Index i = 0; i < fc.size(); ++i )
+        {
+          PFC::Size l = 0;
+          while ( ( i + l < fc.size() ) && ( fc.chain[ i + l ] == fc.chain[ i ] ) ) ++l;
+          nb_ok += ( pfc.runLength( i ) == l ) ? 1 : 0;
+        }
+      REQUIRE( nb_ok == fc.size() );
+      PFC straight;
+      for ( unsigned int i = 0; i < 100; ++i ) straight.extend( '1' );
+      REQUIRE( straight.runLength( 0 ) == 100 );
+      REQUIRE( straight.runLength( 40 ) == 60 );
+    }
+
+  SECTION( "Reversal and rotations" )
+    {
+      for ( PFC::Size n : { 0, 1, 31, 32, 33, 64, 100 } )
+        {
+          FC sub = fc.subChain( 0, n );
+          PFC psub( sub );
+          PFC rev = psub.reversed();
+          std::string s( sub.chain.rbegin(), sub.chain.rend() );
+          for ( auto& c : s ) c = FC::addToCode( c, 2 );
+          REQUIRE( rev.toFreemanChain() == FC( s, sub.xn, sub.yn ) );
+          REQUIRE( rev.lastPoint() == sub.firstPoint() );
+          REQUIRE( rev.isValid() );
+          REQUIRE( rev.reversed().words() == psub.words() );
+        }
+      for ( int n : { -1, 1, 2, 3, 4 } )
+        {
+          PFC rot = pfc.rotated( n );
+          std::string s( fc.chain );
+          for ( auto& c : s ) c = FC::addToCode( c, n );
+          REQUIRE( rot.toFreemanChain() == FC( s, fc.x0, fc.y0 ) );
+          REQUIRE( rot.isValid() );
+        }
+    }
+}
+
+TEST_CASE( "Testing DSS recognition on PackedFreemanChain" )
+{
+  SECTION( "Greedy segmentation of a contour" )
+    {
+      std::string filename = testPath + "samples/manche.fc";
+      std::fstream fst;
+      fst.open( filename.c_str(), std::ios::in );
+      FC fc( fst );
+      checkGreedySegmentation( fc );
+    }
+
+  SECTION( "Greedy segmentation of random chains" )
+    {
+      srand( 0 );
+      for ( unsigned int i = 0; i < 20; ++i )
+        checkGreedySegmentation( randomChain( 2000 ) );
+    }
+
+  SECTION( "Longest DSS and batch extension" )
+    {
+      srand( 1 );
+      FC fc = randomChain( 3000 );
+      PFC pfc( fc );
+      unsigned int nb_ok = 0;
+      for ( PFC::Index i = 0; i < 100; ++i )
+        {
+          PFC::DSS expected( fc.getPoint( i ) );
+          PFC::Index j = i;
+          while ( ( j < fc.size() ) && expected.extendFront( fc.getPoint( j + 1 ) ) ) ++j;
+          nb_ok += pfc.longestDSS( i ).equalsTo( expected ) ? 1 : 0;
+        }
+      REQUIRE( nb_ok == 100 );
+      PFC::DSS dss( PFC::Point( 0, 0 ) );
+      REQUIRE( PFC::extendFront( dss, PFC::Vector( 1, 0 ), 10 ) == 10 );
+      REQUIRE( PFC::extendFront( dss, PFC::Vector( 0, 1 ), 5 ) == 1 );
+      REQUIRE( dss.front() == PFC::Point( 10, 1 ) );
+      REQUIRE( dss.a() == 1 );
+      REQUIRE( dss.b() == 10 );
+    }
+}
+
+/** @ingroup Tests **/
@@ -0,0 +1,150 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file testParallelSaturatedSegmentation.cpp
+ * @ingroup Tests
+ *
+ * @date 2026/10/18
+ *
+ * Functions for testing class ParallelSaturatedSegmentation.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include <fstream>
+#include <vector>
+#include <cstdlib>
+#include "DGtal/base/Common.h"
+#include "DGtal/base/Circulator.h"
+#include "ConfigTest.h"
+#include "DGtalCatch.h"
+#include "DGtal/geometry/curves/FreemanChain.h"
+#include "DGtal/geometry/curves/ArithmeticalDSSComputer.h"
+#include "DGtal/geometry/curves/SaturatedSegmentation.h"
+#include "DGtal/geometry/curves/ParallelSaturatedSegmentation.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+
+typedef PointVector<2,int>     Point;
+typedef std::vector<Point>     Range;
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for testing class ParallelSaturatedSegmentation.
+///////////////////////////////////////////////////////////////////////////////
+
+/**
+ * Checks that ParallelSaturatedSegmentation gives the same maximal
+ * segments as SaturatedSegmentation on the range [itb,ite), for
+ * several numbers of chunks.
+ * @return the number of maximal segments.
+ */
+template <typename SegmentComputer>
+std::size_t checkSameSegments( const typename SegmentComputer::ConstIterator& itb,
+                               const typename SegmentComputer::ConstIterator& ite,
+                               const std::string& mode )
+{
+  SaturatedSegmentation<SegmentComputer> segmentation( itb, ite, SegmentComputer() );
+  segmentation.setMode( mode );
+  std::vector<SegmentComputer> expected;
+  for ( auto it = segmentation.begin(), itEnd = segmentation.end(); it != itEnd; ++it )
+    expected.push_back( *it );
+
+  for ( std::size_t nb : { 0, 1, 2, 7, 64, 100000 } )
+    {
+      ParallelSaturatedSegmentation<SegmentComputer> parallel( itb, ite, SegmentComputer() );
+      parallel.setMode( mode );
+      parallel.setNbChunks( nb );
+      const auto& segments = parallel.compute();
+      REQUIRE( segments.size() == expected.size() );
+      unsigned int nb_ok = 0;
+      for ( std::size_t i = 0; i < segments.size(); ++i )
+        nb_ok += ( ( segments[ i ].begin() == expected[ i ].begin() )
+                   && ( segments[ i ].end() == expected[ i ].end() )
+                   && ( segments[ i ] == expected[ i ] ) ) ? 1 : 0;
+      REQUIRE( nb_ok == expected.size() );
+    }
+  return expected.size();
+}
+
+/// A random 8-connected curve made of long straight parts.
+Range randomCurve( unsigned int n )
+{
+  Range points;
+  Point p( 0, 0 );
+  Point steps[ 8 ] = { Point( 1, 0 ), Point( 1, 1 ), Point( 0, 1 ), Point( -1, 1 ),
+                       Point( -1, 0 ), Point( -1, -1 ), Point( 0, -1 ), Point( 1, -1 ) };
+  unsigned int d = 0;
+  for ( unsigned int i = 0; i < n; ++i )
+    {
+      points.push_back( p );
+      if ( rand() % 16 == 0 ) d = ( d + 1 + rand() % 2 * 6 ) % 8; // turn by +/- 45 degrees
+      p += ( rand() % 4 == 0 ) ? steps[ ( d + 1 ) % 8 ] : steps[ d ];
+    }
+  return points;
+}
+
+TEST_CASE( "Testing ParallelSaturatedSegmentation on an open curve" )
+{
+  srand( 0 );
+  Range points = randomCurve( 20000 );
+  typedef NaiveDSS8Computer<Range::const_iterator> SegmentComputer;
+
+  SECTION( "Default mode" )
+    {
+      REQUIRE( checkSameSegments<SegmentComputer>( points.begin(), points.end(), "MostCentered" ) > 100 );
+    }
+  SECTION( "Tiny ranges" )
+    {
+      REQUIRE( checkSameSegments<SegmentComputer>( points.begin(), points.begin() + 1, "MostCentered" ) == 1 );
+      REQUIRE( checkSameSegments<SegmentComputer>( points.begin(), points.begin() + 3, "MostCentered" ) == 1 );
+      REQUIRE( checkSameSegments<SegmentComputer>( points.begin(), points.begin(), "MostCentered" ) == 0 );
+    }
+}
+
+TEST_CASE( "Testing ParallelSaturatedSegmentation on a closed curve" )
+{
+  std::string filename = testPath + "samples/manche.fc";
+  std::fstream fst;
+  fst.open( filename.c_str(), std::ios::in );
+  FreemanChain<int> fc( fst );
+  Range points( fc.begin(), fc.end() );
+  points.pop_back(); // the last point is the first one
+  typedef Circulator<Range::const_iterator> ConstCirculator;
+  typedef StandardDSS4Computer<ConstCirculator> SegmentComputer;
+  ConstCirculator c( points.begin(), points.begin(), points.end() );
+
+  SECTION( "Default mode" )
+    {
+      REQUIRE( checkSameSegments<SegmentComputer>( c, c, "MostCentered" ) > 10 );
+    }
+  SECTION( "Other modes" )
+    {
+      REQUIRE( checkSameSegments<SegmentComputer>( c, c, "First" ) > 10 );
+      REQUIRE( checkSameSegments<SegmentComputer>( c, c, "Last" ) > 10 );
+    }
+  SECTION( "Other starting point" )
+    {
+      ConstCirculator c2( points.begin() + points.size() / 3, points.begin(), points.end() );
+      REQUIRE( checkSameSegments<SegmentComputer>( c2, c2, "MostCentered" ) > 10 );
+    }
+}
+
+/** @ingroup Tests **/
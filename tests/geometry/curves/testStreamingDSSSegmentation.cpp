@@ -0,0 +1,199 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file testStreamingDSSSegmentation.cpp
+ * @ingroup Tests
+ *
+ * @date 2026/10/18
+ *
+ * Functions for testing class StreamingDSSSegmentation.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include <fstream>
+#include <vector>
+#include <tuple>
+#include <cstdlib>
+#include "DGtal/base/Common.h"
+#include "ConfigTest.h"
+#include "DGtalCatch.h"
+#include "DGtal/geometry/curves/FreemanChain.h"
+#include "DGtal/geometry/curves/ArithmeticalDSSComputer.h"
+#include "DGtal/geometry/curves/GreedySegmentation.h"
+#include "DGtal/geometry/curves/SaturatedSegmentation.h"
+#include "DGtal/geometry/curves/StreamingDSSSegmentation.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+
+typedef PointVector<2,int>     Point;
+typedef std::vector<Point>     Range;
+typedef std::tuple<std::ptrdiff_t, std::ptrdiff_t, int, int, int> Segment;
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for testing class StreamingDSSSegmentation.
+///////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @return the segments (first index, end index, a, b, mu) of a
+ * segmentation of the range @a points computed with
+ * GreedySegmentation or SaturatedSegmentation.
+ */
+template <typename Segmentation>
+std::vector<Segment> classicalSegments( const Range& points )
+{
+  typedef typename Segmentation::SegmentComputer SegmentComputer;
+  std::vector<Segment> result;
+  Segmentation segmentation( points.begin(), points.end(), SegmentComputer() );
+  for ( auto it = segmentation.begin(), itEnd = segmentation.end(); it != itEnd; ++it )
+    result.push_back( Segment( it->begin() - points.begin(), it->end() - points.begin(),
+                               it->a(), it->b(), it->mu() ) );
+  return result;
+}
+
+/**
+ * @return the segments (first index, end index, a, b, mu) of a
+ * segmentation of the range @a points computed with
+ * StreamingDSSSegmentation, points being given one by one.
+ */
+template <typename Segmentation, typename TInputIterator>
+std::vector<Segment> streamingSegments( typename Segmentation::Mode mode,
+                                        TInputIterator itb, TInputIterator ite,
+                                        std::size_t& maxBufferSize )
+{
+  std::vector<Segment> result;
+  Segmentation segmentation( mode, [&] ( const typename Segmentation::SegmentComputer& s )
+  {
+    result.push_back( Segment( s.begin().index(), s.end().index(),
+                               s.a(), s.b(), s.mu() ) );
+  } );
+  segmentation.push( itb, ite );
+  maxBufferSize = segmentation.maxBufferSize();
+  REQUIRE( segmentation.isValid() );
+  segmentation.finish();
+  REQUIRE( segmentation.nbPoints() == 0 );
+  return result;
+}
+
+/// A random 8-connected curve made of long straight parts.
+Range randomCurve( unsigned int n )
+{
+  Range points;
+  Point p( 0, 0 );
+  Point steps[ 8 ] = { Point( 1, 0 ), Point( 1, 1 ), Point( 0, 1 ), Point( -1, 1 ),
+                       Point( -1, 0 ), Point( -1, -1 ), Point( 0, -1 ), Point( 1, -1 ) };
+  unsigned int d = 0;
+  for ( unsigned int i = 0; i < n; ++i )
+    {
+      points.push_back( p );
+      if ( rand() % 16 == 0 ) d = ( d + 1 + rand() % 2 * 6 ) % 8; // turn by +/- 45 degrees
+      p += ( rand() % 4 == 0 ) ? steps[ ( d + 1 ) % 8 ] : steps[ d ];
+    }
+  return points;
+}
+
+TEST_CASE( "Testing StreamingDSSSegmentation on a 4-connected contour" )
+{
+  std::string filename = testPath + "samples/manche.fc";
+  std::fstream fst;
+  fst.open( filename.c_str(), std::ios::in );
+  FreemanChain<int> fc( fst );
+  Range points( fc.begin(), fc.end() );
+  REQUIRE( points.size() > 100 );
+
+  typedef StandardDSS4Computer<Range::const_iterator> SegmentComputer;
+  typedef StreamingDSSSegmentation<int, int, 4>      Streaming;
+  std::size_t maxBufferSize = 0;
+
+  SECTION( "Greedy segmentation" )
+    {
+      auto expected = classicalSegments< GreedySegmentation<SegmentComputer> >( points );
+      // FreemanChain::ConstIterator is used as a single-pass iterator
+      auto segments = streamingSegments< Streaming >( Streaming::Mode::GREEDY,
+                                                      fc.begin(), fc.end(), maxBufferSize );
+      REQUIRE( segments.size() == expected.size() );
+      REQUIRE( segments == expected );
+    }
+
+  SECTION( "Saturated segmentation" )
+    {
+      auto expected = classicalSegments< SaturatedSegmentation<SegmentComputer> >( points );
+      auto segments = streamingSegments< Streaming >( Streaming::Mode::SATURATED,
+                                                      fc.begin(), fc.end(), maxBufferSize );
+      REQUIRE( segments.size() == expected.size() );
+      REQUIRE( segments == expected );
+    }
+}
+
+TEST_CASE( "Testing StreamingDSSSegmentation on a long 8-connected curve" )
+{
+  srand( 0 );
+  Range points = randomCurve( 200000 );
+
+  typedef NaiveDSS8Computer<Range::const_iterator> SegmentComputer;
+  typedef StreamingDSSSegmentation<int>            Streaming;
+  std::size_t maxBufferSize = 0;
+
+  SECTION( "Greedy segmentation" )
+    {
+      auto expected = classicalSegments< GreedySegmentation<SegmentComputer> >( points );
+      auto segments = streamingSegments< Streaming >( Streaming::Mode::GREEDY,
+                                                      points.begin(), points.end(),
+                                                      maxBufferSize );
+      REQUIRE( segments == expected );
+      REQUIRE( maxBufferSize < points.size() / 10 );
+    }
+
+  SECTION( "Saturated segmentation" )
+    {
+      auto expected = classicalSegments< SaturatedSegmentation<SegmentComputer> >( points );
+      auto segments = streamingSegments< Streaming >( Streaming::Mode::SATURATED,
+                                                      points.begin(), points.end(),
+                                                      maxBufferSize );
+      REQUIRE( segments == expected );
+      REQUIRE( maxBufferSize < points.size() / 10 );
+    }
+
+  SECTION( "Several curves with the same object" )
+    {
+      std::vector<Segment> segments;
+      Streaming segmentation( Streaming::Mode::SATURATED,
+                              [&] ( const Streaming::SegmentComputer& s )
+                              {
+                                segments.push_back( Segment( s.begin().index(), s.end().index(),
+                                                             s.a(), s.b(), s.mu() ) );
+                              } );
+      segmentation.push( points.begin(), points.begin() + 1000 );
+      segmentation.finish();
+      const auto nb = segments.size();
+      segmentation.push( points.begin(), points.begin() + 1000 );
+      segmentation.finish();
+      REQUIRE( segments.size() == 2 * nb );
+      REQUIRE( std::equal( segments.begin(), segments.begin() + nb, segments.begin() + nb ) );
+      // A single point gives one segment.
+      segmentation.push( points[ 0 ] );
+      segmentation.finish();
+      REQUIRE( segments.size() == 2 * nb + 1 );
+      REQUIRE( std::get<1>( segments.back() ) == 1 );
+    }
+}
+
+/** @ingroup Tests **/
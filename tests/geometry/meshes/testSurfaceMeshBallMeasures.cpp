@@ -0,0 +1,136 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file testSurfaceMeshBallMeasures.cpp
+ * @ingroup Tests
+ *
+ * @date 2026/10/18
+ *
+ * Functions for testing class SurfaceMeshBallMeasures.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include <vector>
+#include "DGtal/base/Common.h"
+#include "DGtal/kernel/SpaceND.h"
+#include "DGtal/shapes/SurfaceMesh.h"
+#include "DGtal/shapes/SurfaceMeshHelper.h"
+#include "DGtal/geometry/meshes/CorrectedNormalCurrentComputer.h"
+#include "DGtal/geometry/meshes/NormalCycleComputer.h"
+#include "DGtal/geometry/meshes/SurfaceMeshBallMeasures.h"
+#include "DGtalCatch.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for testing class SurfaceMeshBallMeasures.
+///////////////////////////////////////////////////////////////////////////////
+
+SCENARIO( "SurfaceMeshBallMeasures gives the same values as SurfaceMeshMeasure::measure", "[ball][sphere]" )
+{
+  using namespace Z3i;
+  typedef SurfaceMesh< RealPoint, RealVector >       SM;
+  typedef SurfaceMeshHelper< RealPoint, RealVector > SMH;
+  typedef CorrectedNormalCurrentComputer< RealPoint, RealVector > CNCComputer;
+  typedef NormalCycleComputer< RealPoint, RealVector > NCComputer;
+  typedef SurfaceMeshBallMeasures< RealPoint, RealVector > BallMeasures;
+
+  SM sphere = SMH::makeSphere( 1.0, RealPoint { 0.0, 0.0, 0.0 }, 20, 20,
+                               SMH::NormalsType::VERTEX_NORMALS );
+  CNCComputer  cnc( sphere );
+  BallMeasures balls( sphere );
+  const double R = 0.3;
+  GIVEN( "A discretized sphere of radius 1 with 20x20x2 triangles" ) {
+    THEN( "Face-based measures on balls centered at faces are identical" ) {
+      auto mu0  = cnc.computeMu0();
+      auto muXY = cnc.computeMuXY();
+      auto m0   = balls.measuresAtFaces( mu0,  R );
+      auto mXY  = balls.measuresAtFaces( muXY, R );
+      REQUIRE( m0.size()  == sphere.nbFaces() );
+      REQUIRE( mXY.size() == sphere.nbFaces() );
+      for ( SM::Face f = 0; f < sphere.nbFaces(); ++f )
+        {
+          const RealPoint b = sphere.faceCentroid( f );
+          REQUIRE( m0[ f ]  == mu0.measure ( b, R, f ) );
+          REQUIRE( mXY[ f ] == muXY.measure( b, R, f ) );
+        }
+    }
+    THEN( "Face-based measures on balls centered at vertices are identical" ) {
+      auto mu1 = cnc.computeMu1();
+      auto m1  = balls.measuresAtVertices( mu1, R );
+      REQUIRE( m1.size() == sphere.nbVertices() );
+      for ( SM::Vertex v = 0; v < sphere.nbVertices(); ++v )
+        REQUIRE( m1[ v ] == mu1.measure( sphere.positions()[ v ], R,
+                                         balls.vertexFaces()[ v ] ) );
+    }
+    THEN( "Vertex and edge based measures on balls are identical" ) {
+      NCComputer nc( sphere );
+      auto mu1 = nc.computeMu1(); // edge measure
+      auto mu2 = nc.computeMu2(); // vertex measure
+      auto m1  = balls.measuresAtFaces( mu1, R );
+      auto m2  = balls.measuresAtFaces( mu2, R );
+      unsigned int nb_ok = 0;
+      for ( SM::Face f = 0; f < sphere.nbFaces(); ++f )
+        {
+          const RealPoint b = sphere.faceCentroid( f );
+          nb_ok += ( m1[ f ] == mu1.measure( b, R, f ) ) ? 1 : 0;
+          nb_ok += ( m2[ f ] == mu2.measure( b, R, f ) ) ? 1 : 0;
+        }
+      REQUIRE( nb_ok == 2 * sphere.nbFaces() );
+    }
+    THEN( "Several measures can be aggregated in one traversal" ) {
+      auto mu0 = cnc.computeMu0();
+      auto mu1 = cnc.computeMu1();
+      auto mu2 = cnc.computeMu2();
+      std::vector< double > H( sphere.nbVertices() );
+      std::vector< double > G( sphere.nbVertices() );
+      balls.traverseBalls( sphere.positions(), balls.vertexFaces(), R, false,
+                           [&] ( std::size_t i, const BallMeasures::Vertices&,
+                                 const BallMeasures::WeightedEdges&,
+                                 const BallMeasures::WeightedFaces& wfaces )
+                           {
+                             const double area = mu0.faceMeasure( wfaces );
+                             H[ i ] = CNCComputer::meanCurvature
+                               ( area, mu1.faceMeasure( wfaces ) );
+                             G[ i ] = CNCComputer::GaussianCurvature
+                               ( area, mu2.faceMeasure( wfaces ) );
+                           } );
+      // Poles are singular vertices with many incident triangles.
+      unsigned int nb_ok = 0;
+      for ( SM::Vertex v = 0; v < sphere.nbVertices(); ++v )
+        {
+          nb_ok += ( H[ v ] == Approx( 1.0 ).epsilon( 0.05 ) ) ? 1 : 0;
+          nb_ok += ( G[ v ] == Approx( 1.0 ).epsilon( 0.05 ) ) ? 1 : 0;
+        }
+      REQUIRE( nb_ok == 2 * sphere.nbVertices() );
+    }
+    THEN( "A null radius gives the same degenerate values" ) {
+      auto mu0 = cnc.computeMu0();
+      auto m0  = balls.measuresAtFaces( mu0, 0.0 );
+      for ( SM::Face f = 0; f < sphere.nbFaces(); ++f )
+        REQUIRE( m0[ f ] == mu0.measure( sphere.faceCentroid( f ), 0.0, f ) );
+    }
+  }
+}
+
+/** @ingroup Tests **/
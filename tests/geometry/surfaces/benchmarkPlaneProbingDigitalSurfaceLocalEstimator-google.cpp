@@ -0,0 +1,168 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file benchmarkPlaneProbingDigitalSurfaceLocalEstimator-google.cpp
+ * @ingroup Tests
+ *
+ * @date 2026/10/18
+ *
+ * This file is part of the DGtal library
+ */
+
+/**
+ * Description of benchmarkPlaneProbingDigitalSurfaceLocalEstimator-google <p>
+ * Aim: throughput (surfels per second) of \ref PlaneProbingDigitalSurfaceLocalEstimator
+ * with the H, R and R1 probing algorithms, surfel by surfel or on a whole
+ * range of surfels (parallel if DGtal is built with OpenMP).
+ */
+
+#include <iostream>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include "DGtal/base/Common.h"
+#include "DGtal/helpers/StdDefs.h"
+#include "DGtal/helpers/Shortcuts.h"
+#include "DGtal/geometry/surfaces/DigitalSurfacePredicate.h"
+#include "DGtal/geometry/surfaces/estimation/PlaneProbingTetrahedronEstimator.h"
+#include "DGtal/geometry/surfaces/estimation/PlaneProbingDigitalSurfaceLocalEstimator.h"
+
+using namespace DGtal;
+using namespace std;
+
+using KSpace           = Z3i::KSpace;
+using SH3              = Shortcuts<KSpace>;
+using Surface          = SH3::DigitalSurface;
+using SurfacePredicate = DigitalSurfacePredicate<Surface>;
+
+// Context for each benchmark
+struct BenchPlaneProbing
+  : public benchmark::Fixture
+{
+  void SetUp(const ::benchmark::State&) override
+  {
+    if ( ! surfels.empty() ) return;
+    auto params = SH3::defaultParameters();
+    params( "polynomial", "goursat" )( "gridstep", 0.25 );
+    auto implicit_shape  = SH3::makeImplicitShape3D( params );
+    auto digitized_shape = SH3::makeDigitizedImplicitShape3D( implicit_shape, params );
+    auto binary_image    = SH3::makeBinaryImage( digitized_shape, params );
+    auto K               = SH3::getKSpace( params );
+    surface              = SH3::makeDigitalSurface( binary_image, K, params );
+    surfels              = SH3::getSurfelRange( surface );
+  }
+
+  template < ProbingMode mode >
+  void runSurfelBySurfel(benchmark::State& state)
+  {
+    using Estimator = PlaneProbingDigitalSurfaceLocalEstimator<Surface, PlaneProbingTetrahedronEstimator<SurfacePredicate, mode>>;
+    Estimator estimator(surface, factory<Estimator>());
+    estimator.init(1.0, surfels.begin(), surfels.end());
+    // Pre-estimations are computed once, only probing is measured.
+    for (auto it = surfels.begin(); it != surfels.end(); ++it)
+      estimator.getPreEstimation(it);
+
+    for (auto _ : state)
+      for (auto it = surfels.begin(); it != surfels.end(); ++it)
+        benchmark::DoNotOptimize(estimator.eval(it));
+
+    state.SetItemsProcessed(surfels.size() * state.iterations());
+  }
+
+  template < ProbingMode mode >
+  void runRange(benchmark::State& state)
+  {
+    using Estimator = PlaneProbingDigitalSurfaceLocalEstimator<Surface, PlaneProbingTetrahedronEstimator<SurfacePredicate, mode>>;
+    Estimator estimator(surface, factory<Estimator>());
+    estimator.init(1.0, surfels.begin(), surfels.end());
+    for (auto it = surfels.begin(); it != surfels.end(); ++it)
+      estimator.getPreEstimation(it);
+
+    std::vector<typename Estimator::Quantity> normals;
+    normals.reserve(surfels.size());
+    for (auto _ : state)
+      {
+        normals.clear();
+        estimator.eval(surfels.begin(), surfels.end(), std::back_inserter(normals));
+        benchmark::DoNotOptimize(normals.data());
+      }
+
+    state.SetItemsProcessed(surfels.size() * state.iterations());
+  }
+
+  template < typename Estimator >
+  static typename Estimator::ProbingFactory factory()
+  {
+    return [](const typename Estimator::ProbingFrame& frame, const SurfacePredicate& predicate) {
+      return new typename Estimator::InternalProbingAlgorithm(frame.p, { frame.b1, frame.b2, frame.normal }, predicate);
+    };
+  }
+
+  static CountedPtr<Surface> surface;
+  static SH3::SurfelRange surfels;
+};
+
+CountedPtr<Surface> BenchPlaneProbing::surface;
+SH3::SurfelRange BenchPlaneProbing::surfels;
+
+BENCHMARK_DEFINE_F(BenchPlaneProbing, HSurfelBySurfel)(benchmark::State& state)
+{
+  runSurfelBySurfel<ProbingMode::H>(state);
+}
+
+BENCHMARK_DEFINE_F(BenchPlaneProbing, HRange)(benchmark::State& state)
+{
+  runRange<ProbingMode::H>(state);
+}
+
+BENCHMARK_DEFINE_F(BenchPlaneProbing, RSurfelBySurfel)(benchmark::State& state)
+{
+  runSurfelBySurfel<ProbingMode::R>(state);
+}
+
+BENCHMARK_DEFINE_F(BenchPlaneProbing, RRange)(benchmark::State& state)
+{
+  runRange<ProbingMode::R>(state);
+}
+
+BENCHMARK_DEFINE_F(BenchPlaneProbing, R1SurfelBySurfel)(benchmark::State& state)
+{
+  runSurfelBySurfel<ProbingMode::R1>(state);
+}
+
+BENCHMARK_DEFINE_F(BenchPlaneProbing, R1Range)(benchmark::State& state)
+{
+  runRange<ProbingMode::R1>(state);
+}
+
+BENCHMARK_REGISTER_F(BenchPlaneProbing, HSurfelBySurfel)->Unit(benchmark::kMillisecond);
+BENCHMARK_REGISTER_F(BenchPlaneProbing, HRange)->Unit(benchmark::kMillisecond)->UseRealTime();
+BENCHMARK_REGISTER_F(BenchPlaneProbing, RSurfelBySurfel)->Unit(benchmark::kMillisecond);
+BENCHMARK_REGISTER_F(BenchPlaneProbing, RRange)->Unit(benchmark::kMillisecond)->UseRealTime();
+BENCHMARK_REGISTER_F(BenchPlaneProbing, R1SurfelBySurfel)->Unit(benchmark::kMillisecond);
+BENCHMARK_REGISTER_F(BenchPlaneProbing, R1Range)->Unit(benchmark::kMillisecond)->UseRealTime();
+
+int main(int argc, char* argv[])
+{
+  benchmark::Initialize(&argc, argv);
+  benchmark::RunSpecifiedBenchmarks();
+
+  return 0;
+}
+
+/** @ingroup Tests **/
@@ -132,6 +132,27 @@ TEST_CASE( "Testing DigitalSurfaceRegularization" )
                  normals, SH3::Colors(), "regularizedSurf-II.obj");
   }
   
+  SECTION("Float positions and iteration statistics")
+  {
+    auto surface         = SH3::makeDigitalSurface( digitized_shape, K, params );
+    DigitalSurfaceRegularization<SH3::DigitalSurface, float> regul(surface);
+    regul.init();
+    regul.attachConvolvedTrivialNormalVectors(params);
+    double energy = regul.computeGradient();
+    REQUIRE( energy == Approx(1684.340).epsilon(0.0001) );
+    auto finalenergy = regul.regularize();
+    REQUIRE( finalenergy == Approx( 4.7763 ).epsilon(0.001) );
+    REQUIRE( regul.isValid() );
+    
+    auto stats = regul.getIterationStatistics();
+    REQUIRE( stats.size() > 0 );
+    REQUIRE( stats.size() <= 200 );
+    REQUIRE( stats.front().energy == Approx( energy ) );
+    REQUIRE( stats.back().energy < stats.front().energy );
+    for ( const auto & s : stats )
+      REQUIRE( s.time >= 0.0 );
+  }
+  
   SECTION("Warm restart")
   {
     auto surface         = SH3::makeDigitalSurface( digitized_shape, K, params );
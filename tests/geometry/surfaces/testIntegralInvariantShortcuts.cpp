@@ -84,6 +84,39 @@ TEST_CASE( "Testing IntegralInvariant Shortcuts API" )
     for(std::size_t i = 0; i < G.size(); ++i)
      REQUIRE( Kcurv[i] == Approx( G[i] ) );
   }
+
+  SECTION("Testing that fused II quantities match the separate shortcuts")
+  {
+    auto Ncurv = SHG3::getIINormalVectors( binary_image, surfels, params );
+    auto Q     = SHG3::getIIGeometricQuantities
+      ( binary_image, surfels,
+        SHG3::II_NORMAL | SHG3::II_MEAN_CURVATURE | SHG3::II_GAUSSIAN_CURVATURE
+        | SHG3::II_PRINCIPAL_CURVATURES | SHG3::II_PRINCIPAL_DIRECTIONS, params );
+    REQUIRE( Q.normals.size()            == surfels.size() );
+    REQUIRE( Q.meanCurvatures.size()     == surfels.size() );
+    REQUIRE( Q.gaussianCurvatures.size() == surfels.size() );
+    for(std::size_t i = 0; i < surfels.size(); ++i)
+    {
+      REQUIRE( Q.normals[i].dot( Ncurv[i] ) == Approx( 1.0 ) );
+      REQUIRE( Q.gaussianCurvatures[i] == Approx( Kcurv[i] ) );
+      REQUIRE( Q.k1[i] == Approx( k1[i] ) );
+      REQUIRE( Q.k2[i] == Approx( k2[i] ) );
+      REQUIRE( Q.meanCurvatures[i] == Approx( 0.5 * ( k1[i] + k2[i] ) ) );
+      REQUIRE( std::abs( Q.d1[i].dot( std::get<2>( Tcurv[i] ) ) ) == Approx( 1.0 ) );
+      REQUIRE( std::abs( Q.d2[i].dot( std::get<3>( Tcurv[i] ) ) ) == Approx( 1.0 ) );
+    }
+  }
+
+  SECTION("Testing that only requested II quantities are computed")
+  {
+    auto Q = SHG3::getIIGeometricQuantities
+      ( binary_image, surfels, SHG3::II_GAUSSIAN_CURVATURE, params );
+    REQUIRE( Q.gaussianCurvatures.size() == surfels.size() );
+    REQUIRE( Q.normals.empty() );
+    REQUIRE( Q.meanCurvatures.empty() );
+    REQUIRE( Q.k1.empty() );
+    REQUIRE( Q.d1.empty() );
+  }
 }
 
 /** @ingroup Tests **/
@@ -0,0 +1,135 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file
+ * @ingroup Tests
+ *
+ * @date 2026/10/18
+ *
+ * Functions for testing class PlaneProbingDigitalSurfaceLocalEstimator.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include <vector>
+#include "DGtal/base/Common.h"
+#include "ConfigTest.h"
+#include "DGtalCatch.h"
+#include "DGtal/helpers/StdDefs.h"
+#include "DGtal/helpers/Shortcuts.h"
+#include "DGtal/geometry/surfaces/DigitalSurfacePredicate.h"
+#include "DGtal/geometry/surfaces/estimation/PlaneProbingTetrahedronEstimator.h"
+#include "DGtal/geometry/surfaces/estimation/PlaneProbingParallelepipedEstimator.h"
+#include "DGtal/geometry/surfaces/estimation/PlaneProbingDigitalSurfaceLocalEstimator.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+
+using KSpace           = Z3i::KSpace;
+using SH3              = Shortcuts<KSpace>;
+using Surface          = SH3::DigitalSurface;
+using SurfacePredicate = DigitalSurfacePredicate<Surface>;
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for testing class PlaneProbingDigitalSurfaceLocalEstimator.
+///////////////////////////////////////////////////////////////////////////////
+
+/**
+ * Checks that the estimation on a range of surfels, which reuses the
+ * probing algorithms, gives the same normals as the estimation surfel
+ * by surfel, which builds a new probing algorithm each time.
+ */
+template < typename Estimator >
+void checkRangeEvaluation (CountedPtr<Surface> surface,
+                           SH3::SurfelRange const& surfels,
+                           typename Estimator::ProbingFactory const& factory)
+{
+  Estimator rangeEstimator(surface, factory);
+  rangeEstimator.init(1.0, surfels.begin(), surfels.end());
+  std::vector<typename Estimator::Quantity> rangeNormals;
+  rangeEstimator.eval(surfels.begin(), surfels.end(), std::back_inserter(rangeNormals));
+  REQUIRE( rangeNormals.size() == surfels.size() );
+
+  Estimator surfelEstimator(surface, factory);
+  surfelEstimator.init(1.0, surfels.begin(), surfels.end());
+  unsigned int nbOk = 0;
+  for (auto it = surfels.begin(); it != surfels.end(); ++it)
+    {
+      auto const n = surfelEstimator.eval(it);
+      if (n == rangeNormals[ it - surfels.begin() ])
+        nbOk++;
+    }
+  REQUIRE( nbOk == surfels.size() );
+
+  // The pre-estimations computed during the range evaluation are cached.
+  for (auto it = surfels.begin(); it != surfels.end(); ++it)
+    REQUIRE( rangeEstimator.getPreEstimation(it) == surfelEstimator.getPreEstimation(it) );
+}
+
+TEST_CASE( "Testing PlaneProbingDigitalSurfaceLocalEstimator on a range of surfels" )
+{
+  auto params          = SH3::defaultParameters();
+  params( "polynomial", "goursat" )( "gridstep", 1. );
+  auto implicit_shape  = SH3::makeImplicitShape3D( params );
+  auto digitized_shape = SH3::makeDigitizedImplicitShape3D( implicit_shape, params );
+  auto binary_image    = SH3::makeBinaryImage( digitized_shape, params );
+  auto K               = SH3::getKSpace( params );
+  auto surface         = SH3::makeDigitalSurface( binary_image, K, params );
+  auto surfels         = SH3::getSurfelRange( surface );
+
+  SECTION( "H-algorithm" )
+    {
+      using Estimator = PlaneProbingDigitalSurfaceLocalEstimator<Surface, PlaneProbingTetrahedronEstimator<SurfacePredicate, ProbingMode::H>>;
+      checkRangeEvaluation<Estimator>(surface, surfels,
+        [](const Estimator::ProbingFrame& frame, const SurfacePredicate& predicate) {
+          return new Estimator::InternalProbingAlgorithm(frame.p, { frame.b1, frame.b2, frame.normal }, predicate);
+        });
+    }
+
+  SECTION( "R-algorithm" )
+    {
+      using Estimator = PlaneProbingDigitalSurfaceLocalEstimator<Surface, PlaneProbingTetrahedronEstimator<SurfacePredicate, ProbingMode::R>>;
+      checkRangeEvaluation<Estimator>(surface, surfels,
+        [](const Estimator::ProbingFrame& frame, const SurfacePredicate& predicate) {
+          return new Estimator::InternalProbingAlgorithm(frame.p, { frame.b1, frame.b2, frame.normal }, predicate);
+        });
+    }
+
+  SECTION( "R1-algorithm" )
+    {
+      using Estimator = PlaneProbingDigitalSurfaceLocalEstimator<Surface, PlaneProbingTetrahedronEstimator<SurfacePredicate, ProbingMode::R1>>;
+      checkRangeEvaluation<Estimator>(surface, surfels,
+        [](const Estimator::ProbingFrame& frame, const SurfacePredicate& predicate) {
+          return new Estimator::InternalProbingAlgorithm(frame.p, { frame.b1, frame.b2, frame.normal }, predicate);
+        });
+    }
+
+  SECTION( "Parallelepiped R1-algorithm" )
+    {
+      using Estimator = PlaneProbingDigitalSurfaceLocalEstimator<Surface, PlaneProbingParallelepipedEstimator<SurfacePredicate, ProbingMode::R1>>;
+      const Z3i::Integer bound = params[ "maxAABB" ].as<Z3i::Integer>();
+      checkRangeEvaluation<Estimator>(surface, surfels,
+        [bound](const Estimator::ProbingFrame& frame, const SurfacePredicate& predicate) {
+          return new Estimator::InternalProbingAlgorithm(frame.p, { frame.b1, frame.b2, frame.normal }, predicate, bound);
+        });
+    }
+}
+
+/** @ingroup Tests **/
@@ -80,6 +80,8 @@ TEST_CASE( "Testing ShroudsRegularization" )
   REQUIRE( loo < 0.1 );
   REQUIRE( l2 <= loo );
   REQUIRE( energyRegK2 < energyInitK2 );
+  REQUIRE( shrouds_reg.getIterationStatistics().size() > 0 );
+  REQUIRE( shrouds_reg.getIterationStatistics().back().loo == loo );
 
   {
     //! [ShroudsRegSaveObj]
@@ -112,3 +114,33 @@ TEST_CASE( "Testing ShroudsRegularization" )
 
   REQUIRE( energyRegSnk < energyInitSnk );
 }
+
+TEST_CASE( "Testing ShroudsRegularization with float positions and energy statistics" )
+{
+  typedef Shortcuts<Z3i::KSpace>         SH3;
+  typedef SH3::ExplicitSurfaceContainer  Container;
+  typedef ShroudsRegularization< Container, float > FloatShrouds;
+  typedef FloatShrouds::Regularization   RegType;
+  
+  auto params = SH3::defaultParameters();
+  params( "polynomial", "goursat" )( "gridstep", 1)("verbose", 0);
+  auto implicit_shape  = SH3::makeImplicitShape3D  ( params );
+  auto digitized_shape = SH3::makeDigitizedImplicitShape3D( implicit_shape, params );
+  auto K               = SH3::getKSpace( params );
+  auto surface         = SH3::makeDigitalSurface( digitized_shape, K, params );
+  auto idxsurface      = SH3::makeIdxDigitalSurface( surface, params );
+  FloatShrouds shrouds_reg( idxsurface );
+  shrouds_reg.setEnergyStatistics( true );
+  double energyInit   = shrouds_reg.energy( RegType::SQUARED_CURVATURE );
+  double loo = 0.0;
+  double  l2 = 0.0;
+  std::tie( loo, l2 ) = shrouds_reg.regularize( RegType::SQUARED_CURVATURE,
+						0.5, 0.0001, 20 );
+  auto stats = shrouds_reg.getIterationStatistics();
+  REQUIRE( stats.size() > 0 );
+  REQUIRE( stats.size() <= 20 );
+  REQUIRE( stats.back().loo == loo );
+  REQUIRE( stats.back().l2  == l2 );
+  REQUIRE( stats.back().energy == shrouds_reg.energy( RegType::SQUARED_CURVATURE ) );
+  REQUIRE( stats.back().energy < energyInit );
+}
@@ -233,3 +233,123 @@ SCENARIO( "QuickHull< ConvexHullIntegralKernel< 4 > > unit tests", "[quickhull][
     }
   }
 }
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for testing class QuickHull with filtered predicates.
+///////////////////////////////////////////////////////////////////////////////
+
+SCENARIO( "QuickHull< ConvexHullFilteredKernel > unit tests", "[quickhull][filtered_kernel]" )
+{
+  GIVEN( "Given 1000 random point in a 3D ball of radius 50 " ) {
+    typedef SpaceND< 3, int >                           Space;
+    typedef Space::Point                                Point;
+    typedef QuickHull< ConvexHullIntegralKernel< 3 > >  QHull;
+    typedef QuickHull< ConvexHullFilteredKernel< 3 > >  FQHull;
+    std::vector<Point> V = randomPointsInBall< Point >( 1000, 50 );
+    QHull  hull;
+    FQHull fhull;
+    hull.setInput( V, false );
+    hull.computeConvexHull();
+    fhull.setInput( V, false );
+    fhull.computeConvexHull();
+    THEN( "The convex hull is valid and is the same as with exact predicates" ) {
+      REQUIRE( fhull.check() );
+      REQUIRE( fhull.nbVertices() == hull.nbVertices() );
+      REQUIRE( fhull.nbFacets()   == hull.nbFacets() );
+    }
+  }
+  GIVEN( "Given all the points of a 4D cube of side 4 (many coplanar points)" ) {
+    typedef SpaceND< 4, int >                           Space;
+    typedef Space::Point                                Point;
+    typedef QuickHull< ConvexHullFilteredKernel< 4 > >  FQHull;
+    std::vector<Point> V;
+    for ( int x = 0; x < 4; ++x ) for ( int y = 0; y < 4; ++y )
+      for ( int z = 0; z < 4; ++z ) for ( int w = 0; w < 4; ++w )
+        V.push_back( Point( x, y, z, w ) );
+    FQHull fhull;
+    fhull.setInput( V, false );
+    fhull.computeConvexHull();
+    THEN( "The convex hull is valid and is the 4D cube" ) {
+      REQUIRE( fhull.check() );
+      REQUIRE( fhull.nbVertices() == 16 );
+      REQUIRE( fhull.nbFacets()   == 8 );
+    }
+  }
+#ifdef WITH_INT128
+  GIVEN( "Given 1000 random point of large coordinates in 3D" ) {
+    typedef ConvexHullIntegralKernel< 3, DGtal::int64_t, DGtal::int128_t > Kernel;
+    typedef ConvexHullFilteredKernel< 3, DGtal::int64_t, DGtal::int128_t > FKernel;
+    typedef Kernel::CoordinatePoint                                        Point;
+    std::vector<Point> V;
+    const DGtal::int64_t R = DGtal::int64_t( 1 ) << 30;
+    for ( int i = 0; i < 1000; ++i )
+      V.push_back( Point( ( DGtal::int64_t( rand() ) << 15 ) % R,
+                          ( DGtal::int64_t( rand() ) << 15 ) % R,
+                          ( DGtal::int64_t( rand() ) << 15 ) % R ) );
+    QuickHull< Kernel >  hull;
+    QuickHull< FKernel > fhull;
+    hull.setInput( V, false );
+    hull.computeConvexHull();
+    fhull.setInput( V, false );
+    fhull.computeConvexHull();
+    THEN( "The convex hull is valid and is the same as with exact predicates" ) {
+      REQUIRE( fhull.check() );
+      REQUIRE( fhull.nbVertices() == hull.nbVertices() );
+      REQUIRE( fhull.nbFacets()   == hull.nbFacets() );
+    }
+  }
+#endif
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for testing parallel QuickHull and filtering by chunks.
+///////////////////////////////////////////////////////////////////////////////
+
+SCENARIO( "QuickHull< ConvexHullIntegralKernel< 3 > > parallel computations", "[quickhull][parallel][3d]" )
+{
+  typedef ConvexHullIntegralKernel< 3 >    QHKernel;
+  typedef QuickHull< QHKernel >            QHull;
+  typedef SpaceND< 3, int >                Space;
+  typedef Space::Point                     Point;
+
+  GIVEN( "Given 20000 random point in a ball of radius 100 " ) {
+    std::vector<Point> V = randomPointsInBall< Point >( 20000, 100 );
+    QHull hull1;
+    hull1.nb_threads = 1;
+    hull1.setInput( V, false );
+    hull1.computeConvexHull();
+    QHull hull4;
+    hull4.nb_threads = 4;
+    hull4.setInput( V, false );
+    hull4.computeConvexHull();
+    QHull chull;
+    chull.setInput( V, false );
+    const auto nb_removed = chull.filterInputByChunks( 8 );
+    chull.computeConvexHull();
+    THEN( "The convex hulls are valid" ) {
+      REQUIRE( hull1.check() );
+      REQUIRE( hull4.check() );
+      REQUIRE( chull.check() );
+    }
+    THEN( "The convex hull does not depend on the number of threads" ) {
+      REQUIRE( hull4.nbVertices() == hull1.nbVertices() );
+      REQUIRE( hull4.nbFacets()   == hull1.nbFacets() );
+    }
+    THEN( "Filtering by chunks removes most points and gives the same hull" ) {
+      REQUIRE( nb_removed > 10000 );
+      REQUIRE( chull.nbPoints()   == V.size() - nb_removed );
+      REQUIRE( chull.nbVertices() == hull1.nbVertices() );
+      REQUIRE( chull.nbFacets()   == hull1.nbFacets() );
+      std::vector< Point > P1, Pc;
+      hull1.getVertexPositions( P1 );
+      chull.getVertexPositions( Pc );
+      std::sort( P1.begin(), P1.end() );
+      std::sort( Pc.begin(), Pc.end() );
+      REQUIRE( P1 == Pc );
+    }
+    THEN( "Timings of phases are recorded" ) {
+      REQUIRE( hull1.phase_timings.size() == QHull::NbTimingPhases );
+      REQUIRE( chull.phase_timings[ QHull::ChunkHulls ] > 0.0 );
+    }
+  }
+}
@@ -0,0 +1,120 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file benchmarkBoundedLatticePolytopeCounter-google.cpp
+ * @ingroup Tests
+ *
+ * @date 2026/10/18
+ *
+ * This file is part of the DGtal library
+ */
+
+/**
+ * Description of benchmarkBoundedLatticePolytopeCounter-google <p>
+ * Aim: cost of counting the lattice points of a 4D polytope (the
+ * convex hull of random points in a ball), row by row with
+ * independent rows or with the row sweep of
+ * BoundedLatticePolytopeCounter, and of countUpTo. The argument is
+ * the radius of the ball.
+ */
+
+#include <iostream>
+#include <vector>
+#include <random>
+
+#include <benchmark/benchmark.h>
+
+#include "DGtal/base/Common.h"
+#include "DGtal/kernel/SpaceND.h"
+#include "DGtal/geometry/volumes/ConvexityHelper.h"
+#include "DGtal/geometry/volumes/BoundedLatticePolytopeCounter.h"
+
+using namespace DGtal;
+using namespace std;
+
+typedef SpaceND< 4, DGtal::int64_t >            Space;
+typedef Space::Point                            Point;
+typedef BoundedLatticePolytope< Space >         Polytope;
+typedef BoundedLatticePolytopeCounter< Space >  Counter;
+
+/// @return the lattice polytope of 30 random points in a 4D ball of radius R.
+Polytope makePolytope( int R )
+{
+  std::mt19937 gen( 0 );
+  std::normal_distribution< double > N( 0.0, 1.0 );
+  std::vector< Point > points;
+  for ( unsigned int i = 0; i < 30; ++i )
+    {
+      double x[ 4 ], n = 0.0;
+      for ( auto& c : x ) { c = N( gen ); n += c * c; }
+      Point p;
+      for ( Dimension k = 0; k < 4; k++ )
+        p[ k ] = DGtal::int64_t( std::round( R * x[ k ] / std::sqrt( n ) ) );
+      points.push_back( p );
+    }
+  return ConvexityHelper< 4, DGtal::int64_t >::computeLatticePolytope( points );
+}
+
+static void BM_CountIndependentRows( benchmark::State& state )
+{
+  const Polytope P = makePolytope( int( state.range( 0 ) ) );
+  Counter C( P );
+  const Dimension a = C.longestAxis();
+  Point lo = C.lowerBound();
+  Point hi = C.upperBound();
+  hi[ a ]  = lo[ a ];
+  for ( auto _ : state )
+    {
+      DGtal::int64_t nb = 0;
+      for ( auto&& p : Polytope::Domain( lo, hi ) )
+        {
+          const auto I = C.intersectionIntervalAlongAxis( p, a );
+          nb += I.second - I.first;
+        }
+      benchmark::DoNotOptimize( nb );
+    }
+}
+
+static void BM_CountRowSweep( benchmark::State& state )
+{
+  const Polytope P = makePolytope( int( state.range( 0 ) ) );
+  Counter C( P );
+  for ( auto _ : state )
+    benchmark::DoNotOptimize( C.countAlongAxis( C.longestAxis() ) );
+}
+
+static void BM_CountUpTo( benchmark::State& state )
+{
+  const Polytope P = makePolytope( int( state.range( 0 ) ) );
+  Counter C( P );
+  for ( auto _ : state )
+    benchmark::DoNotOptimize( C.countUpToAlongAxis( 1000, C.longestAxis() ) );
+}
+
+BENCHMARK( BM_CountIndependentRows )->Arg( 20 )->Arg( 40 )->Unit( benchmark::kMillisecond );
+BENCHMARK( BM_CountRowSweep )->Arg( 20 )->Arg( 40 )->Unit( benchmark::kMillisecond );
+BENCHMARK( BM_CountUpTo )->Arg( 20 )->Arg( 40 )->Unit( benchmark::kMillisecond );
+
+int main(int argc, char* argv[])
+{
+  benchmark::Initialize(&argc, argv);
+  benchmark::RunSpecifiedBenchmarks();
+
+  return 0;
+}
+
+/** @ingroup Tests **/
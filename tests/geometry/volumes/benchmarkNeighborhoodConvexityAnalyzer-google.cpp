@@ -0,0 +1,89 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file benchmarkNeighborhoodConvexityAnalyzer-google.cpp
+ * @ingroup Tests
+ *
+ * @date 2026/10/18
+ *
+ * This file is part of the DGtal library
+ */
+
+/**
+ * Description of benchmarkNeighborhoodConvexityAnalyzer-google <p>
+ * Aim: throughput (points per second) of the 3x3x3
+ * NeighborhoodConvexityAnalyzer, when checking full convexity
+ * collapsibility at every point of a noisy ball.
+ * The arguments are the radius of the ball and the memoizer size.
+ */
+
+#include <iostream>
+#include <vector>
+#include <random>
+
+#include <benchmark/benchmark.h>
+
+#include "DGtal/base/Common.h"
+#include "DGtal/helpers/StdDefs.h"
+#include "DGtal/images/ImageContainerBySTLVector.h"
+#include "DGtal/geometry/volumes/NeighborhoodConvexityAnalyzer.h"
+
+using namespace DGtal;
+using namespace std;
+
+static void BM_FullyConvexCollapsible( benchmark::State& state )
+{
+  typedef Z3i::KSpace KSpace;
+  typedef Z3i::Point  Point;
+  typedef Z3i::Domain Domain;
+  const int R = int( state.range( 0 ) );
+  const Point lo = Point::diagonal( -R-2 );
+  const Point hi = Point::diagonal(  R+2 );
+  const Domain domain( lo, hi );
+  ImageContainerBySTLVector< Domain, bool > image( domain );
+  std::mt19937 gen( 0 );
+  for ( auto p : domain )
+    image.setValue( p, p.norm() < R - 2.0 + 4.0 * ( ( gen() % 1000 ) / 1000.0 ) );
+  std::vector< Point > points;
+  for ( auto p : Domain( lo + Point::diagonal( 1 ), hi - Point::diagonal( 1 ) ) )
+    points.push_back( p );
+  NeighborhoodConvexityAnalyzer< KSpace, 1 > nca( lo, hi, state.range( 1 ) );
+  for ( auto _ : state )
+    {
+      std::size_t nb = 0;
+      for ( auto p : points )
+        {
+          nca.setCenter( p, image );
+          nb += nca.isFullyConvexCollapsible() ? 1 : 0;
+        }
+      benchmark::DoNotOptimize( nb );
+    }
+  state.SetItemsProcessed( points.size() * state.iterations() );
+}
+
+BENCHMARK( BM_FullyConvexCollapsible )->Args( { 10, 0 } )->Args( { 10, 10000 } )
+  ->Args( { 20, 0 } )->Unit( benchmark::kMillisecond );
+
+int main(int argc, char* argv[])
+{
+  benchmark::Initialize(&argc, argv);
+  benchmark::RunSpecifiedBenchmarks();
+
+  return 0;
+}
+
+/** @ingroup Tests **/
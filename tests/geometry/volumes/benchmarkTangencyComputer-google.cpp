@@ -0,0 +1,113 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file benchmarkTangencyComputer-google.cpp
+ * @ingroup Tests
+ *
+ * @date 2026/10/18
+ *
+ * This file is part of the DGtal library
+ */
+
+/**
+ * Description of benchmarkTangencyComputer-google <p>
+ * Aim: cost of geodesic distances on the pointels of a digitized
+ * sphere with TangencyComputer, when cotangency is checked on the
+ * fly or read from the precomputed cotangency graph, and cost of
+ * computing this graph. The argument is the inverse of the gridstep.
+ */
+
+#include <iostream>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include "DGtal/base/Common.h"
+#include "DGtal/helpers/StdDefs.h"
+#include "DGtal/helpers/Shortcuts.h"
+#include "DGtal/geometry/volumes/TangencyComputer.h"
+
+using namespace DGtal;
+using namespace std;
+
+typedef Z3i::KSpace                  KSpace;
+typedef Shortcuts< KSpace >          SH3;
+typedef Z3i::Point                   Point;
+typedef TangencyComputer< KSpace >   Computer;
+
+/// @return the pointels of the unit sphere digitized at gridstep 1/n.
+std::vector< Point > spherePoints( int n, KSpace& K )
+{
+  auto params = SH3::defaultParameters();
+  params( "polynomial", "sphere1" )( "gridstep", 1.0 / n );
+  params( "minAABB", -2 )( "maxAABB", 2 )( "offset", 1.0 )( "closed", 1 );
+  auto implicit_shape  = SH3::makeImplicitShape3D( params );
+  auto digitized_shape = SH3::makeDigitizedImplicitShape3D( implicit_shape, params );
+  K = SH3::getKSpace( params );
+  auto binary_image = SH3::makeBinaryImage( digitized_shape,
+                                            SH3::Domain( K.lowerBound(), K.upperBound() ),
+                                            params );
+  auto surface = SH3::makeDigitalSurface( binary_image, K, params );
+  std::vector< Point > points;
+  for ( auto p : SH3::getPointelRange( surface ) )
+    points.push_back( K.uCoords( p ) );
+  return points;
+}
+
+/// Distances from 4 sources, with cotangency checked on the fly
+/// (graph = 0) or with the precomputed graph (graph = 1).
+static void BM_ShortestPaths( benchmark::State& state )
+{
+  KSpace K;
+  const auto points = spherePoints( int( state.range( 0 ) ), K );
+  Computer TC( K );
+  TC.init( points.cbegin(), points.cend() );
+  if ( state.range( 1 ) != 0 ) TC.computeCotangencyGraph();
+  std::vector< Computer::Index > sources;
+  for ( std::size_t i = 0; i < 4; i++ )
+    sources.push_back( i * points.size() / 4 );
+  for ( auto _ : state )
+    benchmark::DoNotOptimize( TC.computeShortestPaths( sources ) );
+  state.SetItemsProcessed( sources.size() * state.iterations() );
+}
+
+static void BM_CotangencyGraph( benchmark::State& state )
+{
+  KSpace K;
+  const auto points = spherePoints( int( state.range( 0 ) ), K );
+  Computer TC( K );
+  TC.init( points.cbegin(), points.cend() );
+  for ( auto _ : state )
+    {
+      TC.computeCotangencyGraph();
+      benchmark::DoNotOptimize( TC.cotangencyGraphTargets().size() );
+    }
+}
+
+BENCHMARK( BM_ShortestPaths )->Args( { 4, 0 } )->Args( { 4, 1 } )->Args( { 8, 1 } )
+  ->Unit( benchmark::kMillisecond );
+BENCHMARK( BM_CotangencyGraph )->Arg( 4 )->Arg( 8 )->Unit( benchmark::kMillisecond );
+
+int main(int argc, char* argv[])
+{
+  benchmark::Initialize(&argc, argv);
+  benchmark::RunSpecifiedBenchmarks();
+
+  return 0;
+}
+
+/** @ingroup Tests **/
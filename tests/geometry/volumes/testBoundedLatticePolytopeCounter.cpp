@@ -123,3 +123,66 @@ SCENARIO( "BoundedLatticePolytope< Z3 > unit tests", "[lattice_polytope][3d]" )
       }
   }
 }
+
+SCENARIO( "BoundedLatticePolytopeCounter< Z4 > row sweep tests", "[lattice_polytope][4d]" )
+{
+  typedef SpaceND<4,int>                   Space;
+  typedef Space::Point                     Point;
+  typedef BoundedLatticePolytope< Space >  Polytope;
+  typedef BoundedLatticePolytopeCounter< Space > Counter;
+
+  GIVEN( "A simplex P with enough rows to be processed in parallel" ) {
+    Polytope P { Point( 0, 0, 0, 0 ), Point( 40, 3, 0, 5 ), Point( 0, 35, -10, 2 ),
+                 Point( -6, 4, 38, 1 ), Point( 3, -5, 7, 30 ) };
+    int nbInside   = 0;
+    int nbInterior = 0;
+    for ( auto&& p : P.getDomain() )
+      {
+        nbInside   += P.isInside( p ) ? 1 : 0;
+        nbInterior += P.isInterior( p ) ? 1 : 0;
+      }
+    Counter C( P );
+    Counter C1( P );
+    C1.setNbThreads( 1 );
+    std::vector< Point > pts, pts1, int_pts;
+    C .getPointsAlongAxis( pts, 0 );
+    C1.getPointsAlongAxis( pts1, 0 );
+    C .getInteriorPointsAlongAxis( int_pts, 3 );
+    const auto flatL = C.getFlatLatticeSet( 2 );
+    const auto L     = C.getLatticeSet( 2 );
+    int nbFlat = 0;
+    for ( const auto& row : flatL ) nbFlat += row.second.second - row.second.first;
+    THEN( "Counts along all axes are the same as point by point" )
+      {
+        REQUIRE( nbInside > 10000 );
+        for ( Dimension a = 0; a < 4; a++ )
+          {
+            REQUIRE( C.countAlongAxis( a )  == nbInside );
+            REQUIRE( C1.countAlongAxis( a ) == nbInside );
+            REQUIRE( C.countInteriorAlongAxis( a ) == nbInterior );
+          }
+      }
+    THEN( "Enumerated points do not depend on the number of threads" )
+      {
+        REQUIRE( int( pts.size() ) == nbInside );
+        REQUIRE( pts == pts1 );
+        REQUIRE( int( int_pts.size() ) == nbInterior );
+      }
+    THEN( "Flat and map lattice sets have the same rows" )
+      {
+        REQUIRE( nbFlat == nbInside );
+        REQUIRE( flatL.size() == L.size() );
+        bool same = true;
+        for ( const auto& row : flatL )
+          same = same && ( L.at( row.first ) == row.second );
+        REQUIRE( same );
+      }
+    THEN( "countUpTo stops at its limit" )
+      {
+        REQUIRE( C.countUpToAlongAxis( 100, 1 ) == 100 );
+        REQUIRE( C1.countUpToAlongAxis( nbInside, 1 ) == nbInside );
+        REQUIRE( C.countUpToAlongAxis( nbInside + 1, 1 ) == nbInside );
+        REQUIRE( P.countUpTo( nbInside - 1 ) == nbInside - 1 );
+      }
+  }
+}
@@ -178,6 +178,29 @@ SCENARIO( "ConvexityHelper< 2 > unit tests",
 // Functions for testing class ConvexityHelper in 3D.
 ///////////////////////////////////////////////////////////////////////////////
 
+#ifdef WITH_INT128
+SCENARIO( "ConvexityHelper< 3, int64, int128 > unit tests (filtered predicates)",
+          "[convexity_helper][3d][filtered]" )
+{
+  typedef ConvexityHelper< 3, DGtal::int64_t, DGtal::int64_t >  Helper;
+  typedef ConvexityHelper< 3, DGtal::int64_t, DGtal::int128_t > WHelper;
+  typedef Helper::Point                                          Point;
+  GIVEN( "Given random points around (1000,1000,1000)" ) {
+    std::vector<Point> V;
+    for ( int i = 0; i < 100; ++i )
+      V.push_back( Point( 1000 + rand() % 20, 1000 + rand() % 20, 1000 + rand() % 20 ) );
+    WHEN( "Computing its lattice polytope with int64 and int128 internal integers" ){
+      const auto P = Helper::computeLatticePolytope( V );
+      const auto Q = WHelper::computeLatticePolytope( V );
+      THEN( "Both polytopes have the same facets and lattice points" ) {
+        REQUIRE( P.nbHalfSpaces() == Q.nbHalfSpaces() );
+        REQUIRE( P.count() == Q.count() );
+      }
+    }
+  }
+}
+#endif
+
 SCENARIO( "ConvexityHelper< 3 > unit tests",
           "[convexity_helper][3d]" )
 {
@@ -0,0 +1,192 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file testNeighborhoodConvexityAnalyzer.cpp
+ * @ingroup Tests
+ *
+ * @date 2026/10/18
+ *
+ * Functions for testing class NeighborhoodConvexityAnalyzer.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include <vector>
+#include <set>
+#include <random>
+#include "DGtal/base/Common.h"
+#include "DGtal/topology/KhalimskySpaceND.h"
+#include "DGtal/geometry/volumes/DigitalConvexity.h"
+#include "DGtal/geometry/volumes/NeighborhoodConvexityAnalyzer.h"
+#include "DGtalCatch.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for testing class NeighborhoodConvexityAnalyzer.
+///////////////////////////////////////////////////////////////////////////////
+
+/// Compares the local convexity properties computed by the analyzer
+/// with the ones computed by DigitalConvexity, on random digital
+/// half-spaces with some noise, around two points of the domain.
+///
+/// @return a pair (number of successful checks, number of checks)
+template < typename KSpace, int K >
+std::pair< unsigned int, unsigned int >
+checkAnalyzer( unsigned int nb, unsigned int seed )
+{
+  typedef NeighborhoodConvexityAnalyzer< KSpace, K > Analyzer;
+  typedef typename KSpace::Point Point;
+  typedef typename Analyzer::Domain Domain;
+  const Dimension d = KSpace::dimension;
+  const Point lo = Point::diagonal( -K-1 );
+  const Point hi = Point::diagonal(  K+1 );
+  Analyzer nca( lo, hi, 100 );
+  DigitalConvexity< KSpace > dconv( lo, hi );
+  std::mt19937 gen( seed );
+  unsigned int nb_ok = 0, nb_checks = 0;
+  for ( unsigned int n = 0; n < nb; n++ )
+    {
+      Point a;
+      for ( Dimension i = 0; i < d; i++ ) a[ i ] = int( gen() % 7 ) - 3;
+      const int b = int( gen() % 5 ) - 2;
+      std::set< Point > X;
+      for ( auto q : Domain( lo, hi ) )
+        if ( ( a.dot( q ) <= b ) != ( gen() % 8 == 0 ) ) X.insert( q );
+      auto inX = [&X] ( Point q ) { return X.count( q ) != 0; };
+      for ( auto c : { Point::zero, Point::base( 0 ) } )
+        for ( bool with_center : { false, true } )
+          for ( bool full : { false, true } )
+            for ( bool compX : { false, true } )
+              {
+                nca.setCenter( c, inX );
+                std::vector< Point > localX;
+                if ( compX ) nca.getLocalCompX( localX, with_center );
+                else         nca.getLocalX    ( localX, with_center );
+                const bool expected = full
+                  ? dconv.isFullyConvex( localX ) : dconv.is0Convex( localX );
+                const bool computed = full
+                  ? ( compX ? nca.isComplementaryFullyConvex( with_center )
+                      : nca.isFullyConvex( with_center ) )
+                  : ( compX ? nca.isComplementary0Convex( with_center )
+                      : nca.is0Convex( with_center ) );
+                nb_ok     += ( expected == computed ) ? 1 : 0;
+                nb_checks += 1;
+              }
+    }
+  return std::make_pair( nb_ok, nb_checks );
+}
+
+SCENARIO( "NeighborhoodConvexityAnalyzer local convexity tests",
+          "[neighborhood][full_convexity]" )
+{
+  GIVEN( "3x3x3 neighborhoods (checked with masks)" ) {
+    typedef KhalimskySpaceND< 3, int > KSpace;
+    REQUIRE( NeighborhoodConvexityAnalyzer< KSpace, 1 >::use_masks );
+    auto r = checkAnalyzer< KSpace, 1 >( 150, 0 );
+    THEN( "Local convexity is the same as with DigitalConvexity" ) {
+      REQUIRE( r.first == r.second );
+    }
+  }
+  GIVEN( "5x5 neighborhoods (checked with masks)" ) {
+    typedef KhalimskySpaceND< 2, int > KSpace;
+    REQUIRE( NeighborhoodConvexityAnalyzer< KSpace, 2 >::use_masks );
+    auto r = checkAnalyzer< KSpace, 2 >( 150, 1 );
+    THEN( "Local convexity is the same as with DigitalConvexity" ) {
+      REQUIRE( r.first == r.second );
+    }
+  }
+  GIVEN( "5x5x5 neighborhoods (checked with reused buffers)" ) {
+    typedef KhalimskySpaceND< 3, int > KSpace;
+    REQUIRE( ! NeighborhoodConvexityAnalyzer< KSpace, 2 >::use_masks );
+    auto r = checkAnalyzer< KSpace, 2 >( 15, 2 );
+    THEN( "Local convexity is the same as with DigitalConvexity" ) {
+      REQUIRE( r.first == r.second );
+    }
+  }
+}
+
+SCENARIO( "NeighborhoodConvexityAnalyzer fully convex masks",
+          "[neighborhood][full_convexity]" )
+{
+  typedef KhalimskySpaceND< 3, int >                 KSpace;
+  typedef KSpace::Point                              Point;
+  typedef NeighborhoodConvexityAnalyzer< KSpace, 1 > Analyzer;
+  DigitalConvexity< KSpace > dconv( Point::diagonal( 0 ), Point::diagonal( 3 ) );
+  // Random subsets of the 3x3x3 corner of the 4x4x4 grid.
+  std::mt19937 gen( 4 );
+  unsigned int nb_ok = 0, nb_fc = 0;
+  const unsigned int nb = 1000;
+  for ( unsigned int n = 0; n < nb; n++ )
+    {
+      const unsigned int density = 1 + n % 4;
+      DGtal::uint64_t mask = 0;
+      std::vector< Point > X;
+      for ( int b = 0; b < 27; b++ )
+        if ( gen() % 5 < density )
+          {
+            const Point p( b % 3, ( b / 3 ) % 3, b / 9 );
+            X.push_back( p );
+            mask |= DGtal::uint64_t( 1 ) << ( p[ 0 ] + 4 * p[ 1 ] + 16 * p[ 2 ] );
+          }
+      const bool fc = dconv.isFullyConvex( X );
+      nb_fc += fc ? 1 : 0;
+      nb_ok += ( fc == Analyzer::isMaskConvex( mask, true ) ) ? 1 : 0;
+      nb_ok += ( dconv.is0Convex( X ) == Analyzer::isMaskConvex( mask, false ) ) ? 1 : 0;
+    }
+  THEN( "Masks give the same convexity as DigitalConvexity" ) {
+    REQUIRE( nb_ok == 2 * nb );
+    REQUIRE( nb_fc > 0 );
+    REQUIRE( nb_fc < nb );
+  }
+}
+
+SCENARIO( "DigitalConvexity full convexity with workspace",
+          "[digital_convexity][full_convexity]" )
+{
+  typedef KhalimskySpaceND< 3, int > KSpace;
+  typedef KSpace::Point              Point;
+  DigitalConvexity< KSpace > dconv( Point::diagonal( -5 ), Point::diagonal( 5 ) );
+  std::mt19937 gen( 3 );
+  std::vector< std::vector< Point > > workspace;
+  std::vector< Point > Y;
+  unsigned int nb_ok = 0;
+  const unsigned int nb = 50;
+  for ( unsigned int n = 0; n < nb; n++ )
+    {
+      std::vector< Point > X;
+      for ( unsigned int i = 0; i < 10; i++ )
+        X.push_back( Point( int( gen() % 4 ), int( gen() % 4 ), int( gen() % 4 ) ) );
+      std::sort( X.begin(), X.end() );
+      X.erase( std::unique( X.begin(), X.end() ), X.end() );
+      const Dimension k = Dimension( n % 3 );
+      dconv.U( k, X, Y );
+      nb_ok += ( Y == dconv.U( k, X ) ) ? 1 : 0;
+      nb_ok += ( dconv.isFullyConvex( X, false, workspace )
+                 == dconv.isFullyConvex( X ) ) ? 1 : 0;
+    }
+  THEN( "It gives the same results as without workspace" ) {
+    REQUIRE( nb_ok == 2 * nb );
+  }
+}
+
+/** @ingroup Tests **/
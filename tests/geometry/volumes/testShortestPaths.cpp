@@ -132,3 +132,73 @@ SCENARIO( "TangencyComputer::ShortestPaths 3D tests", "[shortest_paths][3d][tang
     }
 }  
 
+SCENARIO( "TangencyComputer cotangency graph tests", "[shortest_paths][3d][tangency]" )
+{
+  typedef Z3i::Space          Space;
+  typedef Z3i::KSpace         KSpace;
+  typedef Shortcuts< KSpace > SH3;
+  typedef Space::Point        Point;
+  typedef std::size_t         Index;
+
+  // Make digital sphere
+  const double h = 0.25;
+  auto   params  = SH3::defaultParameters();
+  params( "polynomial", "sphere1" )( "gridstep",  h );
+  params( "minAABB", -2)( "maxAABB", 2)( "offset", 1.0 )( "closed", 1 );
+  auto implicit_shape  = SH3::makeImplicitShape3D  ( params );
+  auto digitized_shape = SH3::makeDigitizedImplicitShape3D( implicit_shape, params );
+  auto K            = SH3::getKSpace( params );
+  auto binary_image = SH3::makeBinaryImage(digitized_shape,
+                                           SH3::Domain(K.lowerBound(),K.upperBound()),
+                                           params );
+  auto surface = SH3::makeDigitalSurface( binary_image, K, params );
+  std::vector< Point > lattice_points;
+  for ( auto p : SH3::getPointelRange( surface ) )
+    lattice_points.push_back( K.uCoords( p ) );
+  const Index nb = lattice_points.size();
+  TangencyComputer< KSpace > TC( K );
+  TC.init( lattice_points.cbegin(), lattice_points.cend() );
+  const std::vector< Index > sources = { 0, nb / 3, 2 * nb / 3 };
+  auto SPs = TC.computeShortestPaths( sources );
+  REQUIRE( ! TC.hasCotangencyGraph() );
+  TC.setNbThreads( 1 );
+  TC.computeCotangencyGraph();
+  const auto offsets = TC.cotangencyGraphOffsets();
+  const auto targets = TC.cotangencyGraphTargets();
+  TC.setNbThreads( 0 );
+  TC.computeCotangencyGraph();
+  REQUIRE( TC.hasCotangencyGraph() );
+  THEN( "The graph does not depend on the number of threads" ) {
+    REQUIRE( offsets == TC.cotangencyGraphOffsets() );
+    REQUIRE( targets == TC.cotangencyGraphTargets() );
+  }
+  THEN( "Its rows are the cotangent points of each point" ) {
+    REQUIRE( offsets.size() == nb + 1 );
+    unsigned int nb_ok = 0;
+    for ( Index i = 0; i < nb; i++ )
+      {
+        const std::vector< Index > row( targets.cbegin() + offsets[ i ],
+                                        targets.cbegin() + offsets[ i+1 ] );
+        nb_ok += ( row == TC.getCotangentPoints( TC.point( i ) ) ) ? 1 : 0;
+      }
+    REQUIRE( nb_ok == nb );
+  }
+  THEN( "Shortest paths in the graph give the same distances" ) {
+    auto G_SPs = TC.computeShortestPaths( sources );
+    REQUIRE( G_SPs.size() == sources.size() );
+    unsigned int nb_ok = 0;
+    for ( Index s = 0; s < sources.size(); s++ )
+      for ( Index i = 0; i < nb; i++ )
+        nb_ok += ( std::abs( G_SPs[ s ].distance( i ) - SPs[ s ].distance( i ) )
+                   < 1e-10 ) ? 1 : 0;
+    REQUIRE( nb_ok == sources.size() * nb );
+    const auto path = G_SPs[ 0 ].pathToSource( sources[ 1 ] );
+    REQUIRE( path.front() == sources[ 1 ] );
+    REQUIRE( path.back()  == sources[ 0 ] );
+    REQUIRE( std::abs( TC.length( path ) - SPs[ 0 ].distance( sources[ 1 ] ) ) < 1e-10 );
+  }
+  THEN( "The graph is cleared when points change" ) {
+    TC.init( lattice_points.cbegin(), lattice_points.cend() );
+    REQUIRE( ! TC.hasCotangencyGraph() );
+  }
+}
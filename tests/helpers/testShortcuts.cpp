@@ -83,5 +83,60 @@ SCENARIO( "Shortcuts< K3 > pointel ordering", "[shortcuts][pointel]" )
   }
 }
 
+SCENARIO( "Shortcuts< K3 > binary image of implicit shapes", "[shortcuts][binary]" )
+{
+  typedef KhalimskySpaceND<3>                       KSpace;
+  typedef Shortcuts< KSpace >                       SH3;
+
+  auto params          = SH3::defaultParameters();
+  params( "polynomial", "goursat" )( "gridstep", 0.3 );
+  auto implicit_shape  = SH3::makeImplicitShape3D  ( params );
+  auto digitized_shape = SH3::makeDigitizedImplicitShape3D( implicit_shape, params );
+  auto binary_image    = SH3::makeBinaryImage      ( digitized_shape, params );
+
+  GIVEN( "A digitized implicit shape and its binary image" ) {
+    THEN( "The binary image, computed hierarchically, is the Gauss digitization of the shape" ) {
+      unsigned int nb_inside = 0, nb_ko = 0;
+      for ( auto p : binary_image->domain() )
+        {
+          nb_inside += (*digitized_shape)( p ) ? 1 : 0;
+          nb_ko     += binary_image->operator()( p ) != (*digitized_shape)( p ) ? 1 : 0;
+        }
+      REQUIRE( nb_inside > 0 );
+      REQUIRE( nb_ko == 0 );
+    }
+    THEN( "The surface extracted in a narrow band is the surface of the binary image" ) {
+      auto K           = SH3::getKSpace( params );
+      auto all_params  = params;
+      all_params( "surfaceComponents", "All" );
+      auto surface     = SH3::makeIdxDigitalSurface( binary_image, K, all_params );
+      auto nb_surface  = SH3::makeIdxDigitalSurface( digitized_shape, K, params );
+      REQUIRE( surface->nbVertices() > 0 );
+      REQUIRE( nb_surface->nbVertices() == surface->nbVertices() );
+      REQUIRE( nb_surface->nbArcs() == surface->nbArcs() );
+      REQUIRE( nb_surface->container().surfelSet() == surface->container().surfelSet() );
+    }
+    THEN( "The compiled polynomial gives the same values and gradients as the polynomial" ) {
+      auto poly = SH3::makeImplicitShape3D( params );
+      SH3::ScalarPolynomial P;
+      const std::string P_str = SH3::getPolynomialList()[ "goursat" ];
+      MPolynomialReader< 3, double > reader;
+      reader.read( P, P_str.begin(), P_str.end() );
+      const auto Px = derivative<0>( P );
+      double error = 0.0, grad_error = 0.0;
+      for ( double x = -1.0; x <= 1.0; x += 0.5 )
+        for ( double y = -1.0; y <= 1.0; y += 0.5 )
+          for ( double z = -1.0; z <= 1.0; z += 0.5 )
+            {
+              const SH3::RealPoint q( x, y, z );
+              error      = std::max( error, fabs( (*poly)( q ) - P( x )( y )( z ) ) );
+              grad_error = std::max( grad_error, fabs( poly->gradient( q )[ 0 ] - Px( x )( y )( z ) ) );
+            }
+      REQUIRE( error == Approx( 0.0 ).margin( 1e-10 ) );
+      REQUIRE( grad_error == Approx( 0.0 ).margin( 1e-10 ) );
+    }
+  }
+}
+
 //                                                                           //
 ///////////////////////////////////////////////////////////////////////////////
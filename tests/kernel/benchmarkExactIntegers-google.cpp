@@ -0,0 +1,137 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file benchmarkExactIntegers-google.cpp
+ * @ingroup Tests
+ *
+ * @date 2026/10/18
+ *
+ * This file is part of the DGtal library
+ */
+
+/**
+ * Description of benchmarkExactIntegers-google <p>
+ * Aim: cost of exact predicates with int64, int128, CheckedInteger
+ * and BigInteger, on DSS recognition and QuickHull lattice hulls
+ * (with exact or filtered predicates).
+ * The argument is the number of bits of the coordinates: int64 is
+ * only measured when its computations do not overflow.
+ */
+
+#include <iostream>
+#include <vector>
+#include <random>
+
+#include <benchmark/benchmark.h>
+
+#include "DGtal/base/Common.h"
+#include "DGtal/kernel/PointVector.h"
+#include "DGtal/kernel/CheckedInteger.h"
+#include "DGtal/geometry/curves/ArithmeticalDSS.h"
+#include "DGtal/geometry/tools/QuickHull.h"
+
+using namespace DGtal;
+using namespace std;
+
+/// Points of a standard digital straight segment of irrational-like
+/// slope, starting at abscissa 2^nb_bits.
+std::vector< PointVector< 2, DGtal::int64_t > > dssPoints( int nb_bits )
+{
+  const DGtal::int64_t a = 1000003, b = 1618033;
+  const DGtal::int64_t x0 = DGtal::int64_t( 1 ) << nb_bits;
+  std::vector< PointVector< 2, DGtal::int64_t > > points;
+  DGtal::int64_t x = x0, y = 0;
+  for ( unsigned int i = 0; i < 10000; ++i )
+    {
+      points.push_back( PointVector< 2, DGtal::int64_t >( x, y ) );
+      if ( a * ( x - x0 ) - b * y >= b - a ) ++y; else ++x;
+    }
+  return points;
+}
+
+template < typename Integer >
+void BM_DSSRecognition( benchmark::State& state )
+{
+  typedef PointVector< 2, Integer > Point;
+  const auto ipoints = dssPoints( int( state.range( 0 ) ) );
+  std::vector< Point > points;
+  for ( const auto& p : ipoints )
+    points.push_back( Point( Integer( p[ 0 ] ), Integer( p[ 1 ] ) ) );
+  for ( auto _ : state )
+    {
+      ArithmeticalDSS< Integer, Integer, 4 > dss( points[ 0 ] );
+      for ( std::size_t i = 1; i < points.size(); ++i )
+        dss.extendFront( points[ i ] );
+      benchmark::DoNotOptimize( dss );
+    }
+  state.SetItemsProcessed( points.size() * state.iterations() );
+}
+
+/// Random lattice points in a cube of side 2^nb_bits.
+std::vector< PointVector< 3, DGtal::int64_t > > hullPoints( int nb_bits )
+{
+  std::mt19937_64 gen( 0 );
+  const DGtal::uint64_t R = DGtal::uint64_t( 1 ) << nb_bits;
+  std::vector< PointVector< 3, DGtal::int64_t > > points;
+  for ( unsigned int i = 0; i < 10000; ++i )
+    points.push_back( PointVector< 3, DGtal::int64_t >( DGtal::int64_t( gen() % R ),
+                                                        DGtal::int64_t( gen() % R ),
+                                                        DGtal::int64_t( gen() % R ) ) );
+  return points;
+}
+
+template < typename InternalInteger,
+           template < Dimension, typename, typename > class TKernel = ConvexHullIntegralKernel >
+void BM_QuickHull( benchmark::State& state )
+{
+  typedef TKernel< 3, DGtal::int64_t, InternalInteger > Kernel;
+  const auto points = hullPoints( int( state.range( 0 ) ) );
+  for ( auto _ : state )
+    {
+      QuickHull< Kernel > hull;
+      hull.setInput( points, false );
+      hull.computeConvexHull();
+      benchmark::DoNotOptimize( hull.nbFacets() );
+    }
+  state.SetItemsProcessed( points.size() * state.iterations() );
+}
+
+// int64 does not overflow for DSS at 2^40 and hulls in a cube of side 2^12.
+BENCHMARK_TEMPLATE( BM_DSSRecognition, DGtal::int64_t )->Arg( 40 )->Unit( benchmark::kMicrosecond );
+BENCHMARK_TEMPLATE( BM_QuickHull, DGtal::int64_t )->Arg( 12 )->Unit( benchmark::kMillisecond );
+#ifdef WITH_INT128
+BENCHMARK_TEMPLATE( BM_DSSRecognition, DGtal::int128_t )->Arg( 40 )->Arg( 58 )->Unit( benchmark::kMicrosecond );
+BENCHMARK_TEMPLATE( BM_QuickHull, DGtal::int128_t )->Arg( 12 )->Arg( 24 )->Unit( benchmark::kMillisecond );
+BENCHMARK_TEMPLATE( BM_QuickHull, DGtal::int128_t, ConvexHullFilteredKernel )->Arg( 12 )->Arg( 24 )->Unit( benchmark::kMillisecond );
+#endif
+#ifdef WITH_BIGINTEGER
+BENCHMARK_TEMPLATE( BM_DSSRecognition, DGtal::CheckedInteger )->Arg( 40 )->Arg( 58 )->Unit( benchmark::kMicrosecond );
+BENCHMARK_TEMPLATE( BM_DSSRecognition, DGtal::BigInteger )->Arg( 40 )->Arg( 58 )->Unit( benchmark::kMicrosecond );
+BENCHMARK_TEMPLATE( BM_QuickHull, DGtal::CheckedInteger )->Arg( 12 )->Arg( 24 )->Unit( benchmark::kMillisecond );
+BENCHMARK_TEMPLATE( BM_QuickHull, DGtal::BigInteger )->Arg( 12 )->Arg( 24 )->Unit( benchmark::kMillisecond );
+BENCHMARK_TEMPLATE( BM_QuickHull, DGtal::BigInteger, ConvexHullFilteredKernel )->Arg( 12 )->Arg( 24 )->Unit( benchmark::kMillisecond );
+#endif
+
+int main(int argc, char* argv[])
+{
+  benchmark::Initialize(&argc, argv);
+  benchmark::RunSpecifiedBenchmarks();
+
+  return 0;
+}
+
+/** @ingroup Tests **/
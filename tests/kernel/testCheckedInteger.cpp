@@ -0,0 +1,239 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file testCheckedInteger.cpp
+ * @ingroup Tests
+ *
+ * @date 2026/10/18
+ *
+ * Functions for testing class CheckedInteger and 128-bit integers.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include <sstream>
+#include <vector>
+#include <random>
+#include "DGtal/base/Common.h"
+#include "DGtal/kernel/CInteger.h"
+#include "DGtal/kernel/CheckedInteger.h"
+#include "DGtal/arithmetic/IntegerComputer.h"
+#include "DGtal/geometry/curves/ArithmeticalDSS.h"
+#include "DGtal/geometry/tools/QuickHull.h"
+#include "DGtalCatch.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for testing class CheckedInteger.
+///////////////////////////////////////////////////////////////////////////////
+
+/// @return a random 64-bit integer with a random number of bits.
+DGtal::int64_t randomInt64( std::mt19937_64& gen )
+{
+  const int nb_bits = int( gen() % 64 );
+  const DGtal::int64_t v = DGtal::int64_t( gen() >> ( 64 - nb_bits ) );
+  return ( gen() % 2 ) ? -v : v;
+}
+
+/// Checks all the operations on the given values against BigInteger.
+/// @return the number of successful checks.
+unsigned int checkOperations( const CheckedInteger& a, const CheckedInteger& b )
+{
+  const BigInteger A = a.toBigInteger();
+  const BigInteger B = b.toBigInteger();
+  unsigned int nb_ok = 0;
+  nb_ok += ( ( a + b ).toBigInteger() == A + B ) ? 1 : 0;
+  nb_ok += ( ( a - b ).toBigInteger() == A - B ) ? 1 : 0;
+  nb_ok += ( ( a * b ).toBigInteger() == A * B ) ? 1 : 0;
+  nb_ok += ( ( -a ).toBigInteger() == -A ) ? 1 : 0;
+  nb_ok += ( ( a < b ) == ( A < B ) ) ? 1 : 0;
+  nb_ok += ( ( a == b ) == ( A == B ) ) ? 1 : 0;
+  if ( B != 0 )
+    {
+      nb_ok += ( ( a / b ).toBigInteger() == BigInteger( A / B ) ) ? 1 : 0;
+      nb_ok += ( ( a % b ).toBigInteger() == BigInteger( A % B ) ) ? 1 : 0;
+    }
+  else nb_ok += 2;
+  return nb_ok;
+}
+
+TEST_CASE( "Testing CheckedInteger" )
+{
+  BOOST_CONCEPT_ASSERT(( concepts::CInteger<CheckedInteger> ));
+
+  SECTION( "Escalation to BigInteger and back" )
+    {
+      CheckedInteger a = DGtal::int64_t( 1 ) << 62;
+      REQUIRE( ! a.isBig() );
+      CheckedInteger b = a * a;
+      REQUIRE( b.isBig() );
+      REQUIRE( b.toBigInteger() == BigInteger( "21267647932558653966460912964485513216" ) );
+      CheckedInteger c = b / a;
+      REQUIRE( ! c.isBig() );
+      REQUIRE( c == a );
+      CheckedInteger d = a + a;
+      REQUIRE( d.isBig() );
+      REQUIRE( d > a );
+      d -= a;
+      REQUIRE( ! d.isBig() );
+      CheckedInteger m = std::numeric_limits<DGtal::int64_t>::min();
+      REQUIRE( ( -m ).isBig() );
+      REQUIRE( ( m / -1 ).toBigInteger() == - m.toBigInteger() );
+      REQUIRE( ( m % -1 ) == 0 );
+      REQUIRE( ! ( ( m - 1 ) + 1 ).isBig() );
+      REQUIRE( ( ( m - 1 ) + 1 ) == m );
+      REQUIRE( ( m - 1 ) < m );
+      REQUIRE( ( -m ) > m );
+      REQUIRE( CheckedInteger( std::numeric_limits<DGtal::uint64_t>::max() ).isBig() );
+      std::ostringstream sout;
+      sout << b << " " << c;
+      REQUIRE( sout.str() == "21267647932558653966460912964485513216 4611686018427387904" );
+    }
+
+  SECTION( "Random operations against BigInteger" )
+    {
+      std::mt19937_64 gen( 0 );
+      unsigned int nb_ok = 0;
+      const unsigned int nb = 2000;
+      for ( unsigned int i = 0; i < nb; ++i )
+        {
+          CheckedInteger a = randomInt64( gen );
+          CheckedInteger b = randomInt64( gen );
+          if ( i % 3 == 0 ) a *= randomInt64( gen ); // may be big
+          nb_ok += checkOperations( a, b );
+        }
+      REQUIRE( nb_ok == 8 * nb );
+    }
+
+  SECTION( "IntegerComputer" )
+    {
+      IntegerComputer<CheckedInteger> ic;
+      CheckedInteger a = CheckedInteger( DGtal::int64_t( 3 ) << 61 ) * 35;
+      CheckedInteger b = CheckedInteger( DGtal::int64_t( 3 ) << 61 ) * 15;
+      REQUIRE( ic.gcd( a, b ) == CheckedInteger( DGtal::int64_t( 3 ) << 61 ) * 5 );
+      REQUIRE( ic.floorDiv( CheckedInteger( -7 ), CheckedInteger( 2 ) ) == -4 );
+      REQUIRE( ic.ceilDiv( CheckedInteger( -7 ), CheckedInteger( 2 ) ) == -3 );
+    }
+}
+
+#ifdef WITH_INT128
+TEST_CASE( "Testing 128-bit integers" )
+{
+  BOOST_CONCEPT_ASSERT(( concepts::CInteger<DGtal::int128_t> ));
+
+  SECTION( "Output and conversions" )
+    {
+      DGtal::int128_t a = DGtal::int128_t( 1 ) << 100;
+      std::ostringstream sout;
+      sout << a << " " << -a << " " << DGtal::int128_t( 0 );
+      REQUIRE( sout.str() == "1267650600228229401496703205376 -1267650600228229401496703205376 0" );
+      const BigInteger A = IntegerConverter< 1, BigInteger >::cast( -a + 7 );
+      REQUIRE( A == BigInteger( "-1267650600228229401496703205369" ) );
+      REQUIRE( IntegerConverter< 1, DGtal::int128_t >::cast( A ) == -a + 7 );
+      REQUIRE( CheckedInteger( -a + 7 ).toBigInteger() == A );
+    }
+
+  SECTION( "Greatest common divisor" )
+    {
+      std::mt19937_64 gen( 1 );
+      unsigned int nb_ok = 0;
+      const unsigned int nb = 1000;
+      IntegerComputer<DGtal::int128_t> ic;
+      IntegerComputer<BigInteger> bic;
+      for ( unsigned int i = 0; i < nb; ++i )
+        {
+          const DGtal::int128_t c = randomInt64( gen ) | 1;
+          const DGtal::int128_t a = DGtal::int128_t( randomInt64( gen ) ) * c;
+          const DGtal::int128_t b = DGtal::int128_t( randomInt64( gen ) ) * c;
+          const BigInteger G = bic.gcd( IntegerConverter< 1, BigInteger >::cast( a ),
+                                        IntegerConverter< 1, BigInteger >::cast( b ) );
+          nb_ok += ( IntegerConverter< 1, BigInteger >::cast( ic.gcd( a, b ) ) == G ) ? 1 : 0;
+        }
+      REQUIRE( nb_ok == nb );
+    }
+}
+#endif
+
+TEST_CASE( "Testing exact predicates with large coordinates" )
+{
+  SECTION( "DSS recognition" )
+    {
+      // The remainders a*x-b*y of these points do not fit in 64 bits.
+      const DGtal::int64_t a = 1000003, b = 1618033;
+      const DGtal::int64_t x0 = DGtal::int64_t( 1 ) << 58;
+      ArithmeticalDSS<BigInteger, BigInteger, 4>         bdss( PointVector<2, BigInteger>( x0, 0 ) );
+      ArithmeticalDSS<CheckedInteger, CheckedInteger, 4> cdss( PointVector<2, CheckedInteger>( x0, 0 ) );
+#ifdef WITH_INT128
+      ArithmeticalDSS<DGtal::int128_t, DGtal::int128_t, 4> idss( PointVector<2, DGtal::int128_t>( x0, 0 ) );
+#endif
+      DGtal::int64_t x = x0, y = 0;
+      for ( DGtal::int64_t i = 1; i < 5000; ++i )
+        {
+          // next point of the standard digital straight line a/b
+          if ( a * ( x - x0 ) - b * y >= b - a ) ++y; else ++x;
+          REQUIRE( bdss.extendFront( PointVector<2, BigInteger>( x, y ) ) );
+          REQUIRE( cdss.extendFront( PointVector<2, CheckedInteger>( x, y ) ) );
+#ifdef WITH_INT128
+          REQUIRE( idss.extendFront( PointVector<2, DGtal::int128_t>( x, y ) ) );
+#endif
+        }
+      REQUIRE( cdss.a().toBigInteger() == bdss.a() );
+      REQUIRE( cdss.b().toBigInteger() == bdss.b() );
+      REQUIRE( cdss.mu().toBigInteger() == bdss.mu() );
+      REQUIRE( cdss.mu().isBig() );
+#ifdef WITH_INT128
+      REQUIRE( IntegerConverter< 1, BigInteger >::cast( idss.mu() ) == bdss.mu() );
+#endif
+    }
+
+  SECTION( "QuickHull lattice hull" )
+    {
+      typedef ConvexHullIntegralKernel< 3, DGtal::int64_t, BigInteger >     BKernel;
+      typedef ConvexHullIntegralKernel< 3, DGtal::int64_t, CheckedInteger > CKernel;
+      typedef BKernel::CoordinatePoint Point;
+      std::mt19937_64 gen( 2 );
+      std::vector< Point > points;
+      const DGtal::int64_t R = DGtal::int64_t( 1 ) << 30;
+      for ( unsigned int i = 0; i < 200; ++i )
+        points.push_back( Point( DGtal::int64_t( gen() % R ), DGtal::int64_t( gen() % R ),
+                                 DGtal::int64_t( gen() % R ) ) );
+      QuickHull< BKernel > bhull;
+      bhull.setInput( points, false );
+      bhull.computeConvexHull();
+      QuickHull< CKernel > chull;
+      chull.setInput( points, false );
+      chull.computeConvexHull();
+      REQUIRE( chull.nbVertices() == bhull.nbVertices() );
+      REQUIRE( chull.nbFacets() == bhull.nbFacets() );
+      REQUIRE( chull.check() );
+#ifdef WITH_INT128
+      typedef ConvexHullIntegralKernel< 3, DGtal::int64_t, DGtal::int128_t > IKernel;
+      QuickHull< IKernel > ihull;
+      ihull.setInput( points, false );
+      ihull.computeConvexHull();
+      REQUIRE( ihull.nbVertices() == bhull.nbVertices() );
+      REQUIRE( ihull.nbFacets() == bhull.nbFacets() );
+#endif
+    }
+}
+
+/** @ingroup Tests **/
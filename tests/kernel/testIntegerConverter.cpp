@@ -151,3 +151,32 @@ SCENARIO( "IntegerConverter< 1, BigInteger >", "[integer_conversions]" )
   }
 }
 #endif
+
+#ifdef WITH_INT128
+SCENARIO( "IntegerConverter< 1, int128 >", "[integer_conversions]" )
+{
+  typedef IntegerConverter< 1, DGtal::int128_t > Converter;
+  DGtal::int64_t    big_int64  = 0x123456789ABCDEFL;
+  DGtal::int128_t   big_int128 = Converter::cast( big_int64 );
+  big_int128 *= big_int128;
+  WHEN( "Converting 128bits integers" ) {
+    DGtal::int64_t a = IntegerConverter< 1, DGtal::int64_t >::cast( big_int128 );
+    DGtal::int128_t b = Converter::cast( big_int64 ) * Converter::cast( big_int64 );
+    THEN( "The value is kept in 128 bits and lost in 64 bits" ) {
+      REQUIRE( b == big_int128 );
+      REQUIRE( DGtal::int128_t( a ) != big_int128 );
+    }
+  }
+#ifdef WITH_BIGINTEGER
+  WHEN( "Converting to and from big integers" ) {
+    DGtal::BigInteger big_bigint = 0x123456789ABCDEFL;
+    big_bigint *= big_bigint;
+    THEN( "Their values are identical" ) {
+      REQUIRE( IntegerConverter< 1, DGtal::BigInteger >::cast( big_int128 ) == big_bigint );
+      REQUIRE( IntegerConverter< 1, DGtal::BigInteger >::cast( -big_int128 ) == -big_bigint );
+      REQUIRE( Converter::cast( big_bigint ) == big_int128 );
+    }
+  }
+#endif
+}
+#endif
@@ -33,6 +33,7 @@
 #include <sstream>
 #include "DGtal/base/Common.h"
 #include "DGtal/math/MPolynomial.h"
+#include "DGtal/math/CompiledMPolynomial.h"
 #include "DGtal/io/readers/MPolynomialReader.h"
 ///////////////////////////////////////////////////////////////////////////////
 
@@ -106,6 +107,23 @@ bool testMPolynomialSpeed( double step = 0.01 )
   trace.info() << "Total1 = " << total1 << std::endl;
   trace.endBlock();
 
+  trace.beginBlock ( "Testing block ... Evaluation speed of compiled mpolynomials" );
+  CompiledMPolynomial<3, double> C( P );
+  double total3 = 0.0;
+  for ( double x = -1.0; x < 1.0; x += step )
+    {
+      for ( double y = -1.0; y < 1.0; y += step )
+        {
+          for ( double z = -1.0; z < 1.0; z += step )
+            {
+              const double pt[ 3 ] = { x, y, z };
+              total3 += C( pt );
+            }
+        }
+    }
+  trace.info() << "Total3 = " << total3 << std::endl;
+  trace.endBlock();
+
   trace.beginBlock ( "Testing block ... Same computation in C." );
   double total2 = 0.0;
   for ( double x = -1.0; x < 1.0; x += step )
@@ -126,6 +144,10 @@ bool testMPolynomialSpeed( double step = 0.01 )
   nb++;
   trace.info() << "(" << nbok << "/" << nb << ") "
                << "fabs( total2 - total ) < 1e-8" << std::endl;
+  nbok += fabs( total3 - total ) < 1e-8 ? 1 : 0; 
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "fabs( total3 - total ) < 1e-8" << std::endl;
 
   trace.info() << "For information, ImaGene::Polynomial3 takes 164ms for step=0.01 and 1604ms for step = 0.005." << std::endl;
   return nbok == nb;
@@ -185,6 +207,98 @@ bool testMPolynomial()
 }
 
 
+/**
+ * Compares compiled and usual evaluations of polynomials.
+ *
+ */
+bool testCompiledMPolynomial()
+{
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+
+  trace.beginBlock ( "Testing block ... CompiledMPolynomial" );
+  // x^4yz + xy^2 - 3z^3 + 2, with zero coefficients at each level.
+  MPolynomial<3, double> Q = mmonomial<double>( 4, 1, 1 )
+    + mmonomial<double>( 1, 2, 0 ) - 3.0 * mmonomial<double>( 0, 0, 3 )
+    + 2.0 * mmonomial<double>( 0, 0, 0 );
+  CompiledMPolynomial<3, double> C( Q );
+  trace.info() << C << std::endl;
+  nbok += C.isValid() ? 1 : 0;
+  nb++;
+  // the coefficients in z of 2 - 3z^3, y^2 and x^4yz.
+  nbok += C.size() == 7 ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "valid, with 7 coefficients" << std::endl;
+
+  double error = 0.0;
+  double row_error = 0.0;
+  std::vector<double> x0, values( 11 );
+  for ( int i = 0; i <= 10; ++i ) x0.push_back( -1.0 + 0.2 * i );
+  for ( double y = -1.0; y <= 1.0; y += 0.25 )
+    for ( double z = -1.0; z <= 1.0; z += 0.25 )
+      {
+        const double pt[ 3 ] = { 0.0, y, z };
+        C.evaluateRow( pt, x0.data(), x0.size(), values.data() );
+        for ( unsigned int i = 0; i < x0.size(); ++i )
+          {
+            const double pti[ 3 ] = { x0[ i ], y, z };
+            const double v = Q( x0[ i ] )( y )( z );
+            error = std::max( error, fabs( C( pti ) - v ) );
+            row_error = std::max( row_error, fabs( values[ i ] - v ) );
+          }
+      }
+  nbok += error < 1e-12 ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "evaluation error " << error << " < 1e-12" << std::endl;
+  nbok += row_error < 1e-12 ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "row evaluation error " << row_error << " < 1e-12" << std::endl;
+
+  // Interval bounds contain the values, and are exact for a constant box.
+  bool bounded = true;
+  const double lo[ 3 ] = { -0.5, 0.25, -1.0 };
+  const double up[ 3 ] = { 1.0, 0.75, -0.5 };
+  double fmin, fmax;
+  C.evaluateInterval( lo, up, fmin, fmax );
+  for ( double x = lo[ 0 ]; x <= up[ 0 ]; x += 0.125 )
+    for ( double y = lo[ 1 ]; y <= up[ 1 ]; y += 0.125 )
+      for ( double z = lo[ 2 ]; z <= up[ 2 ]; z += 0.125 )
+        {
+          const double pti[ 3 ] = { x, y, z };
+          bounded = bounded && fmin <= C( pti ) && C( pti ) <= fmax;
+        }
+  double gmin, gmax;
+  C.evaluateInterval( up, up, gmin, gmax );
+  nbok += ( bounded && gmin <= C( up ) && C( up ) <= gmax && gmax - gmin < 1e-12 ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "interval bounds [" << fmin << "," << fmax << "]" << std::endl;
+
+  // Zero, constant and univariate polynomials.
+  const double pt[ 3 ] = { 0.5, -2.0, 3.0 };
+  CompiledMPolynomial<3, double> Z;
+  CompiledMPolynomial<3, double> K( MPolynomial<3, double>( 7.0 ) );
+  nbok += ( Z.isValid() && Z( pt ) == 0.0 && K( pt ) == 7.0 ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "zero and constant polynomials" << std::endl;
+  MPolynomial<1, int> U = mmonomial<int>( 3 ) - 2 * mmonomial<int>( 1 );
+  CompiledMPolynomial<1, int> CU( U );
+  const int u[ 1 ] = { 3 };
+  int urow[ 2 ];
+  const int u0[ 2 ] = { 3, -1 };
+  CU.evaluateRow( u, u0, 2, urow );
+  nbok += ( CU( u ) == 21 && urow[ 0 ] == 21 && urow[ 1 ] == 1 ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "univariate polynomial" << std::endl;
+  trace.endBlock();
+  return nbok == nb;
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // Standard services - public :
 
@@ -193,6 +307,7 @@ int main( int /*argc*/, char** /*argv*/ )
   trace.beginBlock ( "Testing class MPolynomial" );
 
   bool res = testMPolynomial()
+    && testCompiledMPolynomial()
     && testMPolynomialSpeed( 0.05 );
   trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
   trace.endBlock();
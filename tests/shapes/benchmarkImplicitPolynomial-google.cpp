@@ -0,0 +1,260 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file benchmarkImplicitPolynomial-google.cpp
+ * @ingroup Tests
+ *
+ * @date 2026/10/18
+ *
+ * This file is part of the DGtal library
+ */
+
+/**
+ * Description of benchmarkImplicitPolynomial-google <p>
+ * Aim: cost of evaluating an implicit polynomial surface ("goursat")
+ * on all the points of a n x n x n grid of [-10,10]^3, with MPolynomial,
+ * CompiledMPolynomial (point by point or row by row), and of its
+ * digitization with Shortcuts::makeBinaryImage and
+ * HierarchicalGaussDigitizer (for several leaf sizes), and of the
+ * extraction of its whole boundary as an indexed digital surface,
+ * from the binary image or in a narrow band. The first argument is n.
+ */
+
+#include <iostream>
+#include <vector>
+#include <algorithm>
+
+#include <benchmark/benchmark.h>
+
+#include "DGtal/base/Common.h"
+#include "DGtal/helpers/StdDefs.h"
+#include "DGtal/helpers/Shortcuts.h"
+#include "DGtal/math/MPolynomial.h"
+#include "DGtal/math/CompiledMPolynomial.h"
+#include "DGtal/shapes/HierarchicalGaussDigitizer.h"
+
+using namespace DGtal;
+using namespace std;
+
+typedef Shortcuts< Z3i::KSpace > SH3;
+
+/// @return the parameters of the digitization of goursat in a n^3 grid.
+Parameters makeParameters( int n )
+{
+  auto params = SH3::defaultParameters();
+  params( "polynomial", "goursat" )( "minAABB", -10.0 )( "maxAABB", 10.0 )
+    ( "gridstep", 20.0 / n )( "offset", 0.0 );
+  return params;
+}
+
+/// @return the coordinates of a n x n x n grid of [-10,10]^3, as n values.
+std::vector< double > makeCoordinates( int n )
+{
+  std::vector< double > x( n );
+  for ( int i = 0; i < n; i++ ) x[ i ] = -10.0 + 20.0 * i / n;
+  return x;
+}
+
+static void BM_MPolynomial( benchmark::State& state )
+{
+  const int n = int( state.range( 0 ) );
+  const auto shape = SH3::makeImplicitShape3D( makeParameters( n ) );
+  const auto P = SH3::getPolynomialList()[ "goursat" ];
+  SH3::ScalarPolynomial poly;
+  MPolynomialReader< 3, double > reader;
+  reader.read( poly, P.begin(), P.end() );
+  const auto x = makeCoordinates( n );
+  for ( auto _ : state )
+    {
+      std::size_t nb_inside = 0;
+      for ( int k = 0; k < n; k++ )
+        for ( int j = 0; j < n; j++ )
+          for ( int i = 0; i < n; i++ )
+            nb_inside += poly( x[ i ] )( x[ j ] )( x[ k ] ) <= 0.0;
+      benchmark::DoNotOptimize( nb_inside );
+    }
+  state.SetItemsProcessed( state.iterations() * n * n * n );
+}
+
+static void BM_CompiledMPolynomial( benchmark::State& state )
+{
+  const int n = int( state.range( 0 ) );
+  const auto shape = SH3::makeImplicitShape3D( makeParameters( n ) );
+  const auto x = makeCoordinates( n );
+  for ( auto _ : state )
+    {
+      std::size_t nb_inside = 0;
+      for ( int k = 0; k < n; k++ )
+        for ( int j = 0; j < n; j++ )
+          for ( int i = 0; i < n; i++ )
+            nb_inside += (*shape)( Z3i::RealPoint( x[ i ], x[ j ], x[ k ] ) ) <= 0.0;
+      benchmark::DoNotOptimize( nb_inside );
+    }
+  state.SetItemsProcessed( state.iterations() * n * n * n );
+}
+
+static void BM_CompiledMPolynomialRows( benchmark::State& state )
+{
+  const int n = int( state.range( 0 ) );
+  const auto shape = SH3::makeImplicitShape3D( makeParameters( n ) );
+  const auto x = makeCoordinates( n );
+  std::vector< double > values( n );
+  for ( auto _ : state )
+    {
+      std::size_t nb_inside = 0;
+      for ( int k = 0; k < n; k++ )
+        for ( int j = 0; j < n; j++ )
+          {
+            shape->evaluateRow( Z3i::RealPoint( 0.0, x[ j ], x[ k ] ), x.data(), n, values.data() );
+            for ( int i = 0; i < n; i++ ) nb_inside += values[ i ] <= 0.0;
+          }
+      benchmark::DoNotOptimize( nb_inside );
+    }
+  state.SetItemsProcessed( state.iterations() * n * n * n );
+}
+
+static void BM_GaussDigitizer( benchmark::State& state )
+{
+  const auto params = makeParameters( int( state.range( 0 ) ) );
+  const auto shape  = SH3::makeImplicitShape3D( params );
+  const auto dshape = SH3::makeDigitizedImplicitShape3D( shape, params );
+  const auto domain = dshape->getDomain();
+  for ( auto _ : state )
+    {
+      // point by point digitization, as makeBinaryImage did before.
+      SH3::BinaryImage image( domain );
+      std::transform( domain.begin(), domain.end(), image.begin(),
+                      [&dshape] ( const Z3i::Point& p ) { return (*dshape)( p ); } );
+      benchmark::DoNotOptimize( image.begin() );
+    }
+  state.SetItemsProcessed( state.iterations() * domain.size() );
+}
+
+static void BM_RowDigitization( benchmark::State& state )
+{
+  const int n = int( state.range( 0 ) );
+  const auto params = makeParameters( n );
+  const auto shape  = SH3::makeImplicitShape3D( params );
+  const auto dshape = SH3::makeDigitizedImplicitShape3D( shape, params );
+  const auto domain = dshape->getDomain();
+  const auto lo     = domain.lowerBound();
+  const auto up     = domain.upperBound();
+  const std::size_t nx = up[ 0 ] - lo[ 0 ] + 1;
+  std::vector< double > x( nx ), values( nx );
+  for ( std::size_t i = 0; i < nx; i++ )
+    x[ i ] = dshape->embed( lo + Z3i::Point( int( i ), 0, 0 ) )[ 0 ];
+  for ( auto _ : state )
+    {
+      // row by row digitization, as makeBinaryImage did before.
+      SH3::BinaryImage image( domain );
+      auto it = image.begin();
+      for ( auto k = lo[ 2 ]; k <= up[ 2 ]; k++ )
+        for ( auto j = lo[ 1 ]; j <= up[ 1 ]; j++ )
+          {
+            shape->evaluateRow( dshape->embed( Z3i::Point( lo[ 0 ], j, k ) ),
+                                x.data(), nx, values.data() );
+            for ( std::size_t i = 0; i < nx; i++ ) *it++ = ! ( values[ i ] > 0.0 );
+          }
+      benchmark::DoNotOptimize( image.begin() );
+    }
+  state.SetItemsProcessed( state.iterations() * domain.size() );
+}
+
+static void BM_MakeBinaryImage( benchmark::State& state )
+{
+  const auto params = makeParameters( int( state.range( 0 ) ) );
+  const auto shape  = SH3::makeImplicitShape3D( params );
+  const auto dshape = SH3::makeDigitizedImplicitShape3D( shape, params );
+  for ( auto _ : state )
+    {
+      const auto image = SH3::makeBinaryImage( dshape, params );
+      benchmark::DoNotOptimize( image->begin() );
+    }
+  state.SetItemsProcessed( state.iterations() * dshape->getDomain().size() );
+}
+
+static void BM_HierarchicalGaussDigitizer( benchmark::State& state )
+{
+  const auto params = makeParameters( int( state.range( 0 ) ) );
+  const auto shape  = SH3::makeImplicitShape3D( params );
+  const auto dshape = SH3::makeDigitizedImplicitShape3D( shape, params );
+  const auto domain = dshape->getDomain();
+  HierarchicalGaussDigitizer< Z3i::Space, SH3::ImplicitShape3D >
+    digitizer( *dshape, SH3::Integer( state.range( 1 ) ) );
+  for ( auto _ : state )
+    {
+      SH3::BinaryImage image( domain );
+      digitizer.digitize( image );
+      benchmark::DoNotOptimize( image.begin() );
+    }
+  state.SetItemsProcessed( state.iterations() * domain.size() );
+  state.counters[ "evaluated" ] = double( digitizer.nbEvaluatedPoints() ) / domain.size();
+  state.counters[ "boxes" ] = double( digitizer.nbClassifiedBoxes() );
+}
+
+static void BM_IdxSurfaceFromBinaryImage( benchmark::State& state )
+{
+  auto params = makeParameters( int( state.range( 0 ) ) );
+  params( "surfaceComponents", "All" );
+  const auto shape  = SH3::makeImplicitShape3D( params );
+  const auto dshape = SH3::makeDigitizedImplicitShape3D( shape, params );
+  const auto K      = SH3::getKSpace( params );
+  std::size_t nb = 0;
+  for ( auto _ : state )
+    {
+      const auto image   = SH3::makeBinaryImage( dshape, params );
+      const auto surface = SH3::makeIdxDigitalSurface( image, K, params );
+      nb = surface->nbVertices();
+    }
+  state.counters[ "surfels" ] = double( nb );
+}
+
+static void BM_IdxSurfaceNarrowBand( benchmark::State& state )
+{
+  const auto params = makeParameters( int( state.range( 0 ) ) );
+  const auto shape  = SH3::makeImplicitShape3D( params );
+  const auto dshape = SH3::makeDigitizedImplicitShape3D( shape, params );
+  const auto K      = SH3::getKSpace( params );
+  std::size_t nb = 0;
+  for ( auto _ : state )
+    {
+      const auto surface = SH3::makeIdxDigitalSurface( dshape, K, params );
+      nb = surface->nbVertices();
+    }
+  state.counters[ "surfels" ] = double( nb );
+}
+
+BENCHMARK( BM_MPolynomial )->Arg( 64 )->Arg( 128 )->Unit( benchmark::kMillisecond );
+BENCHMARK( BM_CompiledMPolynomial )->Arg( 64 )->Arg( 128 )->Unit( benchmark::kMillisecond );
+BENCHMARK( BM_CompiledMPolynomialRows )->Arg( 64 )->Arg( 128 )->Unit( benchmark::kMillisecond );
+BENCHMARK( BM_GaussDigitizer )->Arg( 64 )->Arg( 128 )->Unit( benchmark::kMillisecond );
+BENCHMARK( BM_RowDigitization )->Arg( 128 )->Arg( 256 )->Arg( 512 )->Unit( benchmark::kMillisecond );
+BENCHMARK( BM_MakeBinaryImage )->Arg( 128 )->Arg( 256 )->Arg( 512 )->Unit( benchmark::kMillisecond );
+BENCHMARK( BM_HierarchicalGaussDigitizer )->Args( { 256, 4 } )->Args( { 256, 8 } )->Args( { 256, 16 } )
+->Unit( benchmark::kMillisecond );
+BENCHMARK( BM_IdxSurfaceFromBinaryImage )->Arg( 128 )->Arg( 256 )->Unit( benchmark::kMillisecond );
+BENCHMARK( BM_IdxSurfaceNarrowBand )->Arg( 128 )->Arg( 256 )->Unit( benchmark::kMillisecond );
+
+int main(int argc, char* argv[])
+{
+  benchmark::Initialize(&argc, argv);
+  benchmark::RunSpecifiedBenchmarks();
+
+  return 0;
+}
+
+/** @ingroup Tests **/
@@ -0,0 +1,102 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file benchmarkMeshVoxelizer-google.cpp
+ * @ingroup Tests
+ *
+ * @date 2026/10/18
+ *
+ * This file is part of the DGtal library
+ */
+
+/**
+ * Description of benchmarkMeshVoxelizer-google <p>
+ * Aim: throughput (triangles per second) of MeshVoxelizer on a
+ * triangulated sphere of 20000 triangles, with 6-separating, 26-separating
+ * and conservative voxelizations. The argument is the radius of the
+ * sphere in voxels.
+ */
+
+#include <iostream>
+#include <vector>
+#include <cmath>
+
+#include <benchmark/benchmark.h>
+
+#include "DGtal/base/Common.h"
+#include "DGtal/helpers/StdDefs.h"
+#include "DGtal/shapes/Mesh.h"
+#include "DGtal/shapes/MeshVoxelizer.h"
+
+using namespace DGtal;
+using namespace std;
+
+/// @return a triangulated unit sphere with 2*n*(n-1) triangles.
+Mesh< Z3i::RealPoint > makeSphere( int n )
+{
+  Mesh< Z3i::RealPoint > mesh;
+  const double pi = 3.14159265358979323846;
+  for ( int i = 0; i <= n; i++ )
+    for ( int j = 0; j < n; j++ )
+      {
+        const double theta = pi * i / n;
+        const double phi   = 2.0 * pi * j / n;
+        mesh.addVertex( Z3i::RealPoint( sin( theta ) * cos( phi ),
+                                        sin( theta ) * sin( phi ),
+                                        cos( theta ) ) );
+      }
+  for ( int i = 0; i < n; i++ )
+    for ( int j = 0; j < n; j++ )
+      {
+        const unsigned int a = i * n + j,       b = i * n + ( j + 1 ) % n;
+        const unsigned int c = ( i + 1 ) * n + j, d = ( i + 1 ) * n + ( j + 1 ) % n;
+        if ( i > 0 )     mesh.addTriangularFace( a, b, d );
+        if ( i < n - 1 ) mesh.addTriangularFace( a, d, c );
+      }
+  return mesh;
+}
+
+template < int Separation >
+static void BM_Voxelize( benchmark::State& state )
+{
+  const int  R = int( state.range( 0 ) );
+  const auto mesh = makeSphere( 100 );
+  const Z3i::Domain domain( Z3i::Point::diagonal( -R-1 ), Z3i::Point::diagonal( R+1 ) );
+  MeshVoxelizer< Z3i::DigitalSet, Separation > voxelizer;
+  voxelizer.setConservative( state.range( 1 ) != 0 );
+  for ( auto _ : state )
+    {
+      Z3i::DigitalSet voxels( domain );
+      voxelizer.voxelize( voxels, mesh, double( R ) );
+      benchmark::DoNotOptimize( voxels.size() );
+    }
+  state.SetItemsProcessed( mesh.nbFaces() * state.iterations() );
+}
+
+BENCHMARK_TEMPLATE( BM_Voxelize, 6  )->Args( { 50, 0 } )->Args( { 200, 0 } )->Unit( benchmark::kMillisecond );
+BENCHMARK_TEMPLATE( BM_Voxelize, 26 )->Args( { 50, 0 } )->Args( { 200, 0 } )->Unit( benchmark::kMillisecond );
+BENCHMARK_TEMPLATE( BM_Voxelize, 6  )->Args( { 50, 1 } )->Args( { 200, 1 } )->Unit( benchmark::kMillisecond );
+
+int main(int argc, char* argv[])
+{
+  benchmark::Initialize(&argc, argv);
+  benchmark::RunSpecifiedBenchmarks();
+
+  return 0;
+}
+
+/** @ingroup Tests **/
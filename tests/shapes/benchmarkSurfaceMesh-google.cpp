@@ -0,0 +1,265 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file benchmarkSurfaceMesh-google.cpp
+ * @ingroup Tests
+ *
+ * @date 2026/10/18
+ *
+ * This file is part of the DGtal library
+ */
+
+/**
+ * Description of benchmarkSurfaceMesh-google <p>
+ * Aim: throughput (surfels per second) of the conversion of a digital
+ * surface into its primal SurfaceMesh, with
+ * MeshHelpers::digitalSurface2PrimalSurfaceMesh (sorted vertex tables
+ * per slab of surfels) and with a numbering of the vertices through a
+ * std::map, the surface being the boundary of the digitization of
+ * "goursat" in a n x n x n grid. The argument is n.
+ *
+ * It also compares SurfaceMesh and PackedSurfaceMesh (relations
+ * stored in compressed sparse row format) on this surface, for their
+ * construction from positions and faces and for a traversal of
+ * their incidence and adjacency relations, and for reading the
+ * surface from an OBJ file held in memory (bytes per second).
+ */
+
+#include <iostream>
+#include <vector>
+#include <map>
+#include <sstream>
+
+#include <benchmark/benchmark.h>
+
+#include "DGtal/base/Common.h"
+#include "DGtal/helpers/StdDefs.h"
+#include "DGtal/helpers/Shortcuts.h"
+#include "DGtal/shapes/SurfaceMesh.h"
+#include "DGtal/shapes/PackedSurfaceMesh.h"
+#include "DGtal/shapes/MeshHelpers.h"
+#include "DGtal/io/readers/SurfaceMeshReader.h"
+#include "DGtal/io/writers/SurfaceMeshWriter.h"
+
+using namespace DGtal;
+using namespace std;
+
+typedef Shortcuts< Z3i::KSpace > SH3;
+
+/// @return the parameters of the digitization of goursat in a n^3 grid.
+Parameters makeParameters( int n )
+{
+  auto params = SH3::defaultParameters();
+  params( "polynomial", "goursat" )( "minAABB", -10.0 )( "maxAABB", 10.0 )
+    ( "gridstep", 20.0 / n )( "offset", 1.0 );
+  return params;
+}
+
+/// @return the boundary of the digitization of goursat, in the space \a K.
+CountedPtr< SH3::DigitalSurface > makeSurface( const SH3::KSpace & K, const Parameters & params )
+{
+  auto shape  = SH3::makeImplicitShape3D( params );
+  auto dshape = SH3::makeDigitizedImplicitShape3D( shape, params );
+  auto image  = SH3::makeBinaryImage( dshape, params );
+  return SH3::makeDigitalSurface( image, K, params );
+}
+
+static void BM_PrimalSurfaceMesh( benchmark::State& state )
+{
+  const auto params  = makeParameters( int( state.range( 0 ) ) );
+  const auto K       = SH3::getKSpace( params );
+  const auto surface = makeSurface( K, params );
+  CanonicCellEmbedder< SH3::KSpace > embedder( K );
+  for ( auto _ : state )
+    {
+      SH3::SurfaceMesh mesh;
+      SH3::Cell2Index c2i;
+      MeshHelpers::digitalSurface2PrimalSurfaceMesh( *surface, embedder, mesh, c2i );
+      benchmark::DoNotOptimize( mesh.nbEdges() );
+    }
+  state.SetItemsProcessed( surface->size() * state.iterations() );
+}
+
+static void BM_PrimalSurfaceMeshWithMap( benchmark::State& state )
+{
+  const auto params  = makeParameters( int( state.range( 0 ) ) );
+  const auto K       = SH3::getKSpace( params );
+  const auto surface = makeSurface( K, params );
+  CanonicCellEmbedder< SH3::KSpace > embedder( K );
+  for ( auto _ : state )
+    {
+      SH3::SurfaceMesh mesh;
+      SH3::Cell2Index c2i;
+      std::vector< SH3::RealPoint > positions;
+      std::vector< std::vector< SH3::SurfaceMesh::Vertex > > faces;
+      for ( auto&& s : *surface )
+        {
+          auto vtcs = Surfaces< SH3::KSpace >::getPrimalVertices( K, s, true );
+          for ( auto&& v : vtcs )
+            if ( ! c2i.count( v ) )
+              {
+                c2i[ v ] = positions.size();
+                positions.push_back( embedder( v ) );
+              }
+        }
+      for ( auto&& s : *surface )
+        {
+          auto vtcs = Surfaces< SH3::KSpace >::getPrimalVertices( K, s, true );
+          std::vector< SH3::SurfaceMesh::Vertex > face;
+          for ( auto&& v : vtcs ) face.push_back( c2i[ v ] );
+          faces.push_back( face );
+        }
+      mesh.init( positions.begin(), positions.end(), faces.begin(), faces.end() );
+      benchmark::DoNotOptimize( mesh.nbEdges() );
+    }
+  state.SetItemsProcessed( surface->size() * state.iterations() );
+}
+
+typedef PackedSurfaceMesh< SH3::RealPoint, SH3::RealVector > PackedMesh;
+
+/// @return the primal surface mesh of the boundary of goursat in a n^3 grid.
+SH3::SurfaceMesh makeMesh( int n )
+{
+  const auto params  = makeParameters( n );
+  const auto K       = SH3::getKSpace( params );
+  const auto surface = makeSurface( K, params );
+  CanonicCellEmbedder< SH3::KSpace > embedder( K );
+  SH3::SurfaceMesh mesh;
+  SH3::Cell2Index c2i;
+  MeshHelpers::digitalSurface2PrimalSurfaceMesh( *surface, embedder, mesh, c2i );
+  return mesh;
+}
+
+/// Visits, for each face, its vertices and neighbor faces, and for
+/// each vertex, its incident faces and neighbor vertices.
+/// @return a checksum of the visited indices.
+template < typename Mesh >
+std::size_t traverse( const Mesh& mesh )
+{
+  std::size_t sum = 0;
+  for ( std::size_t f = 0; f < mesh.nbFaces(); ++f )
+    {
+      for ( auto v  : mesh.incidentVertices( f ) ) sum += v;
+      for ( auto nf : mesh.neighborFaces( f ) )    sum += nf;
+    }
+  for ( std::size_t v = 0; v < mesh.nbVertices(); ++v )
+    {
+      for ( auto f  : mesh.incidentFaces( v ) )    sum += f;
+      for ( auto nv : mesh.neighborVertices( v ) ) sum += nv;
+    }
+  for ( std::size_t e = 0; e < mesh.nbEdges(); ++e )
+    for ( auto f : mesh.edgeFaces( e ) ) sum += f;
+  return sum;
+}
+
+static void BM_SurfaceMeshInit( benchmark::State& state )
+{
+  const auto mesh = makeMesh( int( state.range( 0 ) ) );
+  for ( auto _ : state )
+    {
+      SH3::SurfaceMesh copy( mesh.positions().cbegin(), mesh.positions().cend(),
+                             mesh.allIncidentVertices().cbegin(),
+                             mesh.allIncidentVertices().cend() );
+      benchmark::DoNotOptimize( copy.nbEdges() );
+    }
+  state.SetItemsProcessed( mesh.nbFaces() * state.iterations() );
+}
+
+static void BM_PackedSurfaceMeshInit( benchmark::State& state )
+{
+  const auto mesh = makeMesh( int( state.range( 0 ) ) );
+  for ( auto _ : state )
+    {
+      PackedMesh packed;
+      packed.init( mesh.positions().cbegin(), mesh.positions().cend(),
+                   mesh.allIncidentVertices().cbegin(),
+                   mesh.allIncidentVertices().cend() );
+      benchmark::DoNotOptimize( packed.nbEdges() );
+    }
+  state.SetItemsProcessed( mesh.nbFaces() * state.iterations() );
+}
+
+static void BM_SurfaceMeshTraversal( benchmark::State& state )
+{
+  const auto mesh = makeMesh( int( state.range( 0 ) ) );
+  for ( auto _ : state )
+    benchmark::DoNotOptimize( traverse( mesh ) );
+  state.SetItemsProcessed( mesh.nbFaces() * state.iterations() );
+}
+
+static void BM_PackedSurfaceMeshTraversal( benchmark::State& state )
+{
+  const PackedMesh mesh( makeMesh( int( state.range( 0 ) ) ) );
+  for ( auto _ : state )
+    benchmark::DoNotOptimize( traverse( mesh ) );
+  state.SetItemsProcessed( mesh.nbFaces() * state.iterations() );
+}
+
+/// @return the primal surface mesh of goursat in a n^3 grid as an OBJ file.
+std::string makeOBJ( int n )
+{
+  std::ostringstream output;
+  SurfaceMeshWriter< SH3::RealPoint, SH3::RealVector >::writeOBJ( output, makeMesh( n ) );
+  return output.str();
+}
+
+template < typename Mesh >
+void readOBJ( benchmark::State& state )
+{
+  const auto file = makeOBJ( int( state.range( 0 ) ) );
+  // Silences the messages of the reader, written by trace on std::cerr.
+  auto buffer = std::cerr.rdbuf( nullptr );
+  for ( auto _ : state )
+    {
+      std::istringstream input( file );
+      Mesh mesh;
+      SurfaceMeshReader< SH3::RealPoint, SH3::RealVector >::readOBJ( input, mesh );
+      benchmark::DoNotOptimize( mesh.nbEdges() );
+    }
+  std::cerr.rdbuf( buffer );
+  std::cerr.clear();
+  state.SetBytesProcessed( file.size() * state.iterations() );
+}
+
+static void BM_SurfaceMeshReadOBJ( benchmark::State& state )
+{
+  readOBJ< SH3::SurfaceMesh >( state );
+}
+
+static void BM_PackedSurfaceMeshReadOBJ( benchmark::State& state )
+{
+  readOBJ< PackedMesh >( state );
+}
+
+BENCHMARK( BM_PrimalSurfaceMesh )->Arg( 64 )->Arg( 128 )->Arg( 256 )->Unit( benchmark::kMillisecond );
+BENCHMARK( BM_PrimalSurfaceMeshWithMap )->Arg( 64 )->Arg( 128 )->Arg( 256 )->Unit( benchmark::kMillisecond );
+BENCHMARK( BM_SurfaceMeshInit )->Arg( 64 )->Arg( 128 )->Arg( 256 )->Unit( benchmark::kMillisecond );
+BENCHMARK( BM_PackedSurfaceMeshInit )->Arg( 64 )->Arg( 128 )->Arg( 256 )->Unit( benchmark::kMillisecond );
+BENCHMARK( BM_SurfaceMeshTraversal )->Arg( 64 )->Arg( 128 )->Arg( 256 )->Unit( benchmark::kMillisecond );
+BENCHMARK( BM_PackedSurfaceMeshTraversal )->Arg( 64 )->Arg( 128 )->Arg( 256 )->Unit( benchmark::kMillisecond );
+BENCHMARK( BM_SurfaceMeshReadOBJ )->Arg( 64 )->Arg( 128 )->Arg( 256 )->Unit( benchmark::kMillisecond );
+BENCHMARK( BM_PackedSurfaceMeshReadOBJ )->Arg( 64 )->Arg( 128 )->Arg( 256 )->Unit( benchmark::kMillisecond );
+
+int main(int argc, char* argv[])
+{
+  benchmark::Initialize(&argc, argv);
+  benchmark::RunSpecifiedBenchmarks();
+
+  return 0;
+}
+
+/** @ingroup Tests **/
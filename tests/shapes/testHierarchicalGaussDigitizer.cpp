@@ -0,0 +1,178 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file testHierarchicalGaussDigitizer.cpp
+ * @ingroup Tests
+ *
+ * @date 2026/10/18
+ *
+ * Functions for testing class HierarchicalGaussDigitizer.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include <string>
+#include "DGtal/base/Common.h"
+#include "ConfigTest.h"
+#include "DGtalCatch.h"
+#include "DGtal/helpers/StdDefs.h"
+#include "DGtal/math/MPolynomial.h"
+#include "DGtal/io/readers/MPolynomialReader.h"
+#include "DGtal/shapes/implicit/ImplicitBall.h"
+#include "DGtal/shapes/implicit/ImplicitPolynomial3Shape.h"
+#include "DGtal/shapes/GaussDigitizer.h"
+#include "DGtal/shapes/HierarchicalGaussDigitizer.h"
+#include "DGtal/images/ImageContainerBySTLVector.h"
+#include "DGtal/topology/helpers/Surfaces.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for testing class HierarchicalGaussDigitizer.
+///////////////////////////////////////////////////////////////////////////////
+
+/// @return the number of points where the image differs from the Gauss digitization.
+template < typename Digitizer, typename Image >
+std::size_t nbDifferences( const Digitizer& dig, const Image& image )
+{
+  std::size_t nb = 0;
+  for ( auto p : image.domain() )
+    nb += ( image( p ) != dig( p ) ) ? 1 : 0;
+  return nb;
+}
+
+TEST_CASE( "Testing HierarchicalGaussDigitizer" )
+{
+  SECTION( "Implicit ball in 2D" )
+    {
+      typedef ImplicitBall< Z2i::Space > Ball;
+      Ball ball( Z2i::RealPoint( 0.3, -0.1 ), 7.4 );
+      GaussDigitizer< Z2i::Space, Ball > dig;
+      dig.attach( ball );
+      dig.init( Z2i::RealPoint( -10.0, -10.0 ), Z2i::RealPoint( 10.0, 10.0 ), 0.25 );
+      ImageContainerBySTLVector< Z2i::Domain, bool > image( dig.getDomain() );
+      HierarchicalGaussDigitizer< Z2i::Space, Ball > hdig( dig, 4 );
+      hdig.digitize( image );
+      REQUIRE( hdig.isValid() );
+      REQUIRE( nbDifferences( dig, image ) == 0 );
+      REQUIRE( hdig.nbEvaluatedPoints() < dig.getDomain().size() / 4 );
+    }
+
+  SECTION( "Implicit ball in 3D, with a domain not containing the ball" )
+    {
+      typedef ImplicitBall< Z3i::Space > Ball;
+      Ball ball( Z3i::RealPoint( 0.0, 1.0, 0.5 ), 5.0 );
+      GaussDigitizer< Z3i::Space, Ball > dig;
+      dig.attach( ball );
+      dig.init( ball.getLowerBound(), ball.getUpperBound(), 0.2 );
+      const Z3i::Domain domain( Z3i::Point( -13, -17, 0 ), Z3i::Point( 31, 9, 40 ) );
+      ImageContainerBySTLVector< Z3i::Domain, unsigned char > image( domain );
+      HierarchicalGaussDigitizer< Z3i::Space, Ball > hdig( dig );
+      hdig.digitize( image );
+      REQUIRE( nbDifferences( dig, image ) == 0 );
+      REQUIRE( hdig.nbEvaluatedPoints() < domain.size() / 2 );
+    }
+
+  SECTION( "Implicit polynomial surfaces" )
+    {
+      typedef ImplicitPolynomial3Shape< Z3i::Space > Shape;
+      const std::string polynomials[] = {
+        "x^4-5*x^2+y^4-5*y^2+z^4-5*z^2+11.8",    // goursat
+        "x^2+y^2+z^2-6",                         // sphere
+        "(x^2+y^2+z^2+6-2)^2-4*6*(x^2+y^2)",     // torus
+        "x^2+y^2-z^2*(1-z)^2-0.5" };             // non closed
+      for ( const auto& str : polynomials )
+        {
+          Shape::Polynomial3 P;
+          MPolynomialReader< 3, double > reader;
+          REQUIRE( reader.read( P, str.begin(), str.end() ) == str.end() );
+          Shape shape( P );
+          GaussDigitizer< Z3i::Space, Shape > dig;
+          dig.attach( shape );
+          dig.init( Z3i::RealPoint::diagonal( -5.0 ), Z3i::RealPoint::diagonal( 5.0 ), 0.25 );
+          ImageContainerBySTLVector< Z3i::Domain, bool > image( dig.getDomain() );
+          HierarchicalGaussDigitizer< Z3i::Space, Shape > hdig( dig );
+          hdig.digitize( image );
+          CAPTURE( str );
+          CAPTURE( hdig );
+          REQUIRE( nbDifferences( dig, image ) == 0 );
+          REQUIRE( hdig.nbEvaluatedPoints() < dig.getDomain().size() );
+        }
+    }
+
+  SECTION( "Boundary surfels of an implicit ball in 2D" )
+    {
+      typedef ImplicitBall< Z2i::Space > Ball;
+      Ball ball( Z2i::RealPoint( 0.3, -0.1 ), 7.4 );
+      GaussDigitizer< Z2i::Space, Ball > dig;
+      dig.attach( ball );
+      dig.init( Z2i::RealPoint( -10.0, -10.0 ), Z2i::RealPoint( 10.0, 10.0 ), 0.25 );
+      Z2i::KSpace K;
+      K.init( dig.getLowerBound(), dig.getUpperBound(), true );
+      Z2i::KSpace::SurfelSet expected, surfels;
+      Surfaces< Z2i::KSpace >::sMakeBoundary( expected, K, dig, K.lowerBound(), K.upperBound() );
+      HierarchicalGaussDigitizer< Z2i::Space, Ball > hdig( dig, 4 );
+      hdig.sMakeBoundary( surfels, K, K.lowerBound(), K.upperBound() );
+      REQUIRE( ! expected.empty() );
+      REQUIRE( surfels == expected );
+    }
+
+  SECTION( "Boundary surfels of a multi-component implicit surface" )
+    {
+      typedef ImplicitPolynomial3Shape< Z3i::Space > Shape;
+      // two spheres, in bounds cutting one of them.
+      const std::string str = "((x-2.5)^2+y^2+z^2-2)*((x+2.5)^2+y^2+z^2-1.5)";
+      Shape::Polynomial3 P;
+      MPolynomialReader< 3, double > reader;
+      REQUIRE( reader.read( P, str.begin(), str.end() ) == str.end() );
+      Shape shape( P );
+      GaussDigitizer< Z3i::Space, Shape > dig;
+      dig.attach( shape );
+      dig.init( Z3i::RealPoint( -5.0, -3.0, -3.0 ), Z3i::RealPoint( 5.0, 3.0, 3.0 ), 0.1 );
+      Z3i::KSpace K;
+      K.init( dig.getLowerBound(), dig.getUpperBound(), true );
+      const Z3i::Point lower = K.lowerBound();
+      const Z3i::Point upper = K.upperBound() - Z3i::Point( 0, 0, 16 );
+      Z3i::KSpace::SurfelSet expected, surfels;
+      Surfaces< Z3i::KSpace >::sMakeBoundary( expected, K, dig, lower, upper );
+      HierarchicalGaussDigitizer< Z3i::Space, Shape > hdig( dig, 4 );
+      hdig.sMakeBoundary( surfels, K, lower, upper );
+      CAPTURE( hdig );
+      REQUIRE( expected.size() > 1000 );
+      REQUIRE( surfels == expected );
+      REQUIRE( hdig.nbEvaluatedPoints() < Z3i::Domain( lower, upper ).size() / 4 );
+    }
+
+  SECTION( "Leaf size of 1" )
+    {
+      typedef ImplicitBall< Z3i::Space > Ball;
+      Ball ball( Z3i::RealPoint( 0.5, 0.5, 0.5 ), 3.0 );
+      GaussDigitizer< Z3i::Space, Ball > dig;
+      dig.attach( ball );
+      dig.init( ball.getLowerBound(), ball.getUpperBound(), 0.5 );
+      ImageContainerBySTLVector< Z3i::Domain, bool > image( dig.getDomain() );
+      HierarchicalGaussDigitizer< Z3i::Space, Ball > hdig( dig, 1 );
+      hdig.digitize( image );
+      REQUIRE( nbDifferences( dig, image ) == 0 );
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
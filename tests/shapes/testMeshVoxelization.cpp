@@ -228,4 +228,71 @@ TEST_CASE("Basic voxelization test", "[voxelization]")
     //hard coded test.
     REQUIRE( outputSet.size() == 4162 );
   }
+  // ---------------------------------------------------------
+  SECTION("Conservative voxelization of a single triangle")
+  {
+    Domain domain(Point(0,0,0), Point(10,10,10));
+    DigitalSet outputSet(domain);
+    DigitalSet outputSet6(domain);
+    DigitalSet outputSet26(domain);
+    MeshVoxelizer6 voxelizer;
+    voxelizer.setConservative();
+    REQUIRE( voxelizer.isConservative() );
+
+    voxelizer.voxelize(outputSet, Point(5,0,0), Point(0,5,0), Point(0,0,5));
+    MeshVoxelizer6().voxelize(outputSet6, Point(5,0,0), Point(0,5,0), Point(0,0,5));
+    MeshVoxelizer26().voxelize(outputSet26, Point(5,0,0), Point(0,5,0), Point(0,0,5));
+
+    REQUIRE( outputSet.size() == 61 );
+    unsigned int nbIn = 0;
+    for(auto p: outputSet6)
+      nbIn += outputSet(p) ? 1 : 0;
+    for(auto p: outputSet26)
+      nbIn += outputSet(p) ? 1 : 0;
+    // separating voxelizations are subsets of the conservative one
+    REQUIRE( nbIn == outputSet6.size() + outputSet26.size() );
+    // every voxel containing a point of the triangle is output
+    unsigned int nbMissing = 0;
+    for(int i = 0; i <= 50; i++)
+      for(int j = 0; i + j <= 50; j++)
+      {
+        const PointR3 q = PointR3(5,0,0) + PointR3(-5,5,0) * ( i / 50.0 )
+          + PointR3(-5,0,5) * ( j / 50.0 );
+        const Point v( int( std::floor( q[0] + 0.5 ) ),
+                       int( std::floor( q[1] + 0.5 ) ),
+                       int( std::floor( q[2] + 0.5 ) ) );
+        nbMissing += outputSet(v) ? 0 : 1;
+      }
+    REQUIRE( nbMissing == 0 );
+  }
+
+  // ---------------------------------------------------------
+  SECTION("Mesh voxelization is the union of face voxelizations")
+  {
+    Mesh<Z3i::RealPoint> inputMesh;
+    MeshReader<Z3i::RealPoint>::importOFFFile(testPath +"/samples/box.off" , inputMesh);
+    Z3i::Domain domain( Point().diagonal(-30), Point().diagonal(30));
+    for(bool conservative : { false, true })
+    {
+      DigitalSet outputSet(domain);
+      DigitalSet facesSet(domain);
+      MeshVoxelizer6 voxelizer;
+      voxelizer.setConservative( conservative );
+      voxelizer.voxelize(outputSet, inputMesh, 10.0 );
+      for(unsigned int i = 0; i < inputMesh.nbFaces(); i++)
+      {
+        const auto& face = inputMesh.getFace(i);
+        for(size_t j = 0; j + 2 < face.size(); ++j)
+          voxelizer.voxelize(facesSet, inputMesh.getVertex(face[0]),
+                             inputMesh.getVertex(face[j+1]),
+                             inputMesh.getVertex(face[j+2]), 10.0);
+      }
+      CAPTURE(conservative);
+      REQUIRE( outputSet.size() == facesSet.size() );
+      unsigned int nbIn = 0;
+      for(auto p: facesSet)
+        nbIn += outputSet(p) ? 1 : 0;
+      REQUIRE( nbIn == facesSet.size() );
+    }
+  }
 }
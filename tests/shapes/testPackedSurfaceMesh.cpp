@@ -0,0 +1,495 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file testPackedSurfaceMesh.cpp
+ * @ingroup Tests
+ *
+ * @date 2026/10/18
+ *
+ * Functions for testing class PackedSurfaceMesh.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include <sstream>
+#include <fstream>
+#include <vector>
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include "DGtal/base/Common.h"
+#include "ConfigTest.h"
+#include "DGtalCatch.h"
+#include "DGtal/helpers/StdDefs.h"
+#include "DGtal/kernel/PointVector.h"
+#include "DGtal/graph/CUndirectedSimpleGraph.h"
+#include "DGtal/shapes/SurfaceMesh.h"
+#include "DGtal/shapes/PackedSurfaceMesh.h"
+#include "DGtal/shapes/SurfaceMeshHelper.h"
+#include "DGtal/io/readers/SurfaceMeshReader.h"
+#include "DGtal/io/writers/SurfaceMeshWriter.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for testing class PackedSurfaceMesh.
+///////////////////////////////////////////////////////////////////////////////
+
+typedef PointVector<3,double>                      RealPoint;
+typedef PointVector<3,double>                      RealVector;
+typedef SurfaceMesh< RealPoint, RealVector >       PolygonMesh;
+typedef PackedSurfaceMesh< RealPoint, RealVector > PackedMesh;
+typedef SurfaceMeshHelper< RealPoint, RealVector > PolygonMeshHelper;
+typedef PolygonMeshHelper::NormalsType             NormalsType;
+
+/// @return 'true' if the range \a r has the same elements as the vector \a v.
+bool sameRange( const PackedMesh::Range& r, const std::vector< std::size_t >& v )
+{
+  return std::vector< std::size_t >( r ) == v;
+}
+
+/// @return 'true' if all the topological queries of \a pmesh give the
+/// same results as the ones of \a smesh.
+bool sameTopology( const PolygonMesh& smesh, const PackedMesh& pmesh )
+{
+  if ( smesh.nbVertices() != pmesh.nbVertices()
+       || smesh.nbEdges() != pmesh.nbEdges()
+       || smesh.nbFaces() != pmesh.nbFaces() ) return false;
+  for ( std::size_t f = 0; f < smesh.nbFaces(); ++f )
+    if ( ! sameRange( pmesh.incidentVertices( f ), smesh.incidentVertices( f ) )
+         || ! sameRange( pmesh.neighborFaces( f ), smesh.neighborFaces( f ) ) )
+      return false;
+  for ( std::size_t v = 0; v < smesh.nbVertices(); ++v )
+    if ( ! sameRange( pmesh.incidentFaces( v ), smesh.incidentFaces( v ) )
+         || ! sameRange( pmesh.neighborVertices( v ), smesh.neighborVertices( v ) )
+         || pmesh.degree( v ) != smesh.degree( v ) )
+      return false;
+  for ( std::size_t e = 0; e < smesh.nbEdges(); ++e )
+    {
+      const auto ij = smesh.edgeVertices( e );
+      if ( pmesh.edgeVertices( e ) != ij
+           || ! sameRange( pmesh.edgeFaces( e ), smesh.edgeFaces( e ) )
+           || ! sameRange( pmesh.edgeRightFaces( e ), smesh.edgeRightFaces( e ) )
+           || ! sameRange( pmesh.edgeLeftFaces( e ), smesh.edgeLeftFaces( e ) )
+           || pmesh.makeEdge( ij.first, ij.second ) != e
+           || pmesh.makeEdge( ij.second, ij.first ) != e
+           || pmesh.isFlippable( e ) != smesh.isFlippable( e ) )
+        return false;
+    }
+  return pmesh.computeManifoldBoundaryEdges() == smesh.computeManifoldBoundaryEdges()
+    && pmesh.computeManifoldInnerEdges() == smesh.computeManifoldInnerEdges()
+    && pmesh.computeManifoldInnerConsistentEdges()
+    == smesh.computeManifoldInnerConsistentEdges()
+    && pmesh.computeManifoldInnerUnconsistentEdges()
+    == smesh.computeManifoldInnerUnconsistentEdges()
+    && pmesh.computeNonManifoldEdges() == smesh.computeNonManifoldEdges();
+}
+
+/// @return a packed mesh built directly from the positions and faces of \a smesh.
+PackedMesh packDirectly( const PolygonMesh& smesh )
+{
+  PackedMesh pmesh;
+  pmesh.init( smesh.positions().cbegin(), smesh.positions().cend(),
+              smesh.allIncidentVertices().cbegin(),
+              smesh.allIncidentVertices().cend() );
+  return pmesh;
+}
+
+/// Appends the bytes of \a x to \a output, in big endian order if asked.
+template <typename T>
+void writeBinary( std::ostream& output, T x, bool big_endian )
+{
+  char bytes[ sizeof( T ) ];
+  std::memcpy( bytes, &x, sizeof( T ) );
+  const std::uint16_t one = 1;
+  if ( big_endian == ( *reinterpret_cast< const char* >( &one ) == 1 ) )
+    std::reverse( bytes, bytes + sizeof( T ) );
+  output.write( bytes, sizeof( T ) );
+}
+
+/// @return the mesh \a smesh with its vertex normals as a PLY file,
+/// with an extra vertex property and an extra element.
+std::string writePLY( const PolygonMesh& smesh, const std::string& format )
+{
+  std::ostringstream output;
+  output << "ply\nformat " << format << " 1.0\ncomment test\n"
+         << "element vertex " << smesh.nbVertices() << "\n"
+         << "property double x\nproperty double y\nproperty double z\n"
+         << "property uchar red\n"
+         << "property double nx\nproperty double ny\nproperty double nz\n"
+         << "element face " << smesh.nbFaces() << "\n"
+         << "property list uchar int vertex_indices\n"
+         << "element material 1\nproperty list uchar float values\n"
+         << "end_header\n";
+  output.precision( 17 );
+  const bool ascii = format == "ascii";
+  const bool big   = format == "binary_big_endian";
+  for ( std::size_t v = 0; v < smesh.nbVertices(); ++v )
+    {
+      const auto x = smesh.position( v );
+      const auto n = smesh.vertexNormal( v );
+      if ( ascii )
+        output << x[ 0 ] << " " << x[ 1 ] << " " << x[ 2 ] << " 255 "
+               << n[ 0 ] << " " << n[ 1 ] << " " << n[ 2 ] << "\n";
+      else
+        {
+          for ( int i = 0; i < 3; ++i ) writeBinary( output, x[ i ], big );
+          writeBinary( output, std::uint8_t( 255 ), big );
+          for ( int i = 0; i < 3; ++i ) writeBinary( output, n[ i ], big );
+        }
+    }
+  for ( std::size_t f = 0; f < smesh.nbFaces(); ++f )
+    {
+      const auto & face = smesh.incidentVertices( f );
+      if ( ascii ) output << face.size();
+      else writeBinary( output, std::uint8_t( face.size() ), big );
+      for ( auto v : face )
+        if ( ascii ) output << " " << v;
+        else writeBinary( output, std::int32_t( v ), big );
+      if ( ascii ) output << "\n";
+    }
+  if ( ascii ) output << "2 0.5 1.5\n";
+  else
+    {
+      writeBinary( output, std::uint8_t( 2 ), big );
+      writeBinary( output, 0.5f, big );
+      writeBinary( output, 1.5f, big );
+    }
+  return output.str();
+}
+
+/// @return the mesh \a smesh as an OBJ file whose faces use relative
+/// indices and come after all the vertices.
+std::string writeRelativeOBJ( const PolygonMesh& smesh )
+{
+  std::ostringstream output;
+  output.precision( 17 );
+  for ( auto x : smesh.positions() )
+    output << "v " << x[ 0 ] << " " << x[ 1 ] << " " << x[ 2 ] << "\n";
+  const long nbV = smesh.nbVertices();
+  for ( std::size_t f = 0; f < smesh.nbFaces(); ++f )
+    {
+      output << "f";
+      for ( auto v : smesh.incidentVertices( f ) ) output << " " << long( v ) - nbV;
+      output << "\n";
+    }
+  return output.str();
+}
+
+SCENARIO( "PackedSurfaceMesh< RealPoint3 > concept check tests", "[packedmesh][concepts]" )
+{
+  BOOST_CONCEPT_ASSERT(( concepts::CUndirectedSimpleGraph< PackedMesh > ));
+}
+
+SCENARIO( "PackedSurfaceMesh< RealPoint3 > build tests", "[packedmesh][build]" )
+{
+  std::vector< RealPoint > positions =
+    { { 0, 0, 0 }, { 1, 0, 0 }, { 0, 1, 0 }, { 1, 1, 0 }, { 0, 0, 1 },
+      { 1, 0, 1 }, { 0, 1, 1 }, { 1, 1, 1 }, { 1, 0, 2 }, { 0, 0, 2 } };
+  std::vector< PolygonMesh::Vertices > faces =
+    { { 1, 0, 2, 3 }, { 0, 1, 5, 4 }, { 1, 3, 7, 5 },
+      { 3, 2, 6, 7 }, { 2, 0, 4, 6 }, { 4, 5, 8, 9 } };
+  PolygonMesh smesh( positions.cbegin(), positions.cend(),
+                     faces.cbegin(), faces.cend() );
+  GIVEN( "A box with an open side, packed from a surface mesh or directly" ) {
+    PackedMesh pmesh1( smesh );
+    PackedMesh pmesh2;
+    bool ok = pmesh2.init( positions.cbegin(), positions.cend(),
+                           faces.cbegin(), faces.cend() );
+    THEN( "Both packed meshes are valid and have the same topology as the surface mesh" ) {
+      CAPTURE( pmesh1 );
+      CAPTURE( pmesh2 );
+      REQUIRE( ok );
+      REQUIRE( pmesh1.isValid() );
+      REQUIRE( pmesh2.isValid() );
+      REQUIRE( pmesh2.Euler() == 1 );
+      REQUIRE( sameTopology( smesh, pmesh1 ) );
+      REQUIRE( sameTopology( smesh, pmesh2 ) );
+    }
+    THEN( "Ranges are packed contiguously" ) {
+      const auto& iv = pmesh2.allIncidentVertices();
+      REQUIRE( iv.size() == 6 );
+      REQUIRE( iv.offsets.size() == 7 );
+      REQUIRE( iv.indices.size() == 24 );
+      REQUIRE( pmesh2.allEdgeFaces().indices.size() == 24 );
+      REQUIRE( pmesh2.incidentVertices( 5 ).back() == 9 );
+    }
+    THEN( "Edges that do not exist are not found" ) {
+      REQUIRE( pmesh2.makeEdge( 0, 7 ) == pmesh2.nbEdges() );
+      REQUIRE( pmesh2.makeEdge( 9, 9 ) == pmesh2.nbEdges() );
+    }
+  }
+  GIVEN( "Faces with invalid vertices" ) {
+    faces.push_back( { 8, 9, 12 } );
+    PackedMesh pmesh;
+    bool ok = pmesh.init( positions.cbegin(), positions.cend(),
+                          faces.cbegin(), faces.cend() );
+    THEN( "Invalid vertices are ignored, as in SurfaceMesh" ) {
+      PolygonMesh smesh2;
+      smesh2.init( positions.cbegin(), positions.cend(),
+                   faces.cbegin(), faces.cend() );
+      REQUIRE( ! ok );
+      REQUIRE( pmesh.nbFaces() == 7 );
+      REQUIRE( pmesh.incidentVertices( 6 ).size() == 2 );
+      REQUIRE( sameTopology( smesh2, pmesh ) );
+    }
+  }
+}
+
+SCENARIO( "PackedSurfaceMesh< RealPoint3 > mesh helper tests", "[packedmesh][helper]" )
+{
+  std::vector< PolygonMesh > meshes;
+  meshes.push_back( PolygonMeshHelper::makeSphere( 3.0, RealPoint::zero,
+                                                   10, 10, NormalsType::VERTEX_NORMALS ) );
+  meshes.push_back( PolygonMeshHelper::makeTorus( 3.0, 1.0, RealPoint::zero,
+                                                  10, 10, 0, NormalsType::NO_NORMALS ) );
+  meshes.push_back( PolygonMeshHelper::makeLantern( 3.0, 3.0, RealPoint::zero,
+                                                    10, 10, NormalsType::NO_NORMALS ) );
+  GIVEN( "A sphere, a torus and a lantern, packed directly" ) {
+    for ( const auto& smesh : meshes )
+      {
+        const PackedMesh pmesh = packDirectly( smesh );
+        CAPTURE( smesh );
+        CAPTURE( pmesh );
+        REQUIRE( pmesh.isValid() );
+        REQUIRE( pmesh.Euler() == smesh.Euler() );
+        REQUIRE( sameTopology( smesh, pmesh ) );
+      }
+  }
+  GIVEN( "The same meshes packed from the surface mesh" ) {
+    for ( const auto& smesh : meshes )
+      {
+        const PackedMesh pmesh( smesh );
+        REQUIRE( sameTopology( smesh, pmesh ) );
+        REQUIRE( pmesh.vertexNormals().size() == smesh.vertexNormals().size() );
+      }
+  }
+  GIVEN( "A lantern whose edges were flipped" ) {
+    PolygonMesh smesh = meshes[ 2 ];
+    for ( std::size_t e = 0; e < smesh.nbEdges(); e += 3 )
+      if ( smesh.isFlippable( e ) ) smesh.flip( e, false );
+    const PackedMesh pmesh( smesh );
+    THEN( "The packed mesh keeps the numbering of edges" ) {
+      REQUIRE( sameTopology( smesh, pmesh ) );
+    }
+  }
+}
+
+SCENARIO( "PackedSurfaceMesh< RealPoint3 > geometric tests", "[packedmesh][geometry]" )
+{
+  auto smesh = PolygonMeshHelper::makeTorus( 3.0, 1.0, RealPoint::zero,
+                                             12, 8, 0, NormalsType::NO_NORMALS );
+  smesh.computeFaceNormalsFromPositions();
+  smesh.computeVertexNormalsFromFaceNormals();
+  PackedMesh pmesh = packDirectly( smesh );
+  pmesh.computeFaceNormalsFromPositions();
+  pmesh.computeVertexNormalsFromFaceNormals();
+  THEN( "Normals, centroids, areas and lengths are the same" ) {
+    REQUIRE( pmesh.averageEdgeLength() == Approx( smesh.averageEdgeLength() ) );
+    for ( std::size_t f = 0; f < smesh.nbFaces(); ++f )
+      {
+        REQUIRE( ( pmesh.faceNormal( f ) - smesh.faceNormal( f ) ).norm() < 1e-12 );
+        REQUIRE( ( pmesh.faceCentroid( f ) - smesh.faceCentroid( f ) ).norm() < 1e-12 );
+        REQUIRE( pmesh.faceArea( f ) == Approx( smesh.faceArea( f ) ) );
+        REQUIRE( pmesh.localWindow( f ) == Approx( smesh.localWindow( f ) ) );
+      }
+    for ( std::size_t v = 0; v < smesh.nbVertices(); ++v )
+      REQUIRE( ( pmesh.vertexNormal( v ) - smesh.vertexNormal( v ) ).norm() < 1e-12 );
+  }
+  THEN( "Inclusions in balls are the same" ) {
+    const auto fs = smesh.computeFacesInclusionsInBall( 1.5, 7 );
+    const auto fp = pmesh.computeFacesInclusionsInBall( 1.5, 7 );
+    REQUIRE( fs.size() > 1 );
+    REQUIRE( fs == fp );
+    const auto cs = smesh.computeCellsInclusionsInBall( 1.5, 7 );
+    const auto cp = pmesh.computeCellsInclusionsInBall( 1.5, 7 );
+    REQUIRE( std::get<0>( cs ) == std::get<0>( cp ) );
+    REQUIRE( std::get<1>( cs ) == std::get<1>( cp ) );
+    REQUIRE( std::get<2>( cs ) == std::get<2>( cp ) );
+  }
+}
+
+SCENARIO( "PackedSurfaceMesh< RealPoint3 > reader tests", "[packedmesh][io]" )
+{
+  typedef SurfaceMeshReader< RealPoint, RealVector > PolygonMeshReader;
+  typedef SurfaceMeshWriter< RealPoint, RealVector > PolygonMeshWriter;
+  GIVEN( "An OBJ file read as a surface mesh and as a packed mesh" ) {
+    std::string filename = testPath + "samples/testObj.obj";
+    PolygonMesh smesh;
+    PackedMesh  pmesh;
+    std::ifstream input1( filename );
+    bool ok1 = PolygonMeshReader::readOBJ( input1, smesh );
+    std::ifstream input2( filename );
+    bool ok2 = PolygonMeshReader::readOBJ( input2, pmesh );
+    THEN( "Both meshes are the same" ) {
+      CAPTURE( smesh );
+      CAPTURE( pmesh );
+      REQUIRE( ok1 );
+      REQUIRE( ok2 );
+      REQUIRE( pmesh.nbFaces() == 6 );
+      REQUIRE( sameTopology( smesh, pmesh ) );
+      REQUIRE( pmesh.positions() == smesh.positions() );
+    }
+  }
+  GIVEN( "A sphere with normals written as an OBJ file" ) {
+    auto polymesh = PolygonMeshHelper::makeSphere( 3.0, RealPoint::zero,
+                                                   10, 10, NormalsType::VERTEX_NORMALS );
+    std::ostringstream output;
+    bool okw = PolygonMeshWriter::writeOBJ( output, polymesh );
+    std::istringstream input1( output.str() );
+    std::istringstream input2( output.str() );
+    PolygonMesh smesh;
+    PackedMesh  pmesh;
+    bool ok1 = PolygonMeshReader::readOBJ( input1, smesh );
+    bool ok2 = PolygonMeshReader::readOBJ( input2, pmesh );
+    THEN( "Both read meshes are the same, with the same normals" ) {
+      REQUIRE( okw );
+      REQUIRE( ok1 );
+      REQUIRE( ok2 );
+      REQUIRE( pmesh.Euler() == 2 );
+      REQUIRE( sameTopology( smesh, pmesh ) );
+      REQUIRE( pmesh.vertexNormals() == smesh.vertexNormals() );
+      REQUIRE( pmesh.faceNormals() == smesh.faceNormals() );
+      REQUIRE( ! pmesh.faceNormals().empty() );
+    }
+  }
+  GIVEN( "An OBJ file with relative indices" ) {
+    PolygonMesh smesh, smesh_rel;
+    std::ifstream input1( testPath + "samples/testObj.obj" );
+    std::ifstream input2( testPath + "samples/testObjRel.obj" );
+    bool ok1 = PolygonMeshReader::readOBJ( input1, smesh );
+    bool ok2 = PolygonMeshReader::readOBJ( input2, smesh_rel );
+    THEN( "It is the same mesh as with absolute indices" ) {
+      REQUIRE( ok1 );
+      REQUIRE( ok2 );
+      REQUIRE( smesh_rel.nbFaces() == 6 );
+      REQUIRE( smesh_rel.positions() == smesh.positions() );
+      REQUIRE( smesh_rel.allIncidentVertices() == smesh.allIncidentVertices() );
+    }
+  }
+  GIVEN( "A big OBJ file with relative indices, parsed in several chunks" ) {
+    auto polymesh = PolygonMeshHelper::makeTorus( 3.0, 1.0, RealPoint::zero,
+                                                  400, 200, 0,
+                                                  NormalsType::NO_NORMALS );
+    const std::string file = writeRelativeOBJ( polymesh );
+    std::istringstream input1( file );
+    std::istringstream input2( file );
+    PolygonMesh smesh;
+    PackedMesh  pmesh;
+    bool ok1 = PolygonMeshReader::readOBJ( input1, smesh );
+    bool ok2 = PolygonMeshReader::readOBJ( input2, pmesh );
+    THEN( "The read meshes are the same as the original one" ) {
+      REQUIRE( MeshTextParser::nbChunks( file.size() ) > 1 );
+      REQUIRE( ok1 );
+      REQUIRE( ok2 );
+      REQUIRE( smesh.Euler() == 0 );
+      REQUIRE( smesh.allIncidentVertices() == polymesh.allIncidentVertices() );
+      REQUIRE( sameTopology( smesh, pmesh ) );
+    }
+  }
+  GIVEN( "A sphere with normals written as PLY files" ) {
+    auto polymesh = PolygonMeshHelper::makeSphere( 3.0, RealPoint::zero,
+                                                   10, 10, NormalsType::VERTEX_NORMALS );
+    for ( std::string format : { "ascii", "binary_little_endian", "binary_big_endian" } )
+      {
+        std::istringstream input1( writePLY( polymesh, format ) );
+        std::istringstream input2( writePLY( polymesh, format ) );
+        PolygonMesh smesh;
+        PackedMesh  pmesh;
+        bool ok1 = PolygonMeshReader::readPLY( input1, smesh );
+        bool ok2 = PolygonMeshReader::readPLY( input2, pmesh );
+        THEN( "The read meshes are the same as the original one" ) {
+          CAPTURE( format );
+          REQUIRE( ok1 );
+          REQUIRE( ok2 );
+          REQUIRE( smesh.positions() == polymesh.positions() );
+          REQUIRE( smesh.allIncidentVertices() == polymesh.allIncidentVertices() );
+          REQUIRE( smesh.vertexNormals() == polymesh.vertexNormals() );
+          REQUIRE( smesh.faceNormals().size() == polymesh.nbFaces() );
+          REQUIRE( sameTopology( smesh, pmesh ) );
+          REQUIRE( pmesh.vertexNormals() == smesh.vertexNormals() );
+          REQUIRE( pmesh.faceNormals() == smesh.faceNormals() );
+        }
+      }
+  }
+  GIVEN( "A truncated binary PLY file" ) {
+    auto polymesh = PolygonMeshHelper::makeSphere( 3.0, RealPoint::zero,
+                                                   10, 10, NormalsType::VERTEX_NORMALS );
+    const std::string file = writePLY( polymesh, "binary_little_endian" );
+    std::istringstream input( file.substr( 0, file.size() / 2 ) );
+    PolygonMesh smesh;
+    bool ok = PolygonMeshReader::readPLY( input, smesh );
+    THEN( "Reading fails" ) {
+      REQUIRE( ! ok );
+    }
+  }
+  GIVEN( "Truncated ASCII PLY files, and one with a negative element count" ) {
+    auto polymesh = PolygonMeshHelper::makeSphere( 3.0, RealPoint::zero,
+                                                   10, 10, NormalsType::VERTEX_NORMALS );
+    const std::string file = writePLY( polymesh, "ascii" );
+    const std::string header = "ply\nformat ascii 1.0\n";
+    const std::string body   = "element vertex 3\nproperty float x\nproperty float y\n"
+      "property float z\nelement face 1\nproperty list uchar int vertex_indices\n"
+      "end_header\n0 0 0\n";
+    std::istringstream input1( file.substr( 0, file.size() / 2 ) );
+    std::istringstream input2( header + "element foo 1000\nproperty int a\n" + body );
+    std::istringstream input3( header + "element foo -1000\nproperty int a\n" + body );
+    PolygonMesh smesh1, smesh2, smesh3;
+    bool ok1 = PolygonMeshReader::readPLY( input1, smesh1 );
+    bool ok2 = PolygonMeshReader::readPLY( input2, smesh2 );
+    bool ok3 = PolygonMeshReader::readPLY( input3, smesh3 );
+    THEN( "Reading fails without reading past the data" ) {
+      REQUIRE( ! ok1 );
+      REQUIRE( ! ok2 );
+      REQUIRE( ! ok3 );
+    }
+  }
+  GIVEN( "Binary PLY files with negative list counts or indices" ) {
+    auto makePLY = [] ( std::int8_t count, std::int32_t index )
+      {
+        std::ostringstream output;
+        output << "ply\nformat binary_little_endian 1.0\n"
+               << "element vertex 3\nproperty float x\nproperty float y\nproperty float z\n"
+               << "element face 1\nproperty list char int vertex_indices\nend_header\n";
+        for ( int v = 0; v < 3; ++v )
+          for ( int i = 0; i < 3; ++i )
+            writeBinary( output, float( v == i ), false );
+        writeBinary( output, count, false );
+        writeBinary( output, std::int32_t( 0 ), false );
+        writeBinary( output, std::int32_t( 1 ), false );
+        writeBinary( output, index, false );
+        return output.str();
+      };
+    std::istringstream input1( makePLY( -3, 2 ) );
+    std::istringstream input2( makePLY( 3, -2 ) );
+    PolygonMesh smesh1, smesh2;
+    bool ok1 = PolygonMeshReader::readPLY( input1, smesh1 );
+    bool ok2 = PolygonMeshReader::readPLY( input2, smesh2 );
+    THEN( "Negative counts are rejected and negative indices are invalid vertices" ) {
+      REQUIRE( ! ok1 );
+      REQUIRE( ! ok2 );
+      REQUIRE( smesh2.nbFaces() == 1 );
+      REQUIRE( smesh2.incidentVertices( 0 ).size() == 2 );
+    }
+  }
+}
+
+///////////////////////////////////////////////////////////////////////////////
@@ -42,6 +42,11 @@
 #include "DGtal/shapes/SurfaceMeshHelper.h"
 #include "DGtal/io/readers/SurfaceMeshReader.h"
 #include "DGtal/io/writers/SurfaceMeshWriter.h"
+#include "DGtal/shapes/MeshHelpers.h"
+#include "DGtal/topology/SetOfSurfels.h"
+#include "DGtal/topology/DigitalSurface.h"
+#include "DGtal/topology/CanonicCellEmbedder.h"
+#include "DGtal/topology/helpers/Surfaces.h"
 ///////////////////////////////////////////////////////////////////////////////
 
 using namespace std;
@@ -317,6 +322,75 @@ SCENARIO( "SurfaceMesh< RealPoint3 > mesh helper tests", "[surfmesh][helper]" )
   }
 }
 
+SCENARIO( "SurfaceMesh< RealPoint3 > digital surface tests", "[surfmesh][digital]" )
+{
+  typedef Z3i::KSpace                                KSpace;
+  typedef KSpace::Cell                               Cell;
+  typedef KSpace::SurfelSet                          SurfelSet;
+  typedef SetOfSurfels< KSpace, SurfelSet >          Container;
+  typedef DigitalSurface< Container >                Surface;
+  typedef CanonicCellEmbedder< KSpace >              Embedder;
+  typedef SurfaceMesh< Z3i::RealPoint, Z3i::RealPoint > PolygonMesh;
+  // A ball, and two cubes sharing one edge, so that the boundary is not a manifold.
+  Z3i::Domain domain( Z3i::Point::diagonal( -10 ), Z3i::Point::diagonal( 10 ) );
+  Z3i::Domain cube1( Z3i::Point( 3, 3, 3 ), Z3i::Point( 5, 5, 5 ) );
+  Z3i::Domain cube2( Z3i::Point( 6, 6, 5 ), Z3i::Point( 8, 8, 7 ) );
+  Z3i::DigitalSet voxels( domain );
+  for ( auto p : domain )
+    if ( ( p - Z3i::Point( -4, 0, 1 ) ).squaredNorm() <= 25
+         || cube1.isInside( p ) || cube2.isInside( p ) )
+      voxels.insertNew( p );
+  KSpace K;
+  K.init( domain.lowerBound(), domain.upperBound(), true );
+  SurfelSet surfels;
+  Surfaces< KSpace >::sMakeBoundary( surfels, K, voxels, K.lowerBound(), K.upperBound() );
+  Surface surface( new Container( K, SurfelAdjacency< 3 >( true ), surfels ) );
+  Embedder embedder( K );
+  GIVEN( "The primal surface mesh of a digital surface" ) {
+    PolygonMesh polymesh;
+    std::map< Cell, PolygonMesh::Index > cellmap;
+    MeshHelpers::digitalSurface2PrimalSurfaceMesh( surface, embedder, polymesh, cellmap );
+    THEN( "Vertices are numbered in the order of their first appearance" ) {
+      std::map< Cell, PolygonMesh::Index > expected;
+      PolygonMesh::Face f = 0;
+      for ( auto s : surface )
+        {
+          auto vtcs = Surfaces< KSpace >::getPrimalVertices( K, s, true );
+          for ( auto v : vtcs )
+            if ( ! expected.count( v ) )
+              {
+                const auto idx = expected.size();
+                expected[ v ] = idx;
+              }
+          REQUIRE( f < polymesh.nbFaces() );
+          const auto & face = polymesh.incidentVertices( f++ );
+          REQUIRE( face.size() == 4 );
+          for ( std::size_t j = 0; j < 4; ++j )
+            REQUIRE( face[ j ] == expected[ vtcs[ j ] ] );
+        }
+      REQUIRE( cellmap == expected );
+      REQUIRE( polymesh.nbFaces() == surface.size() );
+      REQUIRE( polymesh.nbVertices() == expected.size() );
+      for ( auto v : expected )
+        REQUIRE( polymesh.position( v.second ) == embedder( v.first ) );
+    }
+    THEN( "Edges are stitched, the edge shared by the cubes being non manifold" ) {
+      auto mani_bdry = polymesh.computeManifoldBoundaryEdges();
+      auto non_mani  = polymesh.computeNonManifoldEdges();
+      REQUIRE( mani_bdry.size() == 0 );
+      REQUIRE( non_mani.size()  == 1 );
+      REQUIRE( polymesh.edgeFaces( non_mani[ 0 ] ).size() == 4 );
+      for ( PolygonMesh::Edge e = 0; e < polymesh.nbEdges(); ++e )
+        {
+          const auto ij = polymesh.edgeVertices( e );
+          REQUIRE( ij.first < ij.second );
+          REQUIRE( polymesh.makeEdge( ij.first, ij.second ) == e );
+          REQUIRE( polymesh.edgeRightFaces( e ).size() == polymesh.edgeLeftFaces( e ).size() );
+        }
+    }
+  }
+}
+
 SCENARIO( "SurfaceMesh< RealPoint3 > reader/writer tests", "[surfmesh][io]" )
 {
   typedef PointVector<3,double>                      RealPoint;
@@ -36,6 +36,7 @@
 
 #include <DGtal/shapes/WindingNumbersShape.h>
 #include <DGtal/shapes/GaussDigitizer.h>
+#include <DGtal/images/ImageContainerBySTLVector.h>
 
 ///////////////////////////////////////////////////////////////////////////////
 
@@ -107,6 +108,39 @@ TEST_CASE( "Testing WindingNumbersShape" )
              ++cpt;
      REQUIRE( cpt == 8);
  }
+
+ SECTION("Testing the hierarchical digitization")
+ {
+     // Oriented points on the unit sphere, with equal areas.
+     const int n = 500;
+     Eigen::MatrixXd points(n,3);
+     Eigen::MatrixXd normals(n,3);
+     for(auto i = 0; i < n; ++i)
+     {
+       const double z   = 1.0 - 2.0 * ( i + 0.5 ) / n;
+       const double r   = std::sqrt( 1.0 - z * z );
+       const double phi = 2.399963229728653 * i;
+       points.row(i) << r * std::cos(phi), r * std::sin(phi), z;
+       normals.row(i) = points.row(i);
+     }
+     Eigen::VectorXd areas = Eigen::VectorXd::Constant(n, 4.0 * M_PI / n);
+     WNShape wnshape(points,normals,areas);
+
+     const double h = 0.1;
+     Z3i::Domain domain(Z3i::Point::diagonal(-13), Z3i::Point::diagonal(13));
+     ImageContainerBySTLVector<Z3i::Domain, bool> image(domain);
+     wnshape.digitize(image, h);
+     auto nbInside = 0;
+     auto nbDiff   = 0;
+     for(auto p: domain)
+     {
+       const bool inside = wnshape.orientation(h * RealPoint(p)) == DGtal::INSIDE;
+       nbInside += inside ? 1 : 0;
+       nbDiff   += ( inside != image(p) ) ? 1 : 0;
+     }
+     REQUIRE( nbInside > 0 );
+     REQUIRE( nbDiff == 0 );
+ }
 };
 
 /** @ingroup Tests **/